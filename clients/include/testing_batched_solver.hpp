@@ -0,0 +1,191 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_BATCHED_SOLVER_HPP
+#define TESTING_BATCHED_SOLVER_HPP
+
+#include "utility.hpp"
+
+#include <rocalution/rocalution.hpp>
+
+#include <vector>
+
+using namespace rocalution;
+
+static bool check_residual(float res)
+{
+    return (res < 1e-3f);
+}
+
+static bool check_residual(double res)
+{
+    return (res < 1e-6);
+}
+
+template <typename T>
+bool testing_batched_solver(Arguments argus)
+{
+    int         ndim        = argus.size;
+    int         batch_count = argus.index;
+    std::string solver      = argus.solver;
+    std::string precond     = argus.precond;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate a batch of systems with different sizes
+    std::vector<LocalMatrix<T>>        mat(batch_count);
+    std::vector<const LocalMatrix<T>*> pmat(batch_count);
+
+    for(int i = 0; i < batch_count; ++i)
+    {
+        int* csr_ptr = NULL;
+        int* csr_col = NULL;
+        T*   csr_val = NULL;
+
+        int nrow = gen_2d_laplacian(ndim + i % 3, &csr_ptr, &csr_col, &csr_val);
+        int nnz  = csr_ptr[nrow];
+
+        // Vary the diagonal and make the systems non-symmetric for non-CG solvers
+        for(int row = 0; row < nrow; ++row)
+        {
+            for(int j = csr_ptr[row]; j < csr_ptr[row + 1]; ++j)
+            {
+                if(csr_col[j] == row)
+                {
+                    csr_val[j] += static_cast<T>(0.1 * (i % 5));
+                }
+                else if(solver != "CG" && csr_col[j] > row)
+                {
+                    csr_val[j] *= static_cast<T>(0.5);
+                }
+            }
+        }
+
+        mat[i].SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+        pmat[i] = &mat[i];
+    }
+
+    BatchedMatrix<T> A;
+    BatchedVector<T> x;
+    BatchedVector<T> b;
+    BatchedVector<T> e;
+
+    A.CopyFrom(batch_count, pmat.data());
+
+    x.Allocate("x", A);
+    b.Allocate("b", A);
+    e.Allocate("e", A);
+
+    // b = A * e
+    e.Ones();
+    A.Apply(e, &b);
+
+    // Solver
+    BatchedIterativeSolver<T>* ls;
+
+    if(solver == "CG")
+        ls = new BatchedCG<T>;
+    else if(solver == "BiCGStab")
+        ls = new BatchedBiCGStab<T>;
+    else if(solver == "GMRES")
+        ls = new BatchedGMRES<T>;
+    else
+        return false;
+
+    // Preconditioner
+    if(precond == "None")
+        ls->SetPreconditioner(BatchedNone);
+    else if(precond == "Jacobi")
+        ls->SetPreconditioner(BatchedJacobi);
+    else if(precond == "ILU0")
+        ls->SetPreconditioner(BatchedILU0);
+    else
+        return false;
+
+    ls->Verbose(0);
+    ls->SetOperator(A);
+    ls->Init(0.0, sizeof(T) == sizeof(float) ? 1e-5 : 1e-10, 1e+8, 10000);
+    ls->Build();
+
+    x.Zeros();
+    ls->Solve(b, &x);
+
+    // Verify solutions
+    bool success = (ls->GetNumConverged() == batch_count);
+
+    for(int i = 0; i < batch_count; ++i)
+    {
+        int            n = x.GetSize(i);
+        std::vector<T> sol(n);
+
+        x.CopyToData(i, sol.data());
+
+        // Compare against a single system solve
+        LocalVector<T> xi;
+        LocalVector<T> bi;
+
+        xi.Allocate("xi", n);
+        bi.Allocate("bi", n);
+
+        xi.CopyFromData(sol.data());
+        bi.Ones();
+
+        xi.ScaleAdd(-1.0, bi);
+
+        success &= check_residual(xi.Norm() / bi.Norm());
+        success &= (ls->GetSolverStatus(i) == 2);
+        success &= (ls->GetIterationCount(i) > 0);
+    }
+
+    std::vector<int> iter(batch_count);
+
+    for(int i = 0; i < batch_count; ++i)
+    {
+        iter[i] = ls->GetIterationCount(i);
+    }
+
+    // Numerical rebuild with unchanged values yields the same iterations
+    ls->ReBuildNumeric();
+
+    x.Zeros();
+    ls->Solve(b, &x);
+
+    for(int i = 0; i < batch_count; ++i)
+    {
+        success &= (ls->GetIterationCount(i) == iter[i]);
+    }
+
+    // Clean up
+    ls->Clear();
+    delete ls;
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+#endif // TESTING_BATCHED_SOLVER_HPP
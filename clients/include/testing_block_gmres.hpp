@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_BLOCK_GMRES_HPP
+#define TESTING_BLOCK_GMRES_HPP
+
+#include "utility.hpp"
+
+#include <rocalution/rocalution.hpp>
+
+#include <vector>
+
+using namespace rocalution;
+
+static bool check_residual(float res)
+{
+    return (res < 1e-2f);
+}
+
+static bool check_residual(double res)
+{
+    return (res < 1e-2);
+}
+
+template <typename T>
+bool testing_block_gmres(Arguments argus)
+{
+    int          ndim    = argus.size;
+    int          num_rhs = argus.index;
+    std::string  precond = argus.precond;
+    unsigned int format  = argus.format;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T>              A;
+    std::vector<LocalVector<T>> x(num_rhs);
+    std::vector<LocalVector<T>> b(num_rhs);
+    std::vector<LocalVector<T>> e(num_rhs);
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+
+    std::vector<LocalVector<T>*>       px(num_rhs);
+    std::vector<const LocalVector<T>*> pb(num_rhs);
+
+    for(int j = 0; j < num_rhs; ++j)
+    {
+        x[j].MoveToAccelerator();
+        b[j].MoveToAccelerator();
+        e[j].MoveToAccelerator();
+
+        // Allocate x, b and e
+        x[j].Allocate("x", A.GetN());
+        b[j].Allocate("b", A.GetM());
+        e[j].Allocate("e", A.GetN());
+
+        // Every other system is a copy of the first one, including the initial guess,
+        // such that the block of residuals is rank deficient
+        if(j % 2 == 0)
+        {
+            e[j].Ones();
+        }
+        else
+        {
+            e[j].SetRandomUniform(1000ULL + j, -1.0, 1.0);
+        }
+
+        // b = A * e
+        A.Apply(e[j], &b[j]);
+
+        // Random initial guess
+        x[j].SetRandomUniform(12345ULL + j % 2, -4.0, 6.0);
+
+        px[j] = &x[j];
+        pb[j] = &b[j];
+    }
+
+    // Solver
+    BlockGMRES<LocalMatrix<T>, LocalVector<T>, T> ls;
+
+    // Preconditioner
+    Preconditioner<LocalMatrix<T>, LocalVector<T>, T>* p;
+
+    if(precond == "None")
+        p = NULL;
+    else if(precond == "Chebyshev")
+    {
+        // Chebyshev preconditioner
+
+        // Determine min and max eigenvalues
+        T lambda_min;
+        T lambda_max;
+
+        A.Gershgorin(lambda_min, lambda_max);
+
+        AIChebyshev<LocalMatrix<T>, LocalVector<T>, T>* cheb
+            = new AIChebyshev<LocalMatrix<T>, LocalVector<T>, T>;
+        cheb->Set(3, lambda_max / 7.0, lambda_max);
+
+        p = cheb;
+    }
+    else if(precond == "GS")
+        p = new GS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ILU")
+        p = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "MCILU")
+        p = new MultiColoredILU<LocalMatrix<T>, LocalVector<T>, T>;
+    else
+        return false;
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+
+    // Set preconditioner
+    if(p != NULL)
+    {
+        ls.SetPreconditioner(*p);
+    }
+
+    ls.Init(1e-6, 0.0, 1e+8, 10000);
+    ls.Build();
+
+    // Matrix format
+    A.ConvertTo(format, format == BCSR ? argus.blockdim : 1);
+
+    ls.Solve(num_rhs, pb.data(), px.data());
+
+    // Verify solutions
+    bool success = true;
+
+    for(int j = 0; j < num_rhs; ++j)
+    {
+        T nrm_e = e[j].Norm();
+
+        x[j].ScaleAdd(-1.0, e[j]);
+        T nrm2 = x[j].Norm();
+
+        success &= check_residual(nrm2 / nrm_e);
+    }
+
+    // Single right-hand side solve
+    x[0].SetRandomUniform(54321ULL, -4.0, 6.0);
+
+    ls.Solve(b[0], &x[0]);
+
+    x[0].ScaleAdd(-1.0, e[0]);
+    success &= check_residual(x[0].Norm() / e[0].Norm());
+
+    // Clean up
+    ls.Clear();
+    if(p != NULL)
+    {
+        delete p;
+    }
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+#endif // TESTING_BLOCK_GMRES_HPP
@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_GEOMETRIC_MULTIGRID_HPP
+#define TESTING_GEOMETRIC_MULTIGRID_HPP
+
+#include "utility.hpp"
+
+#include <rocalution/rocalution.hpp>
+
+using namespace rocalution;
+
+static bool check_residual(float res)
+{
+    return (res < 1e-2f);
+}
+
+static bool check_residual(double res)
+{
+    return (res < 1e-5);
+}
+
+template <typename T>
+bool testing_geometric_multigrid(Arguments argus)
+{
+    int         ndim      = argus.size;
+    int         pre_iter  = argus.pre_smooth;
+    int         post_iter = argus.post_smooth;
+    std::string smoother  = argus.smoother;
+    std::string stencil   = argus.matrix_type;
+    int         cycle     = argus.cycle;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    unsigned int type;
+
+    if(stencil == "Laplace2D")
+    {
+        type = Laplace2D;
+    }
+    else if(stencil == "Laplace3D")
+    {
+        type = Laplace3D;
+    }
+    else if(stencil == "Laplace3D27")
+    {
+        type = Laplace3D27;
+    }
+    else if(stencil == "Diffusion3D")
+    {
+        type = Diffusion3D;
+    }
+    else
+    {
+        return false;
+    }
+
+    // rocALUTION structures
+    LocalStencil<T> A(type);
+    LocalVector<T>  x;
+    LocalVector<T>  b;
+    LocalVector<T>  e;
+
+    A.SetGrid(ndim);
+
+    // Smoothly varying, anisotropic coefficients
+    if(type == Diffusion3D)
+    {
+        int64_t nrow = A.GetM();
+
+        T* k = new T[3 * nrow];
+
+        for(int64_t i = 0; i < nrow; ++i)
+        {
+            int z = static_cast<int>(i / (ndim * ndim));
+
+            k[i]            = static_cast<T>(1.0 + 0.5 * z / ndim);
+            k[nrow + i]     = static_cast<T>(1.0);
+            k[2 * nrow + i] = static_cast<T>(2.0 - z / static_cast<double>(ndim));
+        }
+
+        LocalVector<T> coeff;
+        coeff.SetDataPtr(&k, "k", 3 * nrow);
+
+        A.SetCoefficients(coeff);
+    }
+
+    // Allocate x, b and e
+    x.Allocate("x", A.GetN());
+    b.Allocate("b", A.GetM());
+    e.Allocate("e", A.GetN());
+
+    // b = A * 1
+    e.Ones();
+    A.Apply(e, &b);
+
+    // Random initial guess
+    x.SetRandomUniform(12345ULL, -4.0, 6.0);
+
+    // Solver
+    CG<LocalStencil<T>, LocalVector<T>, T> ls;
+
+    // GMG
+    GeometricMultiGrid<LocalStencil<T>, LocalVector<T>, T> p;
+
+    p.SetCoarsestLevel(20);
+    p.SetCycle(cycle);
+    p.SetSmootherPreIter(pre_iter);
+    p.SetSmootherPostIter(post_iter);
+
+    if(smoother == "Jacobi")
+    {
+        p.SetSmootherType(JacobiSmoother);
+    }
+    else if(smoother == "Chebyshev")
+    {
+        p.SetSmootherType(ChebyshevSmoother);
+    }
+    else
+    {
+        return false;
+    }
+
+    p.InitMaxIter(1);
+    p.Verbose(0);
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+    ls.SetPreconditioner(p);
+
+    ls.Init(1e-8, 0.0, 1e+8, 10000);
+    ls.Build();
+
+    bool success = (p.GetNumLevels() > 1);
+
+    ls.Solve(b, &x);
+
+    // The number of iterations has to be (almost) independent of the grid size
+    success &= (ls.GetIterationCount() < 50);
+
+    // Verify solution
+    x.ScaleAdd(-1.0, e);
+    T nrm2 = x.Norm();
+
+    success &= check_residual(nrm2);
+
+    // Clean up
+    ls.Clear();
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+#endif // TESTING_GEOMETRIC_MULTIGRID_HPP
@@ -107,6 +107,16 @@ void testing_local_matrix_bad_args(void)
                      ".*Assertion.*permutation != (NULL|__null)*");
     }
 
+    // MultiApply
+    {
+        const LocalVector<T>*  pvec1    = &vec1;
+        LocalVector<T>*        pvec2    = &vec1;
+        const LocalVector<T>** null_in  = nullptr;
+        LocalVector<T>**       null_out = nullptr;
+        ASSERT_DEATH(mat1.MultiApply(1, null_in, &pvec2), ".*Assertion.*in != (NULL|__null)*");
+        ASSERT_DEATH(mat1.MultiApply(1, &pvec1, null_out), ".*Assertion.*out != (NULL|__null)*");
+    }
+
     // LSolve, USolve, LLSolve, LUSolve, QRSolve
     {
         LocalVector<T>* null_vec = nullptr;
@@ -54,8 +54,178 @@ void testing_local_stencil_bad_args(void)
         ASSERT_DEATH(stn.ApplyAdd(vec, 1.0, null_vec), ".*Assertion.*out != (NULL|__null)*");
     }
 
+    // ExtractInverseDiagonal
+    {
+        LocalVector<T>* null_vec = nullptr;
+        ASSERT_DEATH(stn.ExtractInverseDiagonal(null_vec),
+                     ".*Assertion.*vec_inv_diag != (NULL|__null)*");
+    }
+
+    // Coarsen
+    {
+        LocalStencil<T>* null_stn = nullptr;
+        ASSERT_DEATH(stn.Coarsen(null_stn), ".*Assertion.*coarse != (NULL|__null)*");
+    }
+
+    // Restriction
+    {
+        LocalVector<T>* null_vec = nullptr;
+        ASSERT_DEATH(stn.Restriction(vec, null_vec), ".*Assertion.*coarse != (NULL|__null)*");
+    }
+
+    // Prolongation
+    {
+        LocalVector<T>* null_vec = nullptr;
+        ASSERT_DEATH(stn.Prolongation(vec, null_vec), ".*Assertion.*fine != (NULL|__null)*");
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+}
+
+template <typename T>
+bool testing_local_stencil(Arguments argus)
+{
+    int         ndim    = argus.size;
+    std::string stencil = argus.matrix_type;
+
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    unsigned int type;
+
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow;
+
+    // Generate the assembled reference
+    if(stencil == "Laplace2D")
+    {
+        type = Laplace2D;
+        nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    }
+    else if(stencil == "Laplace3D" || stencil == "Diffusion3D")
+    {
+        type = (stencil == "Laplace3D") ? Laplace3D : Diffusion3D;
+        nrow = gen_3d_laplacian_7pt(ndim, &csr_ptr, &csr_col, &csr_val);
+    }
+    else if(stencil == "Laplace3D27")
+    {
+        type = Laplace3D27;
+        nrow = gen_3d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    }
+    else
+    {
+        return false;
+    }
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", csr_ptr[nrow], nrow, nrow);
+
+    LocalStencil<T> S(type);
+    S.SetGrid(ndim);
+
+    bool success = (S.GetM() == nrow) && (S.GetN() == nrow);
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> z;
+
+    x.Allocate("x", nrow);
+    y.Allocate("y", nrow);
+    z.Allocate("z", nrow);
+
+    x.SetRandomUniform(12345ULL, -1.0, 1.0);
+
+    // Apply, compare against the assembled operator
+    A.Apply(x, &y);
+    S.Apply(x, &z);
+
+    z.ScaleAdd(-1.0, y);
+    success &= (std::abs(z.Norm()) <= 1e-5 * std::abs(y.Norm()));
+
+    // ApplyAdd, z = y + alpha * S * x
+    y.CopyFrom(x);
+    A.ApplyAdd(x, static_cast<T>(argus.alpha), &y);
+
+    z.CopyFrom(x);
+    S.ApplyAdd(x, static_cast<T>(argus.alpha), &z);
+
+    z.ScaleAdd(-1.0, y);
+    success &= (std::abs(z.Norm()) <= 1e-5 * std::abs(y.Norm()));
+
+    // Inverse diagonal
+    A.ExtractInverseDiagonal(&y);
+    S.ExtractInverseDiagonal(&z);
+
+    z.ScaleAdd(-1.0, y);
+    success &= (std::abs(z.Norm()) <= 1e-5 * std::abs(y.Norm()));
+
+    // Intergrid transfers, prolongation is the scaled adjoint of the full weighting
+    // restriction, i.e. (P yc, x) = 2^d (yc, R x)
+    if(ndim > 2)
+    {
+        LocalStencil<T> C(type);
+        S.Coarsen(&C);
+
+        int nc = (ndim - 1) / 2;
+
+        success &= (C.GetGrid() == nc);
+
+        LocalVector<T> xc;
+        LocalVector<T> yc;
+
+        xc.Allocate("xc", C.GetM());
+        yc.Allocate("yc", C.GetM());
+
+        yc.SetRandomUniform(54321ULL, -1.0, 1.0);
+
+        S.Restriction(x, &xc);
+        S.Prolongation(yc, &y);
+
+        T scale = static_cast<T>(S.GetNDim() == 3 ? 8 : 4);
+
+        T ycRx = scale * yc.Dot(xc);
+        T Pycx = x.Dot(y);
+
+        success &= (std::abs(ycRx - Pycx) <= 1e-4 * std::abs(Pycx));
+
+        // Restriction of a constant is the same constant
+        x.Ones();
+        yc.Ones();
+        S.Restriction(x, &xc);
+        xc.AddScale(yc, -1.0);
+
+        success &= (std::abs(xc.Norm()) <= 1e-5);
+    }
+
+    // Variable coefficients, the operator has to stay symmetric
+    if(type == Diffusion3D)
+    {
+        LocalVector<T> k;
+        k.Allocate("k", 3 * nrow);
+        k.SetRandomUniform(4321ULL, 0.1, 10.0);
+
+        S.SetCoefficients(k);
+
+        y.SetRandomUniform(1234ULL, -1.0, 1.0);
+
+        S.Apply(x, &z);
+        T xAy = y.Dot(z);
+
+        S.Apply(y, &z);
+        T yAx = x.Dot(z);
+
+        success &= (std::abs(xAy - yAx) <= 1e-4 * std::abs(xAy));
+    }
+
     // Stop rocALUTION
     stop_rocalution();
+
+    return success;
 }
 
 #endif // TESTING_LOCAL_STENCIL_HPP
@@ -108,6 +108,41 @@ void testing_local_vector_bad_args(void)
         free_host(&vint);
     }
 
+    // MultiDot
+    {
+        const LocalVector<T>*  null_vec = nullptr;
+        const LocalVector<T>** null_vs  = nullptr;
+        T*                     null_T   = nullptr;
+        T                      res;
+        ASSERT_DEATH(vec.MultiDot(null_vs, 1, &res), ".*Assertion.*vs != (NULL|__null)*");
+        ASSERT_DEATH(vec.MultiDot(&null_vec, 1, null_T), ".*Assertion.*out != (NULL|__null)*");
+    }
+
+    // BlockDot
+    {
+        const LocalVector<T>*  pvec    = &vec;
+        const LocalVector<T>** null_vs = nullptr;
+        T*                     null_T  = nullptr;
+        T                      res;
+        ASSERT_DEATH(LocalVector<T>::BlockDot(1, null_vs, 1, &pvec, &res),
+                     ".*Assertion.*x != (NULL|__null)*");
+        ASSERT_DEATH(LocalVector<T>::BlockDot(1, &pvec, 1, null_vs, &res),
+                     ".*Assertion.*y != (NULL|__null)*");
+        ASSERT_DEATH(LocalVector<T>::BlockDot(1, &pvec, 1, &pvec, null_T),
+                     ".*Assertion.*out != (NULL|__null)*");
+    }
+
+    // MultiAddScale
+    {
+        const LocalVector<T>*  null_vec = nullptr;
+        const LocalVector<T>** null_vs  = nullptr;
+        T*                     null_T   = nullptr;
+        T                      alpha    = static_cast<T>(1);
+        ASSERT_DEATH(vec.MultiAddScale(null_vs, 1, &alpha), ".*Assertion.*vs != (NULL|__null)*");
+        ASSERT_DEATH(vec.MultiAddScale(&null_vec, 1, null_T),
+                     ".*Assertion.*alpha != (NULL|__null)*");
+    }
+
     // Stop rocALUTION
     stop_rocalution();
 }
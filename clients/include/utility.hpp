@@ -176,6 +176,64 @@ int gen_3d_laplacian(int ndim, int** row_ptr, int** col_ind, T** val)
     return n;
 }
 
+/* ============================================================================================ */
+/*! \brief  Generate 3D 7pt laplacian on unit cube in CSR format */
+template <typename T>
+int gen_3d_laplacian_7pt(int ndim, int** row_ptr, int** col_ind, T** val)
+{
+    if(ndim == 0)
+    {
+        return 0;
+    }
+
+    int n = ndim * ndim * ndim;
+
+    *row_ptr = new int[n + 1];
+    *col_ind = new int[7 * n];
+    *val     = new T[7 * n];
+
+    int nnz       = 0;
+    (*row_ptr)[0] = 0;
+
+    for(int iz = 0; iz < ndim; ++iz)
+    {
+        for(int iy = 0; iy < ndim; ++iy)
+        {
+            for(int ix = 0; ix < ndim; ++ix)
+            {
+                int row = iz * ndim * ndim + iy * ndim + ix;
+
+                // Neighbor offsets (x, y, z) in ascending column order
+                int nb[7][3] = {{0, 0, -1},
+                                {0, -1, 0},
+                                {-1, 0, 0},
+                                {0, 0, 0},
+                                {1, 0, 0},
+                                {0, 1, 0},
+                                {0, 0, 1}};
+
+                for(int k = 0; k < 7; ++k)
+                {
+                    int jx = ix + nb[k][0];
+                    int jy = iy + nb[k][1];
+                    int jz = iz + nb[k][2];
+
+                    if(jx > -1 && jx < ndim && jy > -1 && jy < ndim && jz > -1 && jz < ndim)
+                    {
+                        (*col_ind)[nnz] = jz * ndim * ndim + jy * ndim + jx;
+                        (*val)[nnz]     = (k == 3) ? static_cast<T>(6) : static_cast<T>(-1);
+                        ++nnz;
+                    }
+                }
+
+                (*row_ptr)[row + 1] = nnz;
+            }
+        }
+    }
+
+    return n;
+}
+
 /* ============================================================================================ */
 /*! \brief  Generate full rank identity matrix where the row order has been permuted */
 template <typename T>
@@ -0,0 +1,72 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_batched_solver.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+
+typedef std::tuple<int, int, std::string, std::string> batched_solver_tuple;
+
+int         batched_solver_size[]    = {4, 11};
+int         batched_solver_batch[]   = {1, 17};
+std::string batched_solver_solver[]  = {"CG", "BiCGStab", "GMRES"};
+std::string batched_solver_precond[] = {"None", "Jacobi", "ILU0"};
+
+class parameterized_batched_solver : public testing::TestWithParam<batched_solver_tuple>
+{
+protected:
+    parameterized_batched_solver() {}
+    virtual ~parameterized_batched_solver() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_batched_solver_arguments(batched_solver_tuple tup)
+{
+    Arguments arg;
+    arg.size    = std::get<0>(tup);
+    arg.index   = std::get<1>(tup);
+    arg.solver  = std::get<2>(tup);
+    arg.precond = std::get<3>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_batched_solver, batched_solver_float)
+{
+    Arguments arg = setup_batched_solver_arguments(GetParam());
+    ASSERT_EQ(testing_batched_solver<float>(arg), true);
+}
+
+TEST_P(parameterized_batched_solver, batched_solver_double)
+{
+    Arguments arg = setup_batched_solver_arguments(GetParam());
+    ASSERT_EQ(testing_batched_solver<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(batched_solver,
+                        parameterized_batched_solver,
+                        testing::Combine(testing::ValuesIn(batched_solver_size),
+                                         testing::ValuesIn(batched_solver_batch),
+                                         testing::ValuesIn(batched_solver_solver),
+                                         testing::ValuesIn(batched_solver_precond)));
@@ -25,6 +25,29 @@
 #include "utility.hpp"
 
 #include <gtest/gtest.h>
+
+typedef std::tuple<int, std::string> local_stencil_tuple;
+
+int         local_stencil_size[]    = {2, 7, 37};
+std::string local_stencil_stencil[] = {"Laplace2D", "Laplace3D", "Laplace3D27", "Diffusion3D"};
+
+class parameterized_local_stencil : public testing::TestWithParam<local_stencil_tuple>
+{
+protected:
+    parameterized_local_stencil() {}
+    virtual ~parameterized_local_stencil() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_local_stencil_arguments(local_stencil_tuple tup)
+{
+    Arguments arg;
+    arg.size        = std::get<0>(tup);
+    arg.matrix_type = std::get<1>(tup);
+    arg.alpha       = -2.0;
+    return arg;
+}
 /*
 typedef std::tuple<int, int, int, int, bool, int, bool> backend_tuple;
 
@@ -62,6 +85,23 @@ TEST(local_stencil_bad_args, local_stencil)
 {
     testing_local_stencil_bad_args<float>();
 }
+
+TEST_P(parameterized_local_stencil, local_stencil_float)
+{
+    Arguments arg = setup_local_stencil_arguments(GetParam());
+    ASSERT_EQ(testing_local_stencil<float>(arg), true);
+}
+
+TEST_P(parameterized_local_stencil, local_stencil_double)
+{
+    Arguments arg = setup_local_stencil_arguments(GetParam());
+    ASSERT_EQ(testing_local_stencil<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(local_stencil,
+                        parameterized_local_stencil,
+                        testing::Combine(testing::ValuesIn(local_stencil_size),
+                                         testing::ValuesIn(local_stencil_stencil)));
 /*
 TEST_P(parameterized_backend, backend)
 {
@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_merged_bicgstab.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+
+typedef std::tuple<int, std::string, unsigned int> merged_bicgstab_tuple;
+
+int          merged_bicgstab_size[]   = {7, 63};
+std::string  merged_bicgstab_precond[]
+    = {"None", "Chebyshev", "TNS", "Jacobi", "ILUT", "MCGS", "MCILU"};
+unsigned int merged_bicgstab_format[] = {1, 2, 4, 6};
+
+class parameterized_merged_bicgstab : public testing::TestWithParam<merged_bicgstab_tuple>
+{
+protected:
+    parameterized_merged_bicgstab() {}
+    virtual ~parameterized_merged_bicgstab() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_merged_bicgstab_arguments(merged_bicgstab_tuple tup)
+{
+    Arguments arg;
+    arg.size    = std::get<0>(tup);
+    arg.precond = std::get<1>(tup);
+    arg.format  = std::get<2>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_merged_bicgstab, merged_bicgstab_float)
+{
+    Arguments arg = setup_merged_bicgstab_arguments(GetParam());
+    ASSERT_EQ(testing_merged_bicgstab<float>(arg), true);
+}
+
+TEST_P(parameterized_merged_bicgstab, merged_bicgstab_double)
+{
+    Arguments arg = setup_merged_bicgstab_arguments(GetParam());
+    ASSERT_EQ(testing_merged_bicgstab<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(merged_bicgstab,
+                        parameterized_merged_bicgstab,
+                        testing::Combine(testing::ValuesIn(merged_bicgstab_size),
+                                         testing::ValuesIn(merged_bicgstab_precond),
+                                         testing::ValuesIn(merged_bicgstab_format)));
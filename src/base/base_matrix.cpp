@@ -424,6 +424,17 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    void BaseMatrix<ValueType>::MultiApply(int                                 num,
+                                           const BaseVector<ValueType>* const* in,
+                                           BaseVector<ValueType>**             out) const
+    {
+        for(int j = 0; j < num; ++j)
+        {
+            this->Apply(*in[j], out[j]);
+        }
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::Scale(ValueType alpha)
     {
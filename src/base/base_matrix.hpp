@@ -383,6 +383,10 @@ namespace rocalution
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const = 0;
+        /// Apply the matrix to num vectors, out[j] = this*in[j];
+        virtual void MultiApply(int                                 num,
+                                const BaseVector<ValueType>* const* in,
+                                BaseVector<ValueType>**             out) const;
 
         /// Delete all entries abs(a_ij) <= drop_off;
         /// the diagonal elements are never deleted
@@ -26,6 +26,8 @@
 #include "../utils/log.hpp"
 #include "backend_manager.hpp"
 #include "base_vector.hpp"
+#include "host/host_vector.hpp"
+#include "stencil_types.hpp"
 
 #include <complex>
 #include <stdlib.h>
@@ -76,6 +78,12 @@ namespace rocalution
         return this->ndim_;
     }
 
+    template <typename ValueType>
+    int BaseStencil<ValueType>::GetGrid(void) const
+    {
+        return this->size_;
+    }
+
     template <typename ValueType>
     void BaseStencil<ValueType>::set_backend(const Rocalution_Backend_Descriptor& local_backend)
     {
@@ -89,6 +97,55 @@ namespace rocalution
         this->size_ = size;
     }
 
+    template <typename ValueType>
+    void BaseStencil<ValueType>::SetCoefficients(const BaseVector<ValueType>& coeff)
+    {
+        LOG_INFO("BaseStencil<ValueType>::SetCoefficients(...)");
+        LOG_INFO("Stencil type=" << _stencil_type_names[this->GetStencilId()]);
+        this->Info();
+        LOG_INFO("The function is not available for this stencil");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void BaseStencil<ValueType>::Coarsen(BaseStencil<ValueType>* coarse) const
+    {
+        assert(coarse != NULL);
+        assert(coarse->GetStencilId() == this->GetStencilId());
+
+        coarse->SetGrid((this->size_ - 1) / 2);
+    }
+
+    template <typename ValueType>
+    void BaseStencil<ValueType>::ExtractInverseDiagonal(BaseVector<ValueType>* vec_inv_diag) const
+    {
+        LOG_INFO("BaseStencil<ValueType>::ExtractInverseDiagonal(...)");
+        LOG_INFO("Stencil type=" << _stencil_type_names[this->GetStencilId()]);
+        this->Info();
+        LOG_INFO("The function is not implemented (yet)! Check the backend?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void BaseStencil<ValueType>::Restriction(const BaseVector<ValueType>& fine,
+                                             BaseVector<ValueType>*       coarse) const
+    {
+        LOG_INFO("BaseStencil<ValueType>::Restriction(...)");
+        this->Info();
+        LOG_INFO("The function is not implemented (yet)! Check the backend?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void BaseStencil<ValueType>::Prolongation(const BaseVector<ValueType>& coarse,
+                                              BaseVector<ValueType>*       fine) const
+    {
+        LOG_INFO("BaseStencil<ValueType>::Prolongation(...)");
+        this->Info();
+        LOG_INFO("The function is not implemented (yet)! Check the backend?");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     HostStencil<ValueType>::HostStencil()
     {
@@ -99,6 +156,185 @@ namespace rocalution
     {
     }
 
+    // Coarse grid point c is located at fine grid point 2c+1. In each dimension, a fine
+    // grid point f is interpolated from at most two coarse grid points.
+    static inline int stencil_interp_weights(int f, int nc, int* c, double* w)
+    {
+        int count = 0;
+
+        if(f % 2 == 1)
+        {
+            c[count]   = (f - 1) / 2;
+            w[count++] = 1.0;
+        }
+        else
+        {
+            if(f / 2 - 1 >= 0)
+            {
+                c[count]   = f / 2 - 1;
+                w[count++] = 0.5;
+            }
+
+            if(f / 2 < nc)
+            {
+                c[count]   = f / 2;
+                w[count++] = 0.5;
+            }
+        }
+
+        return count;
+    }
+
+    template <typename ValueType>
+    void HostStencil<ValueType>::Restriction(const BaseVector<ValueType>& fine,
+                                             BaseVector<ValueType>*       coarse) const
+    {
+        assert(coarse != NULL);
+
+        int nc = (this->size_ - 1) / 2;
+
+        assert(fine.GetSize() == this->GetM());
+        assert(coarse->GetSize()
+               == static_cast<int64_t>((this->ndim_ == 3) ? nc : 1) * nc * nc);
+
+        const HostVector<ValueType>* cast_fine = dynamic_cast<const HostVector<ValueType>*>(&fine);
+        HostVector<ValueType>* cast_coarse     = dynamic_cast<HostVector<ValueType>*>(coarse);
+
+        assert(cast_fine != NULL);
+        assert(cast_coarse != NULL);
+
+        this->Restriction_(cast_fine->vec_, cast_coarse->vec_);
+    }
+
+    template <typename ValueType>
+    void HostStencil<ValueType>::Restriction_(const ValueType* fine, ValueType* coarse) const
+    {
+        assert(this->ndim_ == 2 || this->ndim_ == 3);
+
+        int n  = this->size_;
+        int nc = (n - 1) / 2;
+
+        // 2D grids are treated as a single plane in z
+        int ncz = (this->ndim_ == 3) ? nc : 1;
+        int rz  = (this->ndim_ == 3) ? 1 : 0;
+
+        _set_omp_backend_threads(this->local_backend_, this->GetM());
+
+        const ValueType quarter = static_cast<ValueType>(0.25);
+        const ValueType half    = static_cast<ValueType>(0.5);
+
+        // Every coarse grid point has all of its fine grid neighbors in the domain
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int line = 0; line < ncz * nc; ++line)
+        {
+            int fz = (rz == 1) ? 2 * (line / nc) + 1 : 0;
+            int fy = 2 * (line % nc) + 1;
+
+            ValueType* out = coarse + static_cast<int64_t>(line) * nc;
+
+            for(int cx = 0; cx < nc; ++cx)
+            {
+                int       fx  = 2 * cx + 1;
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(int oz = -rz; oz <= rz; ++oz)
+                {
+                    ValueType wz = (rz == 0) ? static_cast<ValueType>(1)
+                                             : ((oz == 0) ? half : quarter);
+
+                    for(int oy = -1; oy <= 1; ++oy)
+                    {
+                        ValueType wy = (oy == 0) ? half : quarter;
+
+                        const ValueType* f
+                            = fine + (static_cast<int64_t>(fz + oz) * n + fy + oy) * n + fx;
+
+                        sum += wz * wy * (quarter * f[-1] + half * f[0] + quarter * f[1]);
+                    }
+                }
+
+                out[cx] = sum;
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void HostStencil<ValueType>::Prolongation(const BaseVector<ValueType>& coarse,
+                                              BaseVector<ValueType>*       fine) const
+    {
+        assert(fine != NULL);
+        assert(this->ndim_ == 2 || this->ndim_ == 3);
+
+        int n  = this->size_;
+        int nc = (n - 1) / 2;
+        int nz = (this->ndim_ == 3) ? n : 1;
+
+        assert(fine->GetSize() == this->GetM());
+        assert(coarse.GetSize()
+               == static_cast<int64_t>((this->ndim_ == 3) ? nc : 1) * nc * nc);
+
+        const HostVector<ValueType>* cast_coarse
+            = dynamic_cast<const HostVector<ValueType>*>(&coarse);
+        HostVector<ValueType>* cast_fine = dynamic_cast<HostVector<ValueType>*>(fine);
+
+        assert(cast_coarse != NULL);
+        assert(cast_fine != NULL);
+
+        _set_omp_backend_threads(this->local_backend_, this->GetM());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int line = 0; line < nz * n; ++line)
+        {
+            int fz = line / n;
+            int fy = line % n;
+
+            int    cz[2], cy[2], cx[2];
+            double wz[2], wy[2], wx[2];
+
+            int nwz = 1;
+
+            if(this->ndim_ == 3)
+            {
+                nwz = stencil_interp_weights(fz, nc, cz, wz);
+            }
+            else
+            {
+                cz[0] = 0;
+                wz[0] = 1.0;
+            }
+
+            int nwy = stencil_interp_weights(fy, nc, cy, wy);
+
+            ValueType* out = cast_fine->vec_ + static_cast<int64_t>(line) * n;
+
+            for(int fx = 0; fx < n; ++fx)
+            {
+                int       nwx = stencil_interp_weights(fx, nc, cx, wx);
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(int i = 0; i < nwz; ++i)
+                {
+                    for(int j = 0; j < nwy; ++j)
+                    {
+                        const ValueType* c
+                            = cast_coarse->vec_ + (static_cast<int64_t>(cz[i]) * nc + cy[j]) * nc;
+
+                        for(int k = 0; k < nwx; ++k)
+                        {
+                            sum += static_cast<ValueType>(wz[i] * wy[j] * wx[k]) * c[cx[k]];
+                        }
+                    }
+                }
+
+                out[fx] = sum;
+            }
+        }
+    }
+
     template <typename ValueType>
     AcceleratorStencil<ValueType>::AcceleratorStencil()
     {
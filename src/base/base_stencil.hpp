@@ -39,6 +39,12 @@ namespace rocalution
     template <typename ValueType>
     class HostStencilLaplace2D;
     template <typename ValueType>
+    class HostStencilLaplace3D;
+    template <typename ValueType>
+    class HostStencilLaplace3D27;
+    template <typename ValueType>
+    class HostStencilDiffusion3D;
+    template <typename ValueType>
     class HIPAcceleratorStencil;
     template <typename ValueType>
     class HIPAcceleratorStencilLaplace2D;
@@ -57,6 +63,8 @@ namespace rocalution
         int GetN(void) const;
         /// Return the dimension of the stencil
         int GetNDim(void) const;
+        /// Return the grid size in each dimension
+        int GetGrid(void) const;
         /// Return the nnz per row
         virtual int64_t GetNnz(void) const = 0;
 
@@ -68,6 +76,20 @@ namespace rocalution
         virtual void set_backend(const Rocalution_Backend_Descriptor& local_backend);
         // Set the grid size
         virtual void SetGrid(int size);
+        /// Set the coefficient field of a variable coefficient stencil
+        virtual void SetCoefficients(const BaseVector<ValueType>& coeff);
+        /// Set up the stencil on the next coarser grid of size (size - 1) / 2
+        virtual void Coarsen(BaseStencil<ValueType>* coarse) const;
+
+        /// Extract the inverse of the diagonal
+        virtual void ExtractInverseDiagonal(BaseVector<ValueType>* vec_inv_diag) const;
+
+        /// Full weighting restriction of a fine grid vector to the next coarser grid
+        virtual void Restriction(const BaseVector<ValueType>& fine,
+                                 BaseVector<ValueType>*       coarse) const;
+        /// Linear interpolation of a coarse grid vector to this grid
+        virtual void Prolongation(const BaseVector<ValueType>& coarse,
+                                  BaseVector<ValueType>*       fine) const;
 
         /// Apply the stencil to vector, out = this*in;
         virtual void Apply(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const = 0;
@@ -97,6 +119,15 @@ namespace rocalution
     public:
         HostStencil();
         virtual ~HostStencil();
+
+        virtual void Restriction(const BaseVector<ValueType>& fine,
+                                 BaseVector<ValueType>*       coarse) const;
+        virtual void Prolongation(const BaseVector<ValueType>& coarse,
+                                  BaseVector<ValueType>*       fine) const;
+
+    protected:
+        /// Full weighting restriction of a fine grid field to the next coarser grid
+        void Restriction_(const ValueType* fine, ValueType* coarse) const;
     };
 
     template <typename ValueType>
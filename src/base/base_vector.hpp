@@ -124,6 +124,10 @@ namespace rocalution
 
         /// Perform vector update of type this = this + alpha*x
         virtual void AddScale(const BaseVector<ValueType>& x, ValueType alpha) = 0;
+        /// Perform vector update of type this = this + sum_j alpha[j]*x[j]
+        virtual void
+            MultiAddScale(const BaseVector<ValueType>* const* x, int k, const ValueType* alpha)
+            = 0;
         /// Perform vector update of type this = alpha*this + x
         virtual void ScaleAdd(ValueType alpha, const BaseVector<ValueType>& x) = 0;
         /// Perform vector update of type this = alpha*this + x*beta
@@ -151,6 +155,9 @@ namespace rocalution
         virtual ValueType Dot(const BaseVector<ValueType>& x) const = 0;
         /// Compute non-conjugated dot (scalar) product, return this^T y
         virtual ValueType DotNonConj(const BaseVector<ValueType>& x) const = 0;
+        /// Compute k dot (scalar) products, out[j] = x[j]^T this
+        virtual void MultiDot(const BaseVector<ValueType>* const* x, int k, ValueType* out) const
+            = 0;
         /// Compute L2 norm of the vector, return =  srqt(this^T this)
         virtual ValueType Norm(void) const = 0;
         /// Reduce vector
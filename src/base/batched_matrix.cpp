@@ -0,0 +1,331 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "batched_matrix.hpp"
+#include "../utils/allocate_free.hpp"
+#include "../utils/def.hpp"
+#include "../utils/log.hpp"
+#include "batched_vector.hpp"
+#include "local_matrix.hpp"
+#include "matrix_formats.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    BatchedMatrix<ValueType>::BatchedMatrix()
+    {
+        log_debug(this, "BatchedMatrix::BatchedMatrix()");
+
+        this->object_name_ = "";
+
+        this->batch_count_ = 0;
+        this->max_nrow_    = 0;
+
+        this->row_begin_  = NULL;
+        this->nnz_begin_  = NULL;
+        this->row_offset_ = NULL;
+        this->col_        = NULL;
+        this->val_        = NULL;
+    }
+
+    template <typename ValueType>
+    BatchedMatrix<ValueType>::~BatchedMatrix()
+    {
+        log_debug(this, "BatchedMatrix::~BatchedMatrix()");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void BatchedMatrix<ValueType>::Info(void) const
+    {
+        LOG_INFO("BatchedMatrix"
+                 << " name=" << this->object_name_ << ";"
+                 << " batch=" << this->batch_count_ << ";"
+                 << " rows=" << this->GetTotalM() << ";"
+                 << " nnz=" << this->GetTotalNnz() << ";"
+                 << " max rows=" << this->max_nrow_ << ";"
+                 << " prec=" << 8 * sizeof(ValueType) << "bit;"
+                 << " current=" << _rocalution_host_name[0]);
+    }
+
+    template <typename ValueType>
+    void BatchedMatrix<ValueType>::Clear(void)
+    {
+        log_debug(this, "BatchedMatrix::Clear()");
+
+        free_host(&this->row_begin_);
+        free_host(&this->nnz_begin_);
+        free_host(&this->row_offset_);
+        free_host(&this->col_);
+        free_host(&this->val_);
+
+        this->batch_count_ = 0;
+        this->max_nrow_    = 0;
+    }
+
+    template <typename ValueType>
+    void BatchedMatrix<ValueType>::AllocateCSR(const std::string& name,
+                                               int                batch_count,
+                                               const int*         nrow,
+                                               const int64_t*     nnz)
+    {
+        log_debug(this, "BatchedMatrix::AllocateCSR()", name, batch_count, nrow, nnz);
+
+        assert(batch_count >= 0);
+
+        this->Clear();
+
+        this->object_name_ = name;
+
+        if(batch_count == 0)
+        {
+            return;
+        }
+
+        assert(nrow != NULL);
+        assert(nnz != NULL);
+
+        this->batch_count_ = batch_count;
+
+        allocate_host(batch_count + 1, &this->row_begin_);
+        allocate_host(batch_count + 1, &this->nnz_begin_);
+
+        this->row_begin_[0] = 0;
+        this->nnz_begin_[0] = 0;
+
+        for(int i = 0; i < batch_count; ++i)
+        {
+            assert(nrow[i] >= 0);
+            assert(nnz[i] >= 0);
+
+            this->row_begin_[i + 1] = this->row_begin_[i] + nrow[i];
+            this->nnz_begin_[i + 1] = this->nnz_begin_[i] + nnz[i];
+
+            this->max_nrow_ = std::max(this->max_nrow_, nrow[i]);
+        }
+
+        int64_t nrow_total = this->row_begin_[batch_count];
+        int64_t nnz_total  = this->nnz_begin_[batch_count];
+
+        allocate_host(nrow_total + batch_count, &this->row_offset_);
+        allocate_host(nnz_total, &this->col_);
+        allocate_host(nnz_total, &this->val_);
+
+        set_to_zero_host(nrow_total + batch_count, this->row_offset_);
+        set_to_zero_host(nnz_total, this->col_);
+        set_to_zero_host(nnz_total, this->val_);
+    }
+
+    template <typename ValueType>
+    void BatchedMatrix<ValueType>::CopyFromCSR(int              index,
+                                               const PtrType*   row_offset,
+                                               const int*       col,
+                                               const ValueType* val)
+    {
+        log_debug(this, "BatchedMatrix::CopyFromCSR()", index, row_offset, col, val);
+
+        assert(index >= 0 && index < this->batch_count_);
+        assert(row_offset != NULL);
+
+        int64_t nrow = this->GetM(index);
+        int64_t nnz  = this->GetNnz(index);
+
+        assert(row_offset[nrow] - row_offset[0] == nnz);
+
+        // Row offsets are stored relative to the first non-zero of the matrix
+        PtrType* ptr = this->row_offset_ + this->row_begin_[index] + index;
+
+        for(int64_t i = 0; i < nrow + 1; ++i)
+        {
+            ptr[i] = row_offset[i] - row_offset[0];
+        }
+
+        if(nnz > 0)
+        {
+            assert(col != NULL);
+            assert(val != NULL);
+
+            copy_h2h(nnz, col + row_offset[0], this->col_ + this->nnz_begin_[index]);
+            copy_h2h(nnz, val + row_offset[0], this->val_ + this->nnz_begin_[index]);
+        }
+    }
+
+    template <typename ValueType>
+    void BatchedMatrix<ValueType>::CopyToCSR(int        index,
+                                             PtrType*   row_offset,
+                                             int*       col,
+                                             ValueType* val) const
+    {
+        log_debug(this, "BatchedMatrix::CopyToCSR()", index, row_offset, col, val);
+
+        assert(index >= 0 && index < this->batch_count_);
+        assert(row_offset != NULL);
+
+        int64_t nnz = this->GetNnz(index);
+
+        copy_h2h(this->GetM(index) + 1,
+                 this->row_offset_ + this->row_begin_[index] + index,
+                 row_offset);
+
+        if(nnz > 0)
+        {
+            assert(col != NULL);
+            assert(val != NULL);
+
+            copy_h2h(nnz, this->col_ + this->nnz_begin_[index], col);
+            copy_h2h(nnz, this->val_ + this->nnz_begin_[index], val);
+        }
+    }
+
+    template <typename ValueType>
+    void BatchedMatrix<ValueType>::CopyFrom(int                                  batch_count,
+                                            const LocalMatrix<ValueType>* const* mat)
+    {
+        log_debug(this, "BatchedMatrix::CopyFrom()", batch_count, mat);
+
+        assert(batch_count >= 0);
+        assert(batch_count == 0 || mat != NULL);
+
+        std::vector<int>     nrow(batch_count);
+        std::vector<int64_t> nnz(batch_count);
+
+        for(int i = 0; i < batch_count; ++i)
+        {
+            assert(mat[i] != NULL);
+            assert(mat[i]->GetFormat() == CSR);
+            assert(mat[i]->GetM() == mat[i]->GetN());
+
+            nrow[i] = static_cast<int>(mat[i]->GetM());
+            nnz[i]  = mat[i]->GetNnz();
+        }
+
+        this->AllocateCSR(this->object_name_, batch_count, nrow.data(), nnz.data());
+
+        // Copy directly into the batch storage, offsets are local to each matrix
+        for(int i = 0; i < batch_count; ++i)
+        {
+            mat[i]->CopyToCSR(this->row_offset_ + this->row_begin_[i] + i,
+                              this->col_ + this->nnz_begin_[i],
+                              this->val_ + this->nnz_begin_[i]);
+        }
+    }
+
+    template <typename ValueType>
+    int BatchedMatrix<ValueType>::GetBatchCount(void) const
+    {
+        return this->batch_count_;
+    }
+
+    template <typename ValueType>
+    int BatchedMatrix<ValueType>::GetM(int index) const
+    {
+        assert(index >= 0 && index < this->batch_count_);
+
+        return static_cast<int>(this->row_begin_[index + 1] - this->row_begin_[index]);
+    }
+
+    template <typename ValueType>
+    int64_t BatchedMatrix<ValueType>::GetNnz(int index) const
+    {
+        assert(index >= 0 && index < this->batch_count_);
+
+        return this->nnz_begin_[index + 1] - this->nnz_begin_[index];
+    }
+
+    template <typename ValueType>
+    int BatchedMatrix<ValueType>::GetMaxM(void) const
+    {
+        return this->max_nrow_;
+    }
+
+    template <typename ValueType>
+    int64_t BatchedMatrix<ValueType>::GetTotalM(void) const
+    {
+        return (this->batch_count_ > 0) ? this->row_begin_[this->batch_count_] : 0;
+    }
+
+    template <typename ValueType>
+    int64_t BatchedMatrix<ValueType>::GetTotalNnz(void) const
+    {
+        return (this->batch_count_ > 0) ? this->nnz_begin_[this->batch_count_] : 0;
+    }
+
+    template <typename ValueType>
+    void BatchedMatrix<ValueType>::Apply(const BatchedVector<ValueType>& in,
+                                         BatchedVector<ValueType>*       out) const
+    {
+        log_debug(this, "BatchedMatrix::Apply()", (const void*&)in, out);
+
+        assert(out != NULL);
+        assert(in.GetBatchCount() == this->batch_count_);
+        assert(out->GetBatchCount() == this->batch_count_);
+        assert(in.GetTotalSize() == this->GetTotalM());
+        assert(out->GetTotalSize() == this->GetTotalM());
+
+        _set_omp_backend_threads(*_get_backend_descriptor(), this->GetTotalNnz());
+
+        // One matrix per thread at a time
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for(int i = 0; i < this->batch_count_; ++i)
+        {
+            int              nrow = this->GetM(i);
+            const PtrType*   ptr  = this->row_offset_ + this->row_begin_[i] + i;
+            const int*       col  = this->col_ + this->nnz_begin_[i];
+            const ValueType* val  = this->val_ + this->nnz_begin_[i];
+            const ValueType* x    = in.vec_ + in.offset_[i];
+            ValueType*       y    = out->vec_ + out->offset_[i];
+
+            for(int row = 0; row < nrow; ++row)
+            {
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(PtrType j = ptr[row]; j < ptr[row + 1]; ++j)
+                {
+                    sum += val[j] * x[col[j]];
+                }
+
+                y[row] = sum;
+            }
+        }
+    }
+
+    template class BatchedMatrix<double>;
+    template class BatchedMatrix<float>;
+#ifdef SUPPORT_COMPLEX
+    template class BatchedMatrix<std::complex<double>>;
+    template class BatchedMatrix<std::complex<float>>;
+#endif
+
+} // namespace rocalution
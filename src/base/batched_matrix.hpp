@@ -0,0 +1,174 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_BATCHED_MATRIX_HPP_
+#define ROCALUTION_BATCHED_MATRIX_HPP_
+
+#include "base_rocalution.hpp"
+#include "rocalution/export.hpp"
+#include "rocalution/utils/types.hpp"
+
+#include <string>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    class LocalMatrix;
+    template <typename ValueType>
+    class BatchedVector;
+    template <typename ValueType>
+    class BatchedIterativeSolver;
+
+    /** \ingroup op_vec_module
+  * \class BatchedMatrix
+  * \brief Container for many small independent sparse matrices
+  * \details
+  * A BatchedMatrix holds a batch of independent square CSR matrices in a single
+  * contiguous host allocation. It is intended for applications that produce a large
+  * number of small sparse systems (e.g. per cell or per reaction problems), where
+  * creating one LocalMatrix per system and processing them one after another pays the
+  * backend overhead for every system and leaves cores idle. Operations on a
+  * BatchedMatrix process each matrix on a single thread, while many matrices are
+  * processed concurrently across the available OpenMP threads.
+  *
+  * Each matrix has its own size and number of non-zeros. Row offsets and column
+  * indices are local to each matrix, and the column indices of each row have to be
+  * sorted in ascending order.
+  *
+  * \note
+  * A BatchedMatrix always resides on the host.
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> and
+  *                     std::complex<double>
+  */
+    template <typename ValueType>
+    class BatchedMatrix : public RocalutionObj
+    {
+    public:
+        ROCALUTION_EXPORT
+        BatchedMatrix();
+        ROCALUTION_EXPORT
+        virtual ~BatchedMatrix();
+
+        /** \brief Shows simple info about the object */
+        ROCALUTION_EXPORT
+        void Info(void) const;
+
+        /** \brief Clear (free) all data of the object */
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Allocate a batch of CSR matrices
+      * \details
+      * Allocates \p batch_count square CSR matrices, where the i-th matrix has
+      * \p nrow[i] rows and columns and \p nnz[i] non-zero entries.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   std::vector<int>     nrow(1000, 64);
+      *   std::vector<int64_t> nnz(1000, 288);
+      *
+      *   BatchedMatrix<ValueType> mat;
+      *   mat.AllocateCSR("my batch", 1000, nrow.data(), nnz.data());
+      * \endcode
+      */
+        ROCALUTION_EXPORT
+        void AllocateCSR(const std::string& name,
+                         int                batch_count,
+                         const int*         nrow,
+                         const int64_t*     nnz);
+
+        /** \brief Copy the CSR data of a single matrix of the batch from host arrays */
+        ROCALUTION_EXPORT
+        void CopyFromCSR(int              index,
+                         const PtrType*   row_offset,
+                         const int*       col,
+                         const ValueType* val);
+
+        /** \brief Copy the CSR data of a single matrix of the batch to host arrays */
+        ROCALUTION_EXPORT
+        void CopyToCSR(int index, PtrType* row_offset, int* col, ValueType* val) const;
+
+        /** \brief Allocate and fill the batch from a set of square CSR LocalMatrix objects */
+        ROCALUTION_EXPORT
+        void CopyFrom(int batch_count, const LocalMatrix<ValueType>* const* mat);
+
+        /** \brief Return the number of matrices in the batch */
+        ROCALUTION_EXPORT
+        int GetBatchCount(void) const;
+
+        /** \brief Return the number of rows of the matrix \p index */
+        ROCALUTION_EXPORT
+        int GetM(int index) const;
+
+        /** \brief Return the number of non-zeros of the matrix \p index */
+        ROCALUTION_EXPORT
+        int64_t GetNnz(int index) const;
+
+        /** \brief Return the largest number of rows of all matrices in the batch */
+        ROCALUTION_EXPORT
+        int GetMaxM(void) const;
+
+        /** \brief Return the total number of rows of all matrices in the batch */
+        ROCALUTION_EXPORT
+        int64_t GetTotalM(void) const;
+
+        /** \brief Return the total number of non-zeros of all matrices in the batch */
+        ROCALUTION_EXPORT
+        int64_t GetTotalNnz(void) const;
+
+        /** \brief Perform out[i] = A[i] * in[i] for all matrices of the batch */
+        ROCALUTION_EXPORT
+        void Apply(const BatchedVector<ValueType>& in, BatchedVector<ValueType>* out) const;
+
+    protected:
+        /** \private */
+        std::string object_name_;
+
+        /** \private */
+        int batch_count_;
+        /** \private */
+        int max_nrow_;
+
+        // Offset of the first row and the first non-zero of each matrix
+        /** \private */
+        int64_t* row_begin_;
+        /** \private */
+        int64_t* nnz_begin_;
+
+        // Local CSR structure, the row offsets of matrix i start at row_begin_[i] + i
+        /** \private */
+        PtrType* row_offset_;
+        /** \private */
+        int* col_;
+        /** \private */
+        ValueType* val_;
+
+        friend class BatchedVector<ValueType>;
+        friend class BatchedIterativeSolver<ValueType>;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_BATCHED_MATRIX_HPP_
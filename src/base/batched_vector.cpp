@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "batched_vector.hpp"
+#include "../utils/allocate_free.hpp"
+#include "../utils/def.hpp"
+#include "../utils/log.hpp"
+#include "batched_matrix.hpp"
+
+#include <complex>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    BatchedVector<ValueType>::BatchedVector()
+    {
+        log_debug(this, "BatchedVector::BatchedVector()");
+
+        this->object_name_ = "";
+
+        this->batch_count_ = 0;
+
+        this->offset_ = NULL;
+        this->vec_    = NULL;
+    }
+
+    template <typename ValueType>
+    BatchedVector<ValueType>::~BatchedVector()
+    {
+        log_debug(this, "BatchedVector::~BatchedVector()");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void BatchedVector<ValueType>::Info(void) const
+    {
+        LOG_INFO("BatchedVector"
+                 << " name=" << this->object_name_ << ";"
+                 << " batch=" << this->batch_count_ << ";"
+                 << " size=" << this->GetTotalSize() << ";"
+                 << " prec=" << 8 * sizeof(ValueType) << "bit;"
+                 << " current=" << _rocalution_host_name[0]);
+    }
+
+    template <typename ValueType>
+    void BatchedVector<ValueType>::Clear(void)
+    {
+        log_debug(this, "BatchedVector::Clear()");
+
+        free_host(&this->offset_);
+        free_host(&this->vec_);
+
+        this->batch_count_ = 0;
+    }
+
+    template <typename ValueType>
+    void BatchedVector<ValueType>::Allocate(const std::string& name,
+                                            int                batch_count,
+                                            const int*         size)
+    {
+        log_debug(this, "BatchedVector::Allocate()", name, batch_count, size);
+
+        assert(batch_count >= 0);
+
+        this->Clear();
+
+        this->object_name_ = name;
+
+        if(batch_count == 0)
+        {
+            return;
+        }
+
+        assert(size != NULL);
+
+        this->batch_count_ = batch_count;
+
+        allocate_host(batch_count + 1, &this->offset_);
+
+        this->offset_[0] = 0;
+
+        for(int i = 0; i < batch_count; ++i)
+        {
+            assert(size[i] >= 0);
+
+            this->offset_[i + 1] = this->offset_[i] + size[i];
+        }
+
+        allocate_host(this->offset_[batch_count], &this->vec_);
+        set_to_zero_host(this->offset_[batch_count], this->vec_);
+    }
+
+    template <typename ValueType>
+    void BatchedVector<ValueType>::Allocate(const std::string&              name,
+                                            const BatchedMatrix<ValueType>& mat)
+    {
+        log_debug(this, "BatchedVector::Allocate()", name, (const void*&)mat);
+
+        this->Clear();
+
+        this->object_name_ = name;
+
+        if(mat.batch_count_ == 0)
+        {
+            return;
+        }
+
+        this->batch_count_ = mat.batch_count_;
+
+        allocate_host(this->batch_count_ + 1, &this->offset_);
+        copy_h2h(this->batch_count_ + 1, mat.row_begin_, this->offset_);
+
+        allocate_host(this->offset_[this->batch_count_], &this->vec_);
+        set_to_zero_host(this->offset_[this->batch_count_], this->vec_);
+    }
+
+    template <typename ValueType>
+    void BatchedVector<ValueType>::Zeros(void)
+    {
+        log_debug(this, "BatchedVector::Zeros()");
+
+        set_to_zero_host(this->GetTotalSize(), this->vec_);
+    }
+
+    template <typename ValueType>
+    void BatchedVector<ValueType>::Ones(void)
+    {
+        log_debug(this, "BatchedVector::Ones()");
+
+        this->SetValues(static_cast<ValueType>(1));
+    }
+
+    template <typename ValueType>
+    void BatchedVector<ValueType>::SetValues(ValueType val)
+    {
+        log_debug(this, "BatchedVector::SetValues()", val);
+
+        int64_t size = this->GetTotalSize();
+
+        _set_omp_backend_threads(*_get_backend_descriptor(), size);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int64_t i = 0; i < size; ++i)
+        {
+            this->vec_[i] = val;
+        }
+    }
+
+    template <typename ValueType>
+    void BatchedVector<ValueType>::CopyFrom(const BatchedVector<ValueType>& src)
+    {
+        log_debug(this, "BatchedVector::CopyFrom()", (const void*&)src);
+
+        assert(this != &src);
+        assert(this->batch_count_ == src.batch_count_);
+        assert(this->GetTotalSize() == src.GetTotalSize());
+
+        copy_h2h(this->GetTotalSize(), src.vec_, this->vec_);
+    }
+
+    template <typename ValueType>
+    void BatchedVector<ValueType>::CopyFromData(int index, const ValueType* data)
+    {
+        log_debug(this, "BatchedVector::CopyFromData()", index, data);
+
+        assert(index >= 0 && index < this->batch_count_);
+        assert(data != NULL);
+
+        copy_h2h(this->GetSize(index), data, this->vec_ + this->offset_[index]);
+    }
+
+    template <typename ValueType>
+    void BatchedVector<ValueType>::CopyToData(int index, ValueType* data) const
+    {
+        log_debug(this, "BatchedVector::CopyToData()", index, data);
+
+        assert(index >= 0 && index < this->batch_count_);
+        assert(data != NULL);
+
+        copy_h2h(this->GetSize(index), this->vec_ + this->offset_[index], data);
+    }
+
+    template <typename ValueType>
+    int BatchedVector<ValueType>::GetBatchCount(void) const
+    {
+        return this->batch_count_;
+    }
+
+    template <typename ValueType>
+    int BatchedVector<ValueType>::GetSize(int index) const
+    {
+        assert(index >= 0 && index < this->batch_count_);
+
+        return static_cast<int>(this->offset_[index + 1] - this->offset_[index]);
+    }
+
+    template <typename ValueType>
+    int64_t BatchedVector<ValueType>::GetTotalSize(void) const
+    {
+        return (this->batch_count_ > 0) ? this->offset_[this->batch_count_] : 0;
+    }
+
+    template class BatchedVector<double>;
+    template class BatchedVector<float>;
+#ifdef SUPPORT_COMPLEX
+    template class BatchedVector<std::complex<double>>;
+    template class BatchedVector<std::complex<float>>;
+#endif
+
+} // namespace rocalution
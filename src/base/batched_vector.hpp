@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_BATCHED_VECTOR_HPP_
+#define ROCALUTION_BATCHED_VECTOR_HPP_
+
+#include "base_rocalution.hpp"
+#include "rocalution/export.hpp"
+
+#include <string>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    class BatchedMatrix;
+    template <typename ValueType>
+    class BatchedIterativeSolver;
+
+    /** \ingroup op_vec_module
+  * \class BatchedVector
+  * \brief Container for the vectors of a batch of independent systems
+  * \details
+  * A BatchedVector holds one vector per system of a BatchedMatrix in a single
+  * contiguous host allocation. The i-th vector has \p size[i] entries.
+  *
+  * \note
+  * A BatchedVector always resides on the host.
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> and
+  *                     std::complex<double>
+  */
+    template <typename ValueType>
+    class BatchedVector : public RocalutionObj
+    {
+    public:
+        ROCALUTION_EXPORT
+        BatchedVector();
+        ROCALUTION_EXPORT
+        virtual ~BatchedVector();
+
+        /** \brief Shows simple info about the object */
+        ROCALUTION_EXPORT
+        void Info(void) const;
+
+        /** \brief Clear (free) all data of the object */
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Allocate \p batch_count vectors, where the i-th vector has \p size[i]
+      * entries
+      */
+        ROCALUTION_EXPORT
+        void Allocate(const std::string& name, int batch_count, const int* size);
+
+        /** \brief Allocate one vector per matrix of \p mat, matching its sizes */
+        ROCALUTION_EXPORT
+        void Allocate(const std::string& name, const BatchedMatrix<ValueType>& mat);
+
+        /** \brief Set all values of all vectors to zero */
+        ROCALUTION_EXPORT
+        void Zeros(void);
+        /** \brief Set all values of all vectors to one */
+        ROCALUTION_EXPORT
+        void Ones(void);
+        /** \brief Set all values of all vectors to \p val */
+        ROCALUTION_EXPORT
+        void SetValues(ValueType val);
+
+        /** \brief Copy all vectors from another BatchedVector with the same sizes */
+        ROCALUTION_EXPORT
+        void CopyFrom(const BatchedVector<ValueType>& src);
+
+        /** \brief Copy the vector \p index from a host array */
+        ROCALUTION_EXPORT
+        void CopyFromData(int index, const ValueType* data);
+        /** \brief Copy the vector \p index to a host array */
+        ROCALUTION_EXPORT
+        void CopyToData(int index, ValueType* data) const;
+
+        /** \brief Return the number of vectors in the batch */
+        ROCALUTION_EXPORT
+        int GetBatchCount(void) const;
+
+        /** \brief Return the size of the vector \p index */
+        ROCALUTION_EXPORT
+        int GetSize(int index) const;
+
+        /** \brief Return the total number of entries of all vectors in the batch */
+        ROCALUTION_EXPORT
+        int64_t GetTotalSize(void) const;
+
+    protected:
+        /** \private */
+        std::string object_name_;
+
+        /** \private */
+        int batch_count_;
+
+        // Offset of the first entry of each vector
+        /** \private */
+        int64_t* offset_;
+
+        /** \private */
+        ValueType* vec_;
+
+        friend class BatchedMatrix<ValueType>;
+        friend class BatchedIterativeSolver<ValueType>;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_BATCHED_VECTOR_HPP_
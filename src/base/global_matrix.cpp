@@ -29,9 +29,11 @@
 #include "base_matrix.hpp"
 #include "base_vector.hpp"
 #include "global_vector.hpp"
+#include "host/host_io.hpp"
 #include "local_matrix.hpp"
 #include "local_vector.hpp"
 #include "matrix_formats.hpp"
+#include "rocalution/version.hpp"
 
 #ifdef SUPPORT_MULTINODE
 #include "../utils/communicator.hpp"
@@ -39,11 +41,33 @@
 
 #include <algorithm>
 #include <complex>
+#include <cstring>
 #include <limits>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 namespace rocalution
 {
+    // Type that is used for the reduced precision halo exchange
+    template <typename ValueType>
+    struct reduced_halo_type
+    {
+        typedef ValueType type;
+    };
+
+    template <>
+    struct reduced_halo_type<double>
+    {
+        typedef float type;
+    };
+
+    template <>
+    struct reduced_halo_type<std::complex<double>>
+    {
+        typedef std::complex<float> type;
+    };
+
     template <typename ValueType>
     GlobalMatrix<ValueType>::GlobalMatrix()
     {
@@ -63,6 +87,10 @@ namespace rocalution
 
         this->recv_boundary_ = NULL;
         this->send_boundary_ = NULL;
+
+        this->reduced_halo_          = false;
+        this->recv_boundary_reduced_ = NULL;
+        this->send_boundary_reduced_ = NULL;
     }
 
     template <typename ValueType>
@@ -74,12 +102,17 @@ namespace rocalution
 
         this->object_name_ = "";
 
-        this->pm_ = &pm;
+        this->pm_      = &pm;
+        this->pm_self_ = NULL;
 
         this->nnz_ = 0;
 
         this->recv_boundary_ = NULL;
         this->send_boundary_ = NULL;
+
+        this->reduced_halo_          = false;
+        this->recv_boundary_reduced_ = NULL;
+        this->send_boundary_reduced_ = NULL;
     }
 
     template <typename ValueType>
@@ -115,6 +148,8 @@ namespace rocalution
 
         free_pinned(&this->recv_boundary_);
         free_pinned(&this->send_boundary_);
+
+        this->FreeReducedHalo_();
     }
 
     template <typename ValueType>
@@ -226,6 +261,19 @@ namespace rocalution
         this->InitCommPattern_();
     }
 
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::SetReducedPrecisionHalo(bool reduced)
+    {
+        log_debug(this, "GlobalMatrix::SetReducedPrecisionHalo()", reduced);
+
+        this->reduced_halo_ = reduced;
+
+        if(reduced == false)
+        {
+            this->FreeReducedHalo_();
+        }
+    }
+
     template <typename ValueType>
     void GlobalMatrix<ValueType>::AllocateCSR(const std::string& name,
                                               int64_t            local_nnz,
@@ -836,9 +884,24 @@ namespace rocalution
     template <typename ValueType>
     void GlobalMatrix<ValueType>::CloneFrom(const GlobalMatrix<ValueType>& src)
     {
-        log_debug(this, "GlobalMatrix::CloneFrom()");
+        log_debug(this, "GlobalMatrix::CloneFrom()", (const void*&)src);
 
-        FATAL_ERROR(__FILE__, __LINE__);
+        assert(this != &src);
+
+        this->Clear();
+
+        // The clone shares the parallel manager of src
+        this->CloneBackend(src);
+
+        this->matrix_interior_.CloneFrom(src.matrix_interior_);
+        this->matrix_ghost_.CloneFrom(src.matrix_ghost_);
+
+        this->object_name_ = "Clone from " + src.object_name_;
+
+        if(this->pm_ != NULL)
+        {
+            this->InitCommPattern_();
+        }
     }
 
     template <typename ValueType>
@@ -921,43 +984,25 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void GlobalMatrix<ValueType>::Apply(const GlobalVector<ValueType>& in,
-                                        GlobalVector<ValueType>*       out) const
+    void GlobalMatrix<ValueType>::StartHaloExchange_(const LocalVector<ValueType>& in,
+                                                     ValueType**                   send_buffer) const
     {
-        log_debug(this, "GlobalMatrix::Apply()", (const void*&)in, out);
-
-        assert(out != NULL);
-        assert(&in != out);
-
-        // Calling global routine with single process
-        if(this->pm_ == NULL)
-        {
-            // no PM, do interior apply
-            this->matrix_interior_.Apply(in.vector_interior_, &out->vector_interior_);
-
-            return;
-        }
+        log_debug(this, "GlobalMatrix::StartHaloExchange_()", (const void*&)in, send_buffer);
 
-        assert(this->GetM() == out->GetSize());
-        assert(this->GetN() == in.GetSize());
-        assert(this->is_host_() == in.is_host_());
-        assert(this->is_host_() == out->is_host_());
-        assert(this->is_host_() == this->halo_.is_host_());
-        assert(this->is_host_() == this->recv_buffer_.is_host_());
-        assert(this->is_host_() == this->send_buffer_.is_host_());
+        assert(send_buffer != NULL);
+        assert(*send_buffer == NULL);
 
         // Prepare send buffer
-        in.vector_interior_.GetIndexValues(this->halo_, &this->send_buffer_);
+        in.GetIndexValues(this->halo_, &this->send_buffer_);
 
         // Change to compute mode ghost
         _rocalution_compute_ghost();
 
         // Make send buffer available for communication
-        ValueType* send_buffer = NULL;
         if(this->is_host_() == true)
         {
             // On host, we can directly use the host pointer
-            this->send_buffer_.LeaveDataPtr(&send_buffer);
+            this->send_buffer_.LeaveDataPtr(send_buffer);
         }
         else
         {
@@ -966,30 +1011,85 @@ namespace rocalution
             this->send_buffer_.GetContinuousValues(
                 0, this->pm_->GetNumSenders(), this->send_boundary_);
 
-            send_buffer = this->send_boundary_;
+            *send_buffer = this->send_boundary_;
         }
 
-        // Change to compute mode interior
-        _rocalution_compute_interior();
-
-        // Interior
-        this->matrix_interior_.Apply(in.vector_interior_, &out->vector_interior_);
-
         // Synchronize compute mode ghost
         _rocalution_sync_ghost();
 
-        // Initiate communication
-        this->pm_->CommunicateAsync_(send_buffer, this->recv_boundary_);
+        typedef typename reduced_halo_type<ValueType>::type HaloType;
+
+        if(this->reduced_halo_ == true && sizeof(HaloType) < sizeof(ValueType))
+        {
+            int nsend = this->pm_->GetNumSenders();
+            int nrecv = this->pm_->GetNumReceivers();
+
+            HaloType* send_reduced = static_cast<HaloType*>(this->send_boundary_reduced_);
+            HaloType* recv_reduced = static_cast<HaloType*>(this->recv_boundary_reduced_);
+
+            if(send_reduced == NULL)
+            {
+                allocate_pinned(nsend, &send_reduced);
+                this->send_boundary_reduced_ = send_reduced;
+            }
+
+            if(recv_reduced == NULL)
+            {
+                allocate_pinned(nrecv, &recv_reduced);
+                this->recv_boundary_reduced_ = recv_reduced;
+            }
+
+            // Round the boundary values to reduced precision
+            for(int i = 0; i < nsend; ++i)
+            {
+                send_reduced[i] = static_cast<HaloType>((*send_buffer)[i]);
+            }
+
+            // Initiate reduced precision communication
+            this->pm_->CommunicateAsync_(send_reduced, recv_reduced);
+
+            return;
+        }
+
+        // Initiate communication, such that the messages are in flight while the
+        // caller computes the interior part
+        this->pm_->CommunicateAsync_(*send_buffer, this->recv_boundary_);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::FinishHaloExchange_(ValueType** send_buffer) const
+    {
+        log_debug(this, "GlobalMatrix::FinishHaloExchange_()", send_buffer);
+
+        assert(send_buffer != NULL);
 
         // Sync communication
         this->pm_->CommunicateSync_();
 
+        typedef typename reduced_halo_type<ValueType>::type HaloType;
+
+        if(this->reduced_halo_ == true && sizeof(HaloType) < sizeof(ValueType))
+        {
+            int nrecv = this->pm_->GetNumReceivers();
+
+            const HaloType* recv_reduced
+                = static_cast<const HaloType*>(this->recv_boundary_reduced_);
+
+            // Expand the received boundary values to full precision
+            for(int i = 0; i < nrecv; ++i)
+            {
+                this->recv_boundary_[i] = static_cast<ValueType>(recv_reduced[i]);
+            }
+        }
+
         if(this->is_host_() == true)
         {
             // On host, we need to set back the pointer into its structure
-            this->send_buffer_.SetDataPtr(&send_buffer, "send buffer", this->pm_->GetNumSenders());
+            this->send_buffer_.SetDataPtr(send_buffer, "send buffer", this->pm_->GetNumSenders());
         }
 
+        *send_buffer = NULL;
+
         // Change to compute mode ghost
         _rocalution_compute_ghost();
 
@@ -999,12 +1099,145 @@ namespace rocalution
 
         // Change to compute mode default
         _rocalution_compute_default();
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::FreeReducedHalo_(void) const
+    {
+        typedef typename reduced_halo_type<ValueType>::type HaloType;
+
+        HaloType* recv_reduced = static_cast<HaloType*>(this->recv_boundary_reduced_);
+        HaloType* send_reduced = static_cast<HaloType*>(this->send_boundary_reduced_);
+
+        free_pinned(&recv_reduced);
+        free_pinned(&send_reduced);
+
+        this->recv_boundary_reduced_ = NULL;
+        this->send_boundary_reduced_ = NULL;
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::Apply(const GlobalVector<ValueType>& in,
+                                        GlobalVector<ValueType>*       out) const
+    {
+        log_debug(this, "GlobalMatrix::Apply()", (const void*&)in, out);
+
+        assert(out != NULL);
+        assert(&in != out);
+
+        // Calling global routine with single process
+        if(this->pm_ == NULL)
+        {
+            // no PM, do interior apply
+            this->matrix_interior_.Apply(in.vector_interior_, &out->vector_interior_);
+
+            return;
+        }
+
+        assert(this->GetM() == out->GetSize());
+        assert(this->GetN() == in.GetSize());
+        assert(this->is_host_() == in.is_host_());
+        assert(this->is_host_() == out->is_host_());
+        assert(this->is_host_() == this->halo_.is_host_());
+        assert(this->is_host_() == this->recv_buffer_.is_host_());
+        assert(this->is_host_() == this->send_buffer_.is_host_());
+
+        // Post the halo exchange
+        ValueType* send_buffer = NULL;
+        this->StartHaloExchange_(in.vector_interior_, &send_buffer);
+
+        // Change to compute mode interior
+        _rocalution_compute_interior();
+
+        // Interior, overlapped with the halo exchange
+        this->matrix_interior_.Apply(in.vector_interior_, &out->vector_interior_);
+
+        // Wait for the ghost values
+        this->FinishHaloExchange_(&send_buffer);
 
         // Ghost
         this->matrix_ghost_.ApplyAdd(
             this->recv_buffer_, static_cast<ValueType>(1), &out->vector_interior_);
     }
 
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::MultiApply(int                                   num,
+                                             const GlobalVector<ValueType>* const* in,
+                                             GlobalVector<ValueType>**             out) const
+    {
+        log_debug(this, "GlobalMatrix::MultiApply()", num, in, out);
+
+        assert(num >= 0);
+
+        if(num == 0)
+        {
+            return;
+        }
+
+        assert(in != NULL);
+        assert(out != NULL);
+
+        std::vector<const LocalVector<ValueType>*> in_interior(num);
+        std::vector<LocalVector<ValueType>*>       out_interior(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            assert(in[j] != NULL);
+            assert(out[j] != NULL);
+            assert(in[j] != out[j]);
+
+            in_interior[j]  = &in[j]->vector_interior_;
+            out_interior[j] = &out[j]->vector_interior_;
+        }
+
+        // Calling global routine with single process
+        if(this->pm_ == NULL)
+        {
+            // no PM, do interior apply
+            this->matrix_interior_.MultiApply(num, in_interior.data(), out_interior.data());
+
+            return;
+        }
+
+        assert(this->is_host_() == this->halo_.is_host_());
+        assert(this->is_host_() == this->recv_buffer_.is_host_());
+        assert(this->is_host_() == this->send_buffer_.is_host_());
+
+        for(int j = 0; j < num; ++j)
+        {
+            assert(this->GetM() == out[j]->GetSize());
+            assert(this->GetN() == in[j]->GetSize());
+            assert(this->is_host_() == in[j]->is_host_());
+            assert(this->is_host_() == out[j]->is_host_());
+        }
+
+        // Post the halo exchange of the first vector
+        ValueType* send_buffer = NULL;
+        this->StartHaloExchange_(in[0]->vector_interior_, &send_buffer);
+
+        // Change to compute mode interior
+        _rocalution_compute_interior();
+
+        // Interior block product, overlapped with the first halo exchange
+        this->matrix_interior_.MultiApply(num, in_interior.data(), out_interior.data());
+
+        for(int j = 0; j < num; ++j)
+        {
+            if(j > 0)
+            {
+                // Post the halo exchange of vector j
+                this->StartHaloExchange_(in[j]->vector_interior_, &send_buffer);
+            }
+
+            // Wait for the ghost values of vector j
+            this->FinishHaloExchange_(&send_buffer);
+
+            // Ghost
+            this->matrix_ghost_.ApplyAdd(
+                this->recv_buffer_, static_cast<ValueType>(1), &out[j]->vector_interior_);
+        }
+    }
+
     template <typename ValueType>
     void GlobalMatrix<ValueType>::ApplyAdd(const GlobalVector<ValueType>& in,
                                            ValueType                      scalar,
@@ -1015,12 +1248,69 @@ namespace rocalution
         assert(out != NULL);
         assert(&in != out);
 
+        // Calling global routine with single process
+        if(this->pm_ == NULL)
+        {
+            // no PM, do interior apply
+            this->matrix_interior_.ApplyAdd(in.vector_interior_, scalar, &out->vector_interior_);
+
+            return;
+        }
+
         assert(this->GetM() == out->GetSize());
         assert(this->GetN() == in.GetSize());
         assert(this->is_host_() == in.is_host_());
         assert(this->is_host_() == out->is_host_());
+        assert(this->is_host_() == this->halo_.is_host_());
+        assert(this->is_host_() == this->recv_buffer_.is_host_());
+        assert(this->is_host_() == this->send_buffer_.is_host_());
 
-        FATAL_ERROR(__FILE__, __LINE__);
+        // Post the halo exchange
+        ValueType* send_buffer = NULL;
+        this->StartHaloExchange_(in.vector_interior_, &send_buffer);
+
+        // Change to compute mode interior
+        _rocalution_compute_interior();
+
+        // Interior, overlapped with the halo exchange
+        this->matrix_interior_.ApplyAdd(in.vector_interior_, scalar, &out->vector_interior_);
+
+        // Wait for the ghost values
+        this->FinishHaloExchange_(&send_buffer);
+
+        // Ghost
+        this->matrix_ghost_.ApplyAdd(this->recv_buffer_, scalar, &out->vector_interior_);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ExchangeGhostValues(const GlobalVector<ValueType>& in,
+                                                      LocalVector<ValueType>*        ghost) const
+    {
+        log_debug(this, "GlobalMatrix::ExchangeGhostValues()", (const void*&)in, ghost);
+
+        assert(ghost != NULL);
+
+        // No ghost part without PM
+        if(this->pm_ == NULL)
+        {
+            return;
+        }
+
+        assert(this->GetN() == in.GetSize());
+        assert(this->is_host_() == in.is_host_());
+        assert(this->is_host_() == ghost->is_host_());
+
+        ValueType* send_buffer = NULL;
+        this->StartHaloExchange_(in.vector_interior_, &send_buffer);
+        this->FinishHaloExchange_(&send_buffer);
+
+        if(ghost->GetSize() != this->recv_buffer_.GetSize())
+        {
+            ghost->Clear();
+            ghost->Allocate("ghost values", this->recv_buffer_.GetSize());
+        }
+
+        ghost->CopyFrom(this->recv_buffer_);
     }
 
     template <typename ValueType>
@@ -1077,6 +1367,13 @@ namespace rocalution
 
             // Generate T ghost and parallel manager of T
 
+            // Ghost parts assembled from global rows are stored in COO
+            T_ext.ConvertToCSR();
+
+            // The ghost part of T is regenerated in CSR
+            T->matrix_ghost_.Clear();
+            T->matrix_ghost_.ConvertToCSR();
+
             // T_ext and T ghost MUST be CSR
             assert(T_ext.GetFormat() == CSR);
             assert(T->matrix_ghost_.GetFormat() == CSR);
@@ -1305,7 +1602,7 @@ namespace rocalution
 #endif
 
         // Calling global routine with single process
-        if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
+        if(A.pm_ == NULL || A.pm_->num_procs_ == 1)
         {
             this->matrix_interior_.TripleMatrixProduct(
                 R.matrix_interior_, A.matrix_interior_, P.matrix_interior_);
@@ -1323,7 +1620,11 @@ namespace rocalution
             return;
         }
 
-        FATAL_ERROR(__FILE__, __LINE__);
+        // Distributed Galerkin product, computed as R * (A * P)
+        GlobalMatrix<ValueType> AP;
+        AP.MatrixMult(A, P);
+
+        this->MatrixMult(R, AP);
 
 #ifdef DEBUG_MODE
         this->Check();
@@ -1331,36 +1632,181 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void GlobalMatrix<ValueType>::ReadFileMTX(const std::string& filename)
+    void GlobalMatrix<ValueType>::MatrixMult(const GlobalMatrix<ValueType>& A,
+                                             const GlobalMatrix<ValueType>& B)
     {
-        log_debug(this, "GlobalMatrix::ReadFileMTX()", filename);
+        log_debug(this, "GlobalMatrix::MatrixMult()", (const void*&)A, (const void*&)B);
 
-        assert(this->pm_ != NULL);
-        assert(this->pm_->Status() == true);
+        assert(&A != this);
+        assert(&B != this);
+        assert(A.GetN() == B.GetM());
+        assert(this->is_host_() == A.is_host_());
+        assert(this->is_host_() == B.is_host_());
 
-        // Read header file
-        std::ifstream headfile(filename.c_str(), std::ifstream::in);
+#ifdef DEBUG_MODE
+        A.Check();
+        B.Check();
+#endif
 
-        if(!headfile.is_open())
+        // Calling global routine with single process
+        if(A.pm_ == NULL || A.pm_->num_procs_ == 1)
         {
-            LOG_INFO("Cannot open GlobalMatrix file [read]: " << filename);
-            FATAL_ERROR(__FILE__, __LINE__);
-        }
+            this->matrix_interior_.MatrixMult(A.matrix_interior_, B.matrix_interior_);
 
-        // Go to this ranks line in the headfile
-        for(int i = 0; i < this->pm_->rank_; ++i)
-        {
-            headfile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            headfile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
+            this->CreateParallelManager_();
 
-        std::string interior_name;
-        std::string ghost_name;
+            this->pm_self_->SetMPICommunicator(A.pm_->comm_);
 
-        std::getline(headfile, interior_name);
-        std::getline(headfile, ghost_name);
+            this->pm_self_->SetGlobalNrow(this->matrix_interior_.GetM());
+            this->pm_self_->SetGlobalNcol(this->matrix_interior_.GetN());
 
-        headfile.close();
+            this->pm_self_->SetLocalNrow(this->matrix_interior_.GetM());
+            this->pm_self_->SetLocalNcol(this->matrix_interior_.GetN());
+
+            return;
+        }
+
+        assert(B.pm_ != NULL);
+        assert(A.pm_->local_ncol_ == B.pm_->local_nrow_);
+
+        int64_t local_nrow = A.pm_->local_nrow_;
+
+        // Host CSR of A, interior columns are local rows of B, ghost columns are the
+        // rows of B that we receive from the neighbors
+        PtrType*   a_int_ptr = NULL;
+        int*       a_int_col = NULL;
+        ValueType* a_int_val = NULL;
+        PtrType*   a_gst_ptr = NULL;
+        int*       a_gst_col = NULL;
+        ValueType* a_gst_val = NULL;
+
+        A.ExtractHostCSR_(
+            &a_int_ptr, &a_int_col, &a_int_val, &a_gst_ptr, &a_gst_col, &a_gst_val);
+
+        // Local rows of B with global columns
+        PtrType*   b_ptr = NULL;
+        int64_t*   b_col = NULL;
+        ValueType* b_val = NULL;
+
+        B.ExtractGlobalRows_(&b_ptr, &b_col, &b_val);
+
+        // Rows of B that belong to the ghost columns of A
+        PtrType*   recv_ptr = NULL;
+        int64_t*   recv_col = NULL;
+        ValueType* recv_val = NULL;
+
+        A.FetchGhostRows_(b_ptr, b_col, b_val, &recv_ptr, &recv_col, &recv_val);
+
+        // Row-wise product with global column indices
+        std::vector<std::pair<int64_t, ValueType>> row;
+
+        std::vector<PtrType>   c_ptr(local_nrow + 1, 0);
+        std::vector<int64_t>   c_col;
+        std::vector<ValueType> c_val;
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            row.clear();
+
+            for(PtrType j = a_int_ptr[i]; j < a_int_ptr[i + 1]; ++j)
+            {
+                int k = a_int_col[j];
+
+                for(PtrType l = b_ptr[k]; l < b_ptr[k + 1]; ++l)
+                {
+                    row.push_back(std::make_pair(b_col[l], a_int_val[j] * b_val[l]));
+                }
+            }
+
+            for(PtrType j = a_gst_ptr[i]; j < a_gst_ptr[i + 1]; ++j)
+            {
+                int k = a_gst_col[j];
+
+                for(PtrType l = recv_ptr[k]; l < recv_ptr[k + 1]; ++l)
+                {
+                    row.push_back(std::make_pair(recv_col[l], a_gst_val[j] * recv_val[l]));
+                }
+            }
+
+            std::sort(row.begin(),
+                      row.end(),
+                      [](const std::pair<int64_t, ValueType>& a,
+                         const std::pair<int64_t, ValueType>& b) { return a.first < b.first; });
+
+            // Accumulate duplicate columns
+            for(size_t j = 0; j < row.size(); ++j)
+            {
+                if(j > 0 && row[j].first == row[j - 1].first)
+                {
+                    c_val.back() += row[j].second;
+                }
+                else
+                {
+                    c_col.push_back(row[j].first);
+                    c_val.push_back(row[j].second);
+                }
+            }
+
+            c_ptr[i + 1] = static_cast<PtrType>(c_col.size());
+        }
+
+        free_host(&a_int_ptr);
+        free_host(&a_int_col);
+        free_host(&a_int_val);
+        free_host(&a_gst_ptr);
+        free_host(&a_gst_col);
+        free_host(&a_gst_val);
+        free_host(&b_ptr);
+        free_host(&b_col);
+        free_host(&b_val);
+        free_host(&recv_ptr);
+        free_host(&recv_col);
+        free_host(&recv_val);
+
+        std::string name = this->object_name_;
+
+        this->GenerateFromGlobalRows_(A.pm_->comm_,
+                                      A.pm_->global_nrow_,
+                                      B.pm_->global_ncol_,
+                                      local_nrow,
+                                      B.pm_->local_ncol_,
+                                      c_ptr.data(),
+                                      c_col.data(),
+                                      c_val.data(),
+                                      name);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ReadFileMTX(const std::string& filename)
+    {
+        log_debug(this, "GlobalMatrix::ReadFileMTX()", filename);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+        // Read header file
+        std::ifstream headfile(filename.c_str(), std::ifstream::in);
+
+        if(!headfile.is_open())
+        {
+            LOG_INFO("Cannot open GlobalMatrix file [read]: " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Go to this ranks line in the headfile
+        for(int i = 0; i < this->pm_->rank_; ++i)
+        {
+            headfile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            headfile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+
+        std::string interior_name;
+        std::string ghost_name;
+
+        std::getline(headfile, interior_name);
+        std::getline(headfile, ghost_name);
+
+        headfile.close();
 
         // Extract directory containing the subfiles
         size_t      found = filename.find_last_of("\\/");
@@ -1522,6 +1968,326 @@ namespace rocalution
         this->matrix_ghost_.WriteFileCSR(ghost_name);
     }
 
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ReadFileCSRCollective(const std::string& filename)
+    {
+        log_debug(this, "GlobalMatrix::ReadFileCSRCollective()", filename);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->comm_ != NULL);
+
+#ifdef SUPPORT_MULTINODE
+        const void* comm      = this->pm_->comm_;
+        int         rank      = this->pm_->rank_;
+        int         num_procs = this->pm_->num_procs_;
+
+        LOG_INFO("ReadFileCSRCollective: filename=" << filename << "; reading...");
+
+        MFile file;
+
+        if(communication_file_open_read(filename.c_str(), &file, comm) == false)
+        {
+            LOG_INFO("Cannot open GlobalMatrix file [read]: " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Header, rocALUTION version and matrix sizes
+        const std::string header = "#rocALUTION binary csr file\n";
+
+        std::vector<char> head(header.size() + sizeof(int) + 3 * sizeof(int64_t), 0);
+        communication_file_read_at_all(&file, 0, head.data(), head.size(), comm);
+
+        if(std::string(head.data(), header.size()) != header)
+        {
+            LOG_INFO("ReadFileCSRCollective: invalid rocALUTION matrix header");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        int version;
+        std::memcpy(&version, head.data() + header.size(), sizeof(int));
+
+        int64_t nrow;
+        int64_t ncol;
+        int64_t nnz;
+        int64_t offset = header.size() + sizeof(int);
+        int64_t ptr_size;
+
+        // We need backward compatibility
+        if(version < 30000)
+        {
+            int size32[3];
+            std::memcpy(size32, head.data() + offset, 3 * sizeof(int));
+
+            nrow = size32[0];
+            ncol = size32[1];
+            nnz  = size32[2];
+
+            offset += 3 * sizeof(int);
+
+            // Always 32 bit row pointers
+            ptr_size = sizeof(int);
+        }
+        else
+        {
+            std::memcpy(&nrow, head.data() + offset, sizeof(int64_t));
+            std::memcpy(&ncol, head.data() + offset + sizeof(int64_t), sizeof(int64_t));
+            std::memcpy(&nnz, head.data() + offset + 2 * sizeof(int64_t), sizeof(int64_t));
+
+            offset += 3 * sizeof(int64_t);
+
+            // Precision of the row pointers is determined by nnz
+            ptr_size = nnz < std::numeric_limits<int>::max() ? sizeof(int) : sizeof(int64_t);
+        }
+
+        // Row distribution, either from the parallel manager or evenly distributed
+        int64_t local_nrow;
+        int64_t local_ncol;
+
+        if(this->pm_->global_nrow_ == nrow && this->pm_->global_ncol_ == ncol)
+        {
+            local_nrow = this->pm_->local_nrow_;
+            local_ncol = this->pm_->local_ncol_;
+        }
+        else
+        {
+            local_nrow = nrow / num_procs + (rank < nrow % num_procs ? 1 : 0);
+            local_ncol = ncol / num_procs + (rank < ncol % num_procs ? 1 : 0);
+        }
+
+        std::vector<int64_t> local_size(num_procs);
+        communication_sync_allgather_single(&local_nrow, local_size.data(), comm);
+
+        int64_t row_begin = 0;
+        int64_t row_total = 0;
+
+        for(int n = 0; n < num_procs; ++n)
+        {
+            row_begin += (n < rank) ? local_size[n] : 0;
+            row_total += local_size[n];
+        }
+
+        if(row_total != nrow)
+        {
+            LOG_INFO("ReadFileCSRCollective: row distribution does not match matrix size");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Read the row pointers of this process
+        std::vector<char> ptr_buffer((local_nrow + 1) * ptr_size);
+        communication_file_read_at_all(
+            &file, offset + row_begin * ptr_size, ptr_buffer.data(), ptr_buffer.size(), comm);
+
+        std::vector<int64_t> global_ptr(local_nrow + 1);
+
+        if(ptr_size == sizeof(int))
+        {
+            const int* ptr32 = reinterpret_cast<const int*>(ptr_buffer.data());
+
+            for(int64_t i = 0; i < local_nrow + 1; ++i)
+            {
+                global_ptr[i] = ptr32[i];
+            }
+        }
+        else
+        {
+            std::memcpy(global_ptr.data(), ptr_buffer.data(), ptr_buffer.size());
+        }
+
+        offset += (nrow + 1) * ptr_size;
+
+        int64_t nnz_begin = global_ptr[0];
+        int64_t local_nnz = global_ptr[local_nrow] - nnz_begin;
+
+        // Read the column indices and values of this process
+        typedef typename binary_io_type<ValueType>::type FileType;
+
+        std::vector<int>      file_col(local_nnz);
+        std::vector<FileType> file_val(local_nnz);
+
+        communication_file_read_at_all(&file,
+                                       offset + nnz_begin * sizeof(int),
+                                       file_col.data(),
+                                       local_nnz * sizeof(int),
+                                       comm);
+
+        offset += nnz * sizeof(int);
+
+        communication_file_read_at_all(&file,
+                                       offset + nnz_begin * sizeof(FileType),
+                                       file_val.data(),
+                                       local_nnz * sizeof(FileType),
+                                       comm);
+
+        communication_file_close(&file);
+
+        // Convert to local rows with global column indices
+        std::vector<PtrType>   row_offset(local_nrow + 1);
+        std::vector<int64_t>   col(local_nnz);
+        std::vector<ValueType> val(local_nnz);
+
+        for(int64_t i = 0; i < local_nrow + 1; ++i)
+        {
+            row_offset[i] = static_cast<PtrType>(global_ptr[i] - nnz_begin);
+        }
+
+        for(int64_t j = 0; j < local_nnz; ++j)
+        {
+            col[j] = file_col[j];
+            val[j] = static_cast<ValueType>(file_val[j]);
+        }
+
+        this->GenerateFromGlobalRows_(comm,
+                                      nrow,
+                                      ncol,
+                                      local_nrow,
+                                      local_ncol,
+                                      row_offset.data(),
+                                      col.data(),
+                                      val.data(),
+                                      filename);
+
+        LOG_INFO("ReadFileCSRCollective: filename=" << filename << "; done");
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::WriteFileCSRCollective(const std::string& filename) const
+    {
+        log_debug(this, "GlobalMatrix::WriteFileCSRCollective()", filename);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+#ifdef SUPPORT_MULTINODE
+        const void* comm      = this->pm_->comm_;
+        int         rank      = this->pm_->rank_;
+        int         num_procs = this->pm_->num_procs_;
+
+        LOG_INFO("WriteFileCSRCollective: filename=" << filename << "; writing...");
+
+        int64_t nrow = this->pm_->global_nrow_;
+        int64_t ncol = this->pm_->global_ncol_;
+
+        // Column indices are stored with 32 bits
+        if(ncol > std::numeric_limits<int>::max())
+        {
+            LOG_INFO("WriteFileCSRCollective: column indices exceed 32 bit range");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        int64_t row_begin  = this->pm_->GetGlobalRowBegin();
+        int64_t local_nrow = this->pm_->local_nrow_;
+
+        // Local rows with ascending global column indices
+        PtrType*   row_offset = NULL;
+        int64_t*   row_col    = NULL;
+        ValueType* row_val    = NULL;
+
+        this->ExtractGlobalRows_(&row_offset, &row_col, &row_val);
+
+        int64_t local_nnz = row_offset[local_nrow];
+
+        // Offset of this process into the global column and value arrays
+        std::vector<int64_t> local_size(num_procs);
+        communication_sync_allgather_single(&local_nnz, local_size.data(), comm);
+
+        int64_t nnz_begin = 0;
+        int64_t nnz       = 0;
+
+        for(int n = 0; n < num_procs; ++n)
+        {
+            nnz_begin += (n < rank) ? local_size[n] : 0;
+            nnz += local_size[n];
+        }
+
+        // Convert to the file types
+        typedef typename binary_io_type<ValueType>::type FileType;
+
+        std::vector<int64_t>  row_ptr(local_nrow + 1);
+        std::vector<int>      col(local_nnz);
+        std::vector<FileType> val(local_nnz);
+
+        for(int64_t i = 0; i < local_nrow + 1; ++i)
+        {
+            row_ptr[i] = nnz_begin + row_offset[i];
+        }
+
+        for(int64_t j = 0; j < local_nnz; ++j)
+        {
+            col[j] = static_cast<int>(row_col[j]);
+            val[j] = static_cast<FileType>(row_val[j]);
+        }
+
+        free_host(&row_offset);
+        free_host(&row_col);
+        free_host(&row_val);
+
+        MFile file;
+
+        if(communication_file_open_write(filename.c_str(), &file, comm) == false)
+        {
+            LOG_INFO("Cannot open GlobalMatrix file [write]: " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Header, rocALUTION version and matrix sizes are written by the master rank
+        const std::string header  = "#rocALUTION binary csr file\n";
+        int               version = __ROCALUTION_VER;
+
+        std::vector<char> head(header.begin(), header.end());
+        head.insert(head.end(), (char*)&version, (char*)&version + sizeof(int));
+        head.insert(head.end(), (char*)&nrow, (char*)&nrow + sizeof(int64_t));
+        head.insert(head.end(), (char*)&ncol, (char*)&ncol + sizeof(int64_t));
+        head.insert(head.end(), (char*)&nnz, (char*)&nnz + sizeof(int64_t));
+
+        communication_file_write_at_all(&file, 0, head.data(), rank == 0 ? head.size() : 0, comm);
+
+        int64_t offset = head.size();
+
+        // Row pointers, the last process also writes the final entry
+        int64_t nptr = (rank == num_procs - 1) ? local_nrow + 1 : local_nrow;
+
+        if(nnz <= std::numeric_limits<int>::max())
+        {
+            std::vector<int> ptr32(row_ptr.begin(), row_ptr.end());
+
+            communication_file_write_at_all(&file,
+                                            offset + row_begin * sizeof(int),
+                                            ptr32.data(),
+                                            nptr * sizeof(int),
+                                            comm);
+
+            offset += (nrow + 1) * sizeof(int);
+        }
+        else
+        {
+            communication_file_write_at_all(&file,
+                                            offset + row_begin * sizeof(int64_t),
+                                            row_ptr.data(),
+                                            nptr * sizeof(int64_t),
+                                            comm);
+
+            offset += (nrow + 1) * sizeof(int64_t);
+        }
+
+        // Column indices and values
+        communication_file_write_at_all(
+            &file, offset + nnz_begin * sizeof(int), col.data(), local_nnz * sizeof(int), comm);
+
+        offset += nnz * sizeof(int);
+
+        communication_file_write_at_all(&file,
+                                        offset + nnz_begin * sizeof(FileType),
+                                        val.data(),
+                                        local_nnz * sizeof(FileType),
+                                        comm);
+
+        communication_file_close(&file);
+
+        LOG_INFO("WriteFileCSRCollective: filename=" << filename << "; done");
+#endif
+    }
+
     template <typename ValueType>
     void
         GlobalMatrix<ValueType>::ExtractInverseDiagonal(GlobalVector<ValueType>* vec_inv_diag) const
@@ -1578,6 +2344,16 @@ namespace rocalution
             return;
         }
 
+        // Processes without rows (e.g. after agglomeration) do not contribute any aggregates
+        if(this->matrix_interior_.GetNnz() == 0)
+        {
+            nc     = 0;
+            Gsize  = 0;
+            rGsize = 0;
+
+            return;
+        }
+
         LocalMatrix<ValueType> tmp;
         tmp.CloneFrom(this->matrix_ghost_);
         tmp.ConvertToCSR();
@@ -1614,6 +2390,16 @@ namespace rocalution
             return;
         }
 
+        // Processes without rows (e.g. after agglomeration) do not contribute any aggregates
+        if(this->matrix_interior_.GetNnz() == 0)
+        {
+            nc     = 0;
+            Gsize  = 0;
+            rGsize = 0;
+
+            return;
+        }
+
         LocalMatrix<ValueType> tmp;
         tmp.CloneFrom(this->matrix_ghost_);
         tmp.ConvertToCSR();
@@ -1642,7 +2428,7 @@ namespace rocalution
                   rGsize);
 
         assert(Ac != NULL);
-        assert(rG != NULL);
+        assert(rG != NULL || nrow == 0);
 
         // Calling global routine with single process
         if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
@@ -1784,7 +2570,12 @@ namespace rocalution
         LocalMatrix<ValueType> tmp;
         LocalMatrix<ValueType> host_interior;
 
-        if(this->is_accel_())
+        if(this->matrix_interior_.GetNnz() == 0)
+        {
+            // Processes without rows (e.g. after agglomeration) have an empty coarse part
+            tmp.AllocateCSR("", 0, nrow, nrow);
+        }
+        else if(this->is_accel_())
         {
             host_interior.ConvertTo(this->GetInterior().GetFormat(),
                                     this->GetInterior().GetBlockDimension());
@@ -1862,7 +2653,11 @@ namespace rocalution
         LocalMatrix<ValueType> tmp_ghost;
         LocalMatrix<ValueType> host_ghost;
 
-        if(this->is_accel_())
+        if(this->matrix_ghost_.GetNnz() == 0)
+        {
+            tmp_ghost.AllocateCSR("", 0, nrow, this->pm_->GetNumReceivers());
+        }
+        else if(this->is_accel_())
         {
             host_ghost.ConvertTo(this->GetGhost().GetFormat(),
                                  this->GetGhost().GetBlockDimension());
@@ -1947,907 +2742,3487 @@ namespace rocalution
         this->pm_ = NULL;
         pro->pm_  = NULL;
 
+        // Processes without rows (e.g. after agglomeration) have empty transfer operators
+        if(n == 0)
+        {
+            this->matrix_interior_.AllocateCSR("", 0, m, n);
+            pro->matrix_interior_.AllocateCSR("", 0, n, m);
+
+            return;
+        }
+
         this->matrix_interior_.CreateFromMap(map, n, m, &pro->matrix_interior_);
     }
 
-    template <typename ValueType>
-    void GlobalMatrix<ValueType>::RSCoarsening(float              eps,
-                                               LocalVector<int>*  CFmap,
-                                               LocalVector<bool>* S) const
+#ifdef SUPPORT_MULTINODE
+    // Offset of the local count of this process within the global numbering
+    static int64_t process_offset(int64_t local_count, int rank, int num_procs, const void* comm)
     {
-        log_debug(this, "GlobalMatrix::RSCoarsening()", eps, CFmap, S);
+        std::vector<int64_t> counts(num_procs);
+        communication_sync_allgather_single(&local_count, counts.data(), comm);
 
-        assert(eps < 1.0f);
-        assert(eps > 0.0f);
-        assert(CFmap != NULL);
-        assert(S != NULL);
-        assert(this->is_host_() == CFmap->is_host_());
-        assert(this->is_host_() == S->is_host_());
+        int64_t offset = 0;
+        for(int n = 0; n < rank; ++n)
+        {
+            offset += counts[n];
+        }
 
-#ifdef DEBUG_MODE
-        this->Check();
+        return offset;
+    }
 #endif
 
-        // Calling global routine with single process
-        if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
+    // Lexicographical order of (state, hash of the global index, global index), used to
+    // determine the maximal independent set of the PMIS aggregation
+    static bool pmis_greater(int state_a, int64_t idx_a, int state_b, int64_t idx_b)
+    {
+        if(state_a != state_b)
         {
-            this->matrix_interior_.RSCoarsening(eps, CFmap, S);
+            return state_a > state_b;
+        }
 
-            return;
+        unsigned int hash_a = static_cast<unsigned int>(idx_a ^ (idx_a >> 32));
+        hash_a              = ((hash_a >> 16) ^ hash_a) * 0x45d9f3b;
+        hash_a              = ((hash_a >> 16) ^ hash_a) * 0x45d9f3b;
+        hash_a              = (hash_a >> 16) ^ hash_a;
+
+        unsigned int hash_b = static_cast<unsigned int>(idx_b ^ (idx_b >> 32));
+        hash_b              = ((hash_b >> 16) ^ hash_b) * 0x45d9f3b;
+        hash_b              = ((hash_b >> 16) ^ hash_b) * 0x45d9f3b;
+        hash_b              = (hash_b >> 16) ^ hash_b;
+
+        if(hash_a != hash_b)
+        {
+            return hash_a > hash_b;
         }
 
-        LOG_VERBOSE_INFO(2,
-                         "*** error: GlobalMatrix::RSCoarsening() is not available on GlobalMatrix "
-                         "class - use PMIS coarsening instead");
-        FATAL_ERROR(__FILE__, __LINE__);
+        return idx_a > idx_b;
     }
 
     template <typename ValueType>
-    void GlobalMatrix<ValueType>::RSPMISCoarsening(float              eps,
-                                                   LocalVector<int>*  CFmap,
-                                                   LocalVector<bool>* S) const
+    void GlobalMatrix<ValueType>::AMGConnect(ValueType eps, LocalVector<int>* connections) const
     {
-        log_debug(this, "GlobalMatrix::RSPMISCoarsening()", eps, CFmap, S);
+        log_debug(this, "GlobalMatrix::AMGConnect()", eps, connections);
 
-        assert(eps < 1.0f);
-        assert(eps > 0.0f);
-        assert(CFmap != NULL);
-        assert(S != NULL);
-        assert(this->is_host_() == CFmap->is_host_());
-        assert(this->is_host_() == S->is_host_());
-        assert(this->is_host_() == this->halo_.is_host_());
+        assert(connections != NULL);
+        assert(this->pm_ != NULL);
 
-#ifdef DEBUG_MODE
-        this->Check();
-#endif
+        int64_t local_nrow = this->pm_->local_nrow_;
+        int     nghost     = this->pm_->GetNumReceivers();
 
-        // Calling global routine with single process
-        if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
-        {
-            this->matrix_interior_.RSPMISCoarsening(eps, CFmap, S);
+        PtrType*   int_ptr = NULL;
+        int*       int_col = NULL;
+        ValueType* int_val = NULL;
+        PtrType*   gst_ptr = NULL;
+        int*       gst_col = NULL;
+        ValueType* gst_val = NULL;
 
-            return;
-        }
+        this->ExtractHostCSR_(&int_ptr, &int_col, &int_val, &gst_ptr, &gst_col, &gst_val);
 
-        // Only CSR matrices are supported
-        LocalMatrix<ValueType> csr_int;
-        LocalMatrix<ValueType> csr_gst;
+        int64_t int_nnz = int_ptr[local_nrow];
+        int64_t gst_nnz = gst_ptr[local_nrow];
 
-        const LocalMatrix<ValueType>* int_ptr = &this->matrix_interior_;
-        const LocalMatrix<ValueType>* gst_ptr = &this->matrix_ghost_;
+        // Diagonal entries of the local rows and of the ghost rows
+        std::vector<ValueType> diag(local_nrow, static_cast<ValueType>(0));
+        std::vector<ValueType> ghost_diag(nghost, static_cast<ValueType>(0));
 
-        if(int_ptr->GetFormat() != CSR)
+        for(int64_t i = 0; i < local_nrow; ++i)
         {
-            csr_int.CloneFrom(*int_ptr);
-            csr_int.ConvertToCSR();
-            int_ptr = &csr_int;
+            for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+            {
+                if(int_col[j] == i)
+                {
+                    diag[i] = int_val[j];
+                }
+            }
         }
 
-        if(gst_ptr->GetFormat() != CSR)
-        {
-            csr_gst.CloneFrom(*gst_ptr);
-            csr_gst.ConvertToCSR();
-            gst_ptr = &csr_gst;
-        }
+        this->CommunicateBoundary_(diag.data(), ghost_diag.data());
 
-        if(this->GetNnz() > 0)
+        ValueType eps2 = eps * eps;
+
+        // Interior couplings first, followed by the ghost couplings
+        std::vector<int> conn(int_nnz + gst_nnz);
+
+        for(int64_t i = 0; i < local_nrow; ++i)
         {
-            // Communication sizes
-            int nsend = this->pm_->GetNumSenders();
-            int nrecv = this->pm_->GetNumReceivers();
+            ValueType eps_dia_i = eps2 * diag[i];
 
-            // Some communication related buffers
-            int*   hisend_buffer = NULL;
-            int*   hirecv_buffer = NULL;
-            float* hsend_buffer  = NULL;
-            float* hrecv_buffer  = NULL;
+            for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+            {
+                int       c = int_col[j];
+                ValueType v = int_val[j];
 
-            allocate_host(nsend, &hisend_buffer);
-            allocate_host(nrecv, &hirecv_buffer);
-            allocate_host(nsend, &hsend_buffer);
-            allocate_host(nrecv, &hrecv_buffer);
+                conn[j] = (c != i) && (v * v > eps_dia_i * diag[c]);
+            }
 
-            // Allocate S
-            S->Allocate("S", int_ptr->GetNnz() + gst_ptr->GetNnz());
+            for(PtrType j = gst_ptr[i]; j < gst_ptr[i + 1]; ++j)
+            {
+                ValueType v = gst_val[j];
 
-            // Sample rng
-            LocalVector<float> omega;
-            omega.CloneBackend(*this);
-            omega.Allocate("omega", int_ptr->GetM() + nrecv);
+                conn[int_nnz + j] = (v * v > eps_dia_i * ghost_diag[gst_col[j]]);
+            }
+        }
 
-            // Determine strong influences in the matrix
-            unsigned long long seed = this->pm_->GetGlobalRowBegin(); // TODO
-            int_ptr->matrix_->RSPMISStrongInfluences(
-                eps, S->vector_, omega.vector_, seed, *gst_ptr->matrix_);
+        free_host(&int_ptr);
+        free_host(&int_col);
+        free_host(&int_val);
+        free_host(&gst_ptr);
+        free_host(&gst_col);
+        free_host(&gst_val);
 
-            // Update S, omega and CF mapping from neighbors
+        connections->Clear();
+        connections->Allocate("connections", int_nnz + gst_nnz);
+        connections->CopyFromHostData(conn.data());
+    }
 
-            // Prepare send buffer
-            omega.GetContinuousValues(int_ptr->GetM(), omega.GetSize(), hrecv_buffer);
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::AMGAggregate(const LocalVector<int>& connections,
+                                               LocalVector<int64_t>*   aggregates,
+                                               LocalVector<int64_t>*   aggregate_root_nodes) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::AMGAggregate()",
+                  (const void*&)connections,
+                  aggregates,
+                  aggregate_root_nodes);
 
-            // Send omega ghost to neighbors
-            this->pm_->InverseCommunicateAsync_(hrecv_buffer, hsend_buffer);
+        assert(aggregates != NULL);
+        assert(aggregate_root_nodes != NULL);
+        assert(this->pm_ != NULL);
 
-            // Synchronize
-            this->pm_->InverseCommunicateSync_();
+#ifdef SUPPORT_MULTINODE
+        int64_t local_nrow = this->pm_->local_nrow_;
+        int64_t row_begin  = process_offset(
+            local_nrow, this->pm_->rank_, this->pm_->num_procs_, this->pm_->comm_);
 
-            // Update omega with received omega from neighbors
-            LocalVector<float> send_buffer;
-            send_buffer.CloneBackend(*this);
-            send_buffer.Allocate("send buffer", nsend);
-            send_buffer.CopyFromHostData(hsend_buffer);
+        PtrType*   int_ptr = NULL;
+        int*       int_col = NULL;
+        ValueType* int_val = NULL;
+        PtrType*   gst_ptr = NULL;
+        int*       gst_col = NULL;
+        ValueType* gst_val = NULL;
 
-            omega.AddIndexValues(this->halo_, send_buffer);
+        this->ExtractHostCSR_(&int_ptr, &int_col, &int_val, &gst_ptr, &gst_col, &gst_val);
 
-            // Pack updated omega
-            omega.GetIndexValues(this->halo_, &send_buffer);
-            send_buffer.CopyToHostData(hsend_buffer);
+        int64_t int_nnz = int_ptr[local_nrow];
+        int64_t gst_nnz = gst_ptr[local_nrow];
 
-            // Receive updated omega from neighbors
-            this->pm_->CommunicateAsync_(hsend_buffer, hrecv_buffer);
+        assert(connections.GetSize() == int_nnz + gst_nnz);
 
-            // Allocate CF mapping
-            CFmap->Allocate("CF map", int_ptr->GetM() + nrecv);
+        free_host(&gst_ptr);
+        free_host(&gst_col);
+        free_host(&gst_val);
 
-            // Mark all vertices as undecided
-            CFmap->Zeros();
+        // Greedy aggregation of the interior couplings
+        std::vector<int> local_agg(local_nrow, -2);
 
-            LocalVector<bool> marked;
-            marked.CloneBackend(*this);
-            marked.Allocate("marked coarse", int_ptr->GetM() + nrecv);
+        if(int_nnz > 0)
+        {
+            std::vector<int> conn(int_nnz + gst_nnz);
+            connections.CopyToHostData(conn.data());
 
-            // Synchronize
-            this->pm_->CommunicateSync_();
+            LocalMatrix<ValueType> interior;
+            interior.SetDataPtrCSR(
+                &int_ptr, &int_col, &int_val, "interior", int_nnz, local_nrow, local_nrow);
 
-            // Update omega with received omega from neighbors
-            omega.SetContinuousValues(int_ptr->GetM(), omega.GetSize(), hrecv_buffer);
+            LocalVector<int> int_conn;
+            int_conn.Allocate("interior connections", int_nnz);
+            int_conn.CopyFromHostData(conn.data());
 
-            // Iteratively find coarse and fine vertices until all undecided vertices have
-            // been marked (JPL approach)
-            int iter = 0;
+            LocalVector<int> int_agg;
+            interior.AMGAggregate(int_conn, &int_agg);
 
-            while(true)
-            {
-                // First, mark all vertices that have not been assigned yet, as coarse
-                int_ptr->matrix_->RSPMISUnassignedToCoarse(
-                    CFmap->vector_, marked.vector_, *omega.vector_);
+            int_agg.CopyToHostData(local_agg.data());
+        }
 
-                // Now, correct previously marked vertices with respect to omega
-                int_ptr->matrix_->RSPMISCorrectCoarse(CFmap->vector_,
-                                                      *S->vector_,
-                                                      *marked.vector_,
-                                                      *omega.vector_,
-                                                      *gst_ptr->matrix_);
+        free_host(&int_ptr);
+        free_host(&int_col);
+        free_host(&int_val);
 
-                // Communicate ghost CF map to neighbors and update interior CF map with data
-                // received from neighbors
+        // Number the aggregates consecutively across the processes and determine
+        // their root nodes
+        int nagg = 0;
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            nagg = std::max(nagg, local_agg[i] + 1);
+        }
 
-                // Prepare send buffer
-                CFmap->GetContinuousValues(int_ptr->GetM(), CFmap->GetSize(), hirecv_buffer);
+        int64_t agg_begin
+            = process_offset(nagg, this->pm_->rank_, this->pm_->num_procs_, this->pm_->comm_);
 
-                // Send CF map to neighbors
-                this->pm_->InverseCommunicateAsync_(hirecv_buffer, hisend_buffer);
+        std::vector<int64_t> root(nagg, -1);
+        std::vector<int64_t> agg(local_nrow);
+        std::vector<int64_t> agg_root(local_nrow);
 
-                // Synchronize
-                this->pm_->InverseCommunicateSync_();
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            int g = local_agg[i];
 
-                // Update interior CF map with data received and pack send buffer
-                LocalVector<int> isend_buffer;
-                isend_buffer.CloneBackend(*this);
-                isend_buffer.Allocate("int send buffer", nsend);
-                isend_buffer.CopyFromHostData(hisend_buffer);
+            if(g >= 0 && root[g] < 0)
+            {
+                root[g] = row_begin + i;
+            }
+        }
 
-                CFmap->vector_->RSPMISUpdateCFmap(*this->halo_.vector_, isend_buffer.vector_);
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            int g = local_agg[i];
 
-                isend_buffer.CopyToHostData(hisend_buffer);
+            agg[i]      = (g >= 0) ? agg_begin + g : g;
+            agg_root[i] = (g >= 0) ? root[g] : -1;
+        }
 
-                // Receive updated CF map from neighbors
-                this->pm_->CommunicateAsync_(hisend_buffer, hirecv_buffer);
+        aggregates->Clear();
+        aggregates->Allocate("aggregates", local_nrow);
+        aggregates->CopyFromHostData(agg.data());
 
-                // Synchronize
-                this->pm_->CommunicateSync_();
+        aggregate_root_nodes->Clear();
+        aggregate_root_nodes->Allocate("aggregate root nodes", local_nrow);
+        aggregate_root_nodes->CopyFromHostData(agg_root.data());
+#endif
+    }
 
-                // Update CFmap with received CFmap from neighbors
-                CFmap->SetContinuousValues(int_ptr->GetM(), CFmap->GetSize(), hirecv_buffer);
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::AMGPMISAggregate(
+        const LocalVector<int>& connections,
+        LocalVector<int64_t>*   aggregates,
+        LocalVector<int64_t>*   aggregate_root_nodes) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::AMGPMISAggregate()",
+                  (const void*&)connections,
+                  aggregates,
+                  aggregate_root_nodes);
 
-                // Mark remaining edges of a coarse point to fine
-                int_ptr->matrix_->RSPMISCoarseEdgesToFine(
-                    CFmap->vector_, *S->vector_, *gst_ptr->matrix_);
+        assert(aggregates != NULL);
+        assert(aggregate_root_nodes != NULL);
+        assert(this->pm_ != NULL);
 
-                // Pack updated CF map for communication
-                CFmap->GetIndexValues(this->halo_, &isend_buffer);
-                isend_buffer.CopyToHostData(hisend_buffer);
+#ifdef SUPPORT_MULTINODE
+        int64_t local_nrow = this->pm_->local_nrow_;
+        int     nghost     = this->pm_->GetNumReceivers();
+        int64_t row_begin  = process_offset(
+            local_nrow, this->pm_->rank_, this->pm_->num_procs_, this->pm_->comm_);
 
-                // Communicate
-                this->pm_->CommunicateAsync_(hisend_buffer, hirecv_buffer);
+        // Single process managers carry no communication pattern and have no ghosts
+        const int64_t* ghost_map
+            = (this->pm_->num_procs_ > 1) ? this->pm_->GetGhostToGlobalMap() : NULL;
 
-                // Now, we need to check whether we have vertices left that are marked
-                // undecided, in order to restart the loop
-                bool undecided;
-                int_ptr->matrix_->RSPMISCheckUndecided(undecided, *CFmap->vector_);
+        PtrType*   int_ptr = NULL;
+        int*       int_col = NULL;
+        ValueType* int_val = NULL;
+        PtrType*   gst_ptr = NULL;
+        int*       gst_col = NULL;
+        ValueType* gst_val = NULL;
 
-                // Get global number of undecided vertices
-                int local_undecided = undecided;
-                int global_undecided;
+        this->ExtractHostCSR_(&int_ptr, &int_col, &int_val, &gst_ptr, &gst_col, &gst_val);
 
-#ifdef SUPPORT_MULTINODE
-                MRequest req;
-                communication_async_allreduce_single_max(
-                    &local_undecided, &global_undecided, this->pm_->GetComm(), &req);
-#endif
+        free_host(&int_val);
+        free_host(&gst_val);
 
-                // Synchronize
-                this->pm_->CommunicateSync_();
+        int64_t int_nnz = int_ptr[local_nrow];
+        int64_t gst_nnz = gst_ptr[local_nrow];
 
-                // Update CFmap with received CFmap from neighbors
-                CFmap->SetContinuousValues(int_ptr->GetM(), CFmap->GetSize(), hirecv_buffer);
+        assert(connections.GetSize() == int_nnz + gst_nnz);
 
-#ifdef SUPPORT_MULTINODE
-                communication_sync(&req);
-#endif
+        std::vector<int> conn(int_nnz + gst_nnz);
+        connections.CopyToHostData(conn.data());
 
-                // If no more undecided vertices are left, we are done
-                if(global_undecided == 0)
-                {
-                    break;
-                }
+        const int* gst_conn = conn.data() + int_nnz;
 
-                ++iter;
+        // States: 1 aggregated, 0 undecided, -1 removed, -2 without strong couplings
+        std::vector<int> state(local_nrow);
+        std::vector<int> ghost_state(nghost);
 
-                // Print some warning if number of iteration is getting huge
-                if(iter > 20)
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            state[i] = -2;
+
+            for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+            {
+                if(conn[j] == 1)
                 {
-                    LOG_VERBOSE_INFO(2,
-                                     "*** warning: GlobalMatrix::RSPMISCoarsening() Current "
-                                     "number of iterations: "
-                                         << iter);
+                    state[i] = 0;
                 }
             }
 
-            free_host(&hsend_buffer);
-            free_host(&hrecv_buffer);
-            free_host(&hisend_buffer);
-            free_host(&hirecv_buffer);
-
-            omega.Clear();
+            for(PtrType j = gst_ptr[i]; j < gst_ptr[i + 1]; ++j)
+            {
+                if(gst_conn[j] == 1)
+                {
+                    state[i] = 0;
+                }
+            }
         }
 
-        std::string CFmap_name = "CF map of " + this->object_name_;
-        std::string S_name     = "S of " + this->object_name_;
+        this->CommunicateBoundary_(state.data(), ghost_state.data());
 
-        CFmap->object_name_ = CFmap_name;
-        S->object_name_     = S_name;
+        // Maximum tuple in the distance one and distance two neighborhood
+        std::vector<int>     max1_state(local_nrow);
+        std::vector<int64_t> max1_idx(local_nrow);
+        std::vector<int>     ghost_max1_state(nghost);
+        std::vector<int64_t> ghost_max1_idx(nghost);
+        std::vector<int>     max2_state(local_nrow);
+        std::vector<int64_t> max2_idx(local_nrow);
 
-        if(this->GetFormat() != CSR)
+        int iter = 0;
+
+        while(true)
         {
-            LOG_VERBOSE_INFO(
-                2, "*** warning: GlobalMatrix::RSPMISCoarsening() is performed in CSR format");
-        }
-    }
+            for(int64_t i = 0; i < local_nrow; ++i)
+            {
+                int     s   = state[i];
+                int64_t idx = row_begin + i;
 
-    template <typename ValueType>
-    void GlobalMatrix<ValueType>::RSDirectInterpolation(const LocalVector<int>&  CFmap,
-                                                        const LocalVector<bool>& S,
-                                                        GlobalMatrix<ValueType>* prolong) const
-    {
-        log_debug(this,
-                  "GlobalMatrix::RSDirectInterpolation()",
-                  (const void*&)CFmap,
-                  (const void*&)S,
-                  prolong);
+                for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+                {
+                    int c = int_col[j];
 
-        assert(prolong != NULL);
-        assert(this != prolong);
-        assert(prolong->GetFormat() == CSR);
+                    if(conn[j] == 1 && pmis_greater(state[c], row_begin + c, s, idx))
+                    {
+                        s   = state[c];
+                        idx = row_begin + c;
+                    }
+                }
 
-        assert(this->is_host_() == prolong->is_host_());
-        assert(this->is_host_() == CFmap.is_host_());
-        assert(this->is_host_() == S.is_host_());
+                for(PtrType j = gst_ptr[i]; j < gst_ptr[i + 1]; ++j)
+                {
+                    int c = gst_col[j];
 
-#ifdef DEBUG_MODE
-        this->Check();
-#endif
+                    if(gst_conn[j] == 1 && pmis_greater(ghost_state[c], ghost_map[c], s, idx))
+                    {
+                        s   = ghost_state[c];
+                        idx = ghost_map[c];
+                    }
+                }
 
-        // Calling global routine with single process
-        if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
-        {
-            this->matrix_interior_.RSDirectInterpolation(CFmap, S, &prolong->matrix_interior_);
+                max1_state[i] = s;
+                max1_idx[i]   = idx;
+            }
 
-            // Prolongation PM
-            prolong->CreateParallelManager_();
-            prolong->pm_self_->SetMPICommunicator(this->pm_->comm_);
+            this->CommunicateBoundary_(max1_state.data(), ghost_max1_state.data());
+            this->CommunicateBoundary_(max1_idx.data(), ghost_max1_idx.data());
 
-            prolong->pm_self_->SetGlobalNrow(prolong->matrix_interior_.GetM());
-            prolong->pm_self_->SetGlobalNcol(prolong->matrix_interior_.GetN());
+            for(int64_t i = 0; i < local_nrow; ++i)
+            {
+                int     s   = max1_state[i];
+                int64_t idx = max1_idx[i];
 
-            prolong->pm_self_->SetLocalNrow(prolong->matrix_interior_.GetM());
-            prolong->pm_self_->SetLocalNcol(prolong->matrix_interior_.GetN());
+                for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+                {
+                    int c = int_col[j];
 
-            return;
-        }
+                    if(conn[j] == 1 && pmis_greater(max1_state[c], max1_idx[c], s, idx))
+                    {
+                        s   = max1_state[c];
+                        idx = max1_idx[c];
+                    }
+                }
 
-        // Only CSR matrices are supported
-        LocalMatrix<ValueType> csr_int;
-        LocalMatrix<ValueType> csr_gst;
+                for(PtrType j = gst_ptr[i]; j < gst_ptr[i + 1]; ++j)
+                {
+                    int c = gst_col[j];
+
+                    if(gst_conn[j] == 1
+                       && pmis_greater(ghost_max1_state[c], ghost_max1_idx[c], s, idx))
+                    {
+                        s   = ghost_max1_state[c];
+                        idx = ghost_max1_idx[c];
+                    }
+                }
 
-        const LocalMatrix<ValueType>* int_ptr = &this->matrix_interior_;
-        const LocalMatrix<ValueType>* gst_ptr = &this->matrix_ghost_;
+                max2_state[i] = s;
+                max2_idx[i]   = idx;
+            }
 
-        if(int_ptr->GetFormat() != CSR)
-        {
-            csr_int.CloneFrom(*int_ptr);
-            csr_int.ConvertToCSR();
-            int_ptr = &csr_int;
+            // Undecided nodes that are the maximum of their neighborhood become roots,
+            // undecided nodes close to a root are removed
+            int local_undecided = 0;
+
+            for(int64_t i = 0; i < local_nrow; ++i)
+            {
+                if(state[i] == 0)
+                {
+                    if(max2_idx[i] == row_begin + i)
+                    {
+                        state[i] = 1;
+                    }
+                    else if(max2_state[i] == 1)
+                    {
+                        state[i] = -1;
+                    }
+                    else
+                    {
+                        local_undecided = 1;
+                    }
+                }
+            }
+
+            this->CommunicateBoundary_(state.data(), ghost_state.data());
+
+            int global_undecided;
+            communication_sync_allreduce_single_max(
+                &local_undecided, &global_undecided, this->pm_->comm_);
+
+            if(global_undecided == 0)
+            {
+                break;
+            }
+
+            ++iter;
+
+            if(iter > 10)
+            {
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: GlobalMatrix::AMGPMISAggregate() Current number "
+                                 "of iterations: "
+                                     << iter);
+            }
         }
 
-        if(gst_ptr->GetFormat() != CSR)
+        // Number the roots consecutively across the processes
+        int64_t nroot = 0;
+        for(int64_t i = 0; i < local_nrow; ++i)
         {
-            csr_gst.CloneFrom(*gst_ptr);
-            csr_gst.ConvertToCSR();
-            gst_ptr = &csr_gst;
+            nroot += (state[i] == 1);
         }
 
-        // Start with fresh P operator
-        prolong->Clear();
+        int64_t agg_begin
+            = process_offset(nroot, this->pm_->rank_, this->pm_->num_procs_, this->pm_->comm_);
 
-        // fine to coarse map
-        LocalVector<int> f2c_map;
-        f2c_map.CloneBackend(*this);
-        f2c_map.Allocate("f2c map", int_ptr->GetM() + 1);
+        std::vector<int64_t> agg(local_nrow, -2);
+        std::vector<int64_t> agg_root(local_nrow, -1);
+        std::vector<int64_t> ghost_agg(nghost);
+        std::vector<int64_t> ghost_agg_root(nghost);
 
-        // Amin/max
-        LocalVector<ValueType> Amin;
-        LocalVector<ValueType> Amax;
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            if(state[i] == 1)
+            {
+                agg[i]      = agg_begin++;
+                agg_root[i] = row_begin + i;
+            }
+        }
 
-        Amin.CloneBackend(*this);
-        Amax.CloneBackend(*this);
+        // Removed nodes join the aggregate of a strongly coupled neighbor, every removed
+        // node is at most two couplings away from a root
+        std::vector<int> prev_state(local_nrow);
 
-        Amin.Allocate("A min", int_ptr->GetM());
-        Amax.Allocate("A max", int_ptr->GetM());
+        for(int k = 0; k < 2; ++k)
+        {
+            if(k > 0)
+            {
+                this->CommunicateBoundary_(state.data(), ghost_state.data());
+            }
 
-        // Determine number of non-zeros for P
-        int_ptr->matrix_->RSDirectProlongNnz(*CFmap.vector_,
-                                             *S.vector_,
-                                             *gst_ptr->matrix_,
-                                             Amin.vector_,
-                                             Amax.vector_,
-                                             f2c_map.vector_,
-                                             prolong->matrix_interior_.matrix_,
-                                             prolong->matrix_ghost_.matrix_);
+            this->CommunicateBoundary_(agg.data(), ghost_agg.data());
+            this->CommunicateBoundary_(agg_root.data(), ghost_agg_root.data());
 
-        // Obtain the local to global ghost mapping
-        LocalVector<int64_t> l2g;
-        l2g.CloneBackend(*this);
-        l2g.Allocate("l2g ghost map", this->pm_->GetNumReceivers());
-        l2g.CopyFromHostData(this->pm_->GetGhostToGlobalMap());
+            prev_state = state;
 
-        // Temporary array to store global ghost columns
-        LocalVector<int64_t> ghost_col;
-        ghost_col.CloneBackend(*this);
+            for(int64_t i = 0; i < local_nrow; ++i)
+            {
+                if(prev_state[i] != -1)
+                {
+                    continue;
+                }
 
-        // Fill column indices and values of P
-        int_ptr->matrix_->RSDirectProlongFill(*l2g.vector_,
-                                              *f2c_map.vector_,
-                                              *CFmap.vector_,
-                                              *S.vector_,
-                                              *gst_ptr->matrix_,
-                                              *Amin.vector_,
-                                              *Amax.vector_,
-                                              prolong->matrix_interior_.matrix_,
-                                              prolong->matrix_ghost_.matrix_,
-                                              ghost_col.vector_);
+                for(PtrType j = int_ptr[i]; j < int_ptr[i + 1] && state[i] != 1; ++j)
+                {
+                    int c = int_col[j];
+
+                    if(conn[j] == 1 && prev_state[c] == 1)
+                    {
+                        agg[i]      = agg[c];
+                        agg_root[i] = agg_root[c];
+                        state[i]    = 1;
+                    }
+                }
 
-        Amin.Clear();
-        Amax.Clear();
+                for(PtrType j = gst_ptr[i]; j < gst_ptr[i + 1] && state[i] != 1; ++j)
+                {
+                    int c = gst_col[j];
+
+                    if(gst_conn[j] == 1 && ghost_state[c] == 1)
+                    {
+                        agg[i]      = ghost_agg[c];
+                        agg_root[i] = ghost_agg_root[c];
+                        state[i]    = 1;
+                    }
+                }
+            }
+        }
 
-        // Ghost of P MUST be CSR
-        assert(prolong->matrix_ghost_.GetFormat() == CSR);
+        free_host(&int_ptr);
+        free_host(&int_col);
+        free_host(&gst_ptr);
+        free_host(&gst_col);
 
-        // Communicate global sizes of P
-        int64_t global_ncol;
-        int64_t local_ncol = prolong->GetLocalN();
+        aggregates->Clear();
+        aggregates->Allocate("aggregates", local_nrow);
+        aggregates->CopyFromHostData(agg.data());
 
-#ifdef SUPPORT_MULTINODE
-        MRequest req;
-        communication_async_allreduce_single_sum(&local_ncol, &global_ncol, this->pm_->comm_, &req);
+        aggregate_root_nodes->Clear();
+        aggregate_root_nodes->Allocate("aggregate root nodes", local_nrow);
+        aggregate_root_nodes->CopyFromHostData(agg_root.data());
 #endif
+    }
 
-        // Setup parallel manager of P
-        prolong->CreateParallelManager_();
-        prolong->pm_self_->SetMPICommunicator(this->pm_->comm_);
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::AMGSmoothedAggregation(
+        ValueType                   relax,
+        const LocalVector<int64_t>& aggregates,
+        const LocalVector<int64_t>& aggregate_root_nodes,
+        const LocalVector<int>&     connections,
+        GlobalMatrix<ValueType>*    prolong,
+        int                         lumping_strat) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::AMGSmoothedAggregation()",
+                  relax,
+                  (const void*&)aggregates,
+                  (const void*&)aggregate_root_nodes,
+                  (const void*&)connections,
+                  prolong,
+                  lumping_strat);
 
-        // To generate the parallel manager, we need to access the sorted global ghost column ids
-        LocalVector<int64_t> sorted_ghost_col;
-        sorted_ghost_col.CloneBackend(*this);
-        sorted_ghost_col.Allocate("sorted global ghost columns", ghost_col.GetSize());
+        assert(prolong != NULL);
+        assert(prolong != this);
+        assert(this->pm_ != NULL);
 
-        // Sort the global ghost columns (we do not need the permutation vector)
-        ghost_col.Sort(&sorted_ghost_col, NULL);
+#ifdef SUPPORT_MULTINODE
+        int64_t local_nrow = this->pm_->local_nrow_;
+        int     nghost     = this->pm_->GetNumReceivers();
 
-        // Get the sorted ghost columns on host
-        int64_t* pghost_col = NULL;
-        sorted_ghost_col.MoveToHost();
-        sorted_ghost_col.LeaveDataPtr(&pghost_col);
+        assert(aggregates.GetSize() == local_nrow);
+        assert(aggregate_root_nodes.GetSize() == local_nrow);
 
-#ifdef SUPPORT_MULTINODE
-        communication_sync(&req);
-#endif
+        PtrType*   int_ptr = NULL;
+        int*       int_col = NULL;
+        ValueType* int_val = NULL;
+        PtrType*   gst_ptr = NULL;
+        int*       gst_col = NULL;
+        ValueType* gst_val = NULL;
 
-        // Sizes
-        prolong->pm_self_->SetGlobalNrow(this->pm_->global_nrow_);
-        prolong->pm_self_->SetGlobalNcol(global_ncol);
-        prolong->pm_self_->SetLocalNrow(this->pm_->local_nrow_);
-        prolong->pm_self_->SetLocalNcol(local_ncol);
+        this->ExtractHostCSR_(&int_ptr, &int_col, &int_val, &gst_ptr, &gst_col, &gst_val);
 
-        // Generate the PM
-        prolong->pm_self_->GenerateFromGhostColumnsWithParent_(
-            prolong->matrix_ghost_.GetNnz(), pghost_col, *this->pm_);
+        int64_t int_nnz = int_ptr[local_nrow];
+        int64_t gst_nnz = gst_ptr[local_nrow];
 
-        // Communicate global offsets
-        prolong->pm_self_->CommunicateGlobalOffsetAsync_();
+        assert(connections.GetSize() == int_nnz + gst_nnz);
 
-        // This is a prolongation operator, means we need to convert the global
-        // fine boundary columns from to local coarse columns
-        int* f2c = NULL;
-        f2c_map.MoveToHost();
-        f2c_map.LeaveDataPtr(&f2c);
+        std::vector<int> conn(int_nnz + gst_nnz);
+        connections.CopyToHostData(conn.data());
 
-        // Clear
-        free_host(&pghost_col);
+        const int* gst_conn = conn.data() + int_nnz;
 
-        // Sync global offsets communication
-        prolong->pm_self_->CommunicateGlobalOffsetSync_();
+        std::vector<int64_t> agg(local_nrow);
+        std::vector<int64_t> agg_root(local_nrow);
+        std::vector<int64_t> ghost_agg(nghost);
 
-        // Convert local boundary columns from global fine to local coarse
-        prolong->pm_self_->BoundaryTransformGlobalFineToLocalCoarse_(f2c);
+        aggregates.CopyToHostData(agg.data());
+        aggregate_root_nodes.CopyToHostData(agg_root.data());
 
-        // Communicate ghost to global map
-        prolong->pm_self_->CommunicateGhostToGlobalMapAsync_();
+        // Aggregates of the ghost rows
+        this->CommunicateBoundary_(agg.data(), ghost_agg.data());
 
-        // Clear
-        free_host(&f2c);
+        // Each process owns the aggregates of its root nodes
+        int64_t row_begin = process_offset(
+            local_nrow, this->pm_->rank_, this->pm_->num_procs_, this->pm_->comm_);
+        int64_t nagg      = 0;
 
-        // Finally, renumber ghost columns (from global to local)
-        // We couldn't do this earlier, because the parallel manager need
-        // to know the global ghost column ids
-        prolong->matrix_ghost_.matrix_->RenumberGlobalToLocal(*ghost_col.vector_);
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            nagg += (agg_root[i] == row_begin + i);
+        }
 
-        // Synchronize
-        prolong->pm_self_->CommunicateGhostToGlobalMapSync_();
+        int64_t global_nagg;
+        communication_sync_allreduce_single_sum(&nagg, &global_nagg, this->pm_->comm_);
 
-        prolong->SetParallelManager(*prolong->pm_self_);
+        // Rows of the prolongation with global aggregate columns
+        std::vector<std::pair<int64_t, ValueType>> row;
 
-        // Rename P
-        prolong->object_name_ = "Prolongation Operator of " + this->object_name_;
+        std::vector<PtrType>   p_ptr(local_nrow + 1, 0);
+        std::vector<int64_t>   p_col;
+        std::vector<ValueType> p_val;
 
-        if(this->GetFormat() != CSR)
+        for(int64_t i = 0; i < local_nrow; ++i)
         {
-            LOG_VERBOSE_INFO(
-                2, "*** warning: GlobalMatrix::RSDirectInterpolation() is performed in CSR format");
+            // Diagonal of the filtered matrix is original matrix diagonal plus (lumping_strat = 0)
+            // or minus (lumping_strat = 1) its weak connections.
+            ValueType dia = static_cast<ValueType>(0);
+
+            for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+            {
+                if(int_col[j] == i)
+                {
+                    dia += int_val[j];
+                }
+                else if(!conn[j])
+                {
+                    dia += (lumping_strat == 0) ? int_val[j] : -int_val[j];
+                }
+            }
+
+            for(PtrType j = gst_ptr[i]; j < gst_ptr[i + 1]; ++j)
+            {
+                if(!gst_conn[j])
+                {
+                    dia += (lumping_strat == 0) ? gst_val[j] : -gst_val[j];
+                }
+            }
+
+            dia = static_cast<ValueType>(1) / dia;
+
+            row.clear();
+
+            // Skip weak couplings and the ones not in any aggregate
+            for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+            {
+                int c = int_col[j];
+
+                if((c != i && !conn[j]) || agg[c] < 0)
+                {
+                    continue;
+                }
+
+                ValueType v = (c == i) ? static_cast<ValueType>(1) - relax
+                                       : -relax * dia * int_val[j];
+
+                row.push_back(std::make_pair(agg[c], v));
+            }
+
+            for(PtrType j = gst_ptr[i]; j < gst_ptr[i + 1]; ++j)
+            {
+                int c = gst_col[j];
+
+                if(!gst_conn[j] || ghost_agg[c] < 0)
+                {
+                    continue;
+                }
+
+                row.push_back(std::make_pair(ghost_agg[c], -relax * dia * gst_val[j]));
+            }
+
+            std::sort(row.begin(),
+                      row.end(),
+                      [](const std::pair<int64_t, ValueType>& a,
+                         const std::pair<int64_t, ValueType>& b) { return a.first < b.first; });
+
+            for(size_t j = 0; j < row.size(); ++j)
+            {
+                if(j > 0 && row[j].first == row[j - 1].first)
+                {
+                    p_val.back() += row[j].second;
+                }
+                else
+                {
+                    p_col.push_back(row[j].first);
+                    p_val.push_back(row[j].second);
+                }
+            }
+
+            p_ptr[i + 1] = static_cast<PtrType>(p_col.size());
         }
 
-#ifdef DEBUG_MODE
-        prolong->Check();
+        free_host(&int_ptr);
+        free_host(&int_col);
+        free_host(&int_val);
+        free_host(&gst_ptr);
+        free_host(&gst_col);
+        free_host(&gst_val);
+
+        prolong->GenerateFromGlobalRows_(this->pm_->comm_,
+                                         this->pm_->global_nrow_,
+                                         global_nagg,
+                                         local_nrow,
+                                         nagg,
+                                         p_ptr.data(),
+                                         p_col.data(),
+                                         p_val.data(),
+                                         "Prolongation of " + this->object_name_);
 #endif
     }
 
     template <typename ValueType>
-    void GlobalMatrix<ValueType>::RSExtPIInterpolation(const LocalVector<int>&  CFmap,
-                                                       const LocalVector<bool>& S,
-                                                       bool                     FF1,
-                                                       GlobalMatrix<ValueType>* prolong) const
+    void GlobalMatrix<ValueType>::AMGAggregation(const LocalVector<int64_t>& aggregates,
+                                                 const LocalVector<int64_t>& aggregate_root_nodes,
+                                                 GlobalMatrix<ValueType>*    prolong) const
     {
         log_debug(this,
-                  "GlobalMatrix::RSExtPIInterpolation()",
-                  (const void*&)CFmap,
-                  (const void*&)S,
-                  FF1,
+                  "GlobalMatrix::AMGAggregation()",
+                  (const void*&)aggregates,
+                  (const void*&)aggregate_root_nodes,
                   prolong);
 
         assert(prolong != NULL);
-        assert(this != prolong);
+        assert(prolong != this);
+        assert(this->pm_ != NULL);
 
-        assert(prolong->GetFormat() == CSR);
+#ifdef SUPPORT_MULTINODE
+        int64_t local_nrow = this->pm_->local_nrow_;
 
-        assert(this->is_host_() == prolong->is_host_());
-        assert(this->is_host_() == CFmap.is_host_());
-        assert(this->is_host_() == S.is_host_());
+        assert(aggregates.GetSize() == local_nrow);
+        assert(aggregate_root_nodes.GetSize() == local_nrow);
 
-#ifdef DEBUG_MODE
-        this->Check();
-#endif
+        std::vector<int64_t> agg(local_nrow);
+        std::vector<int64_t> agg_root(local_nrow);
 
-        // Calling global routine with single process
-        if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
+        aggregates.CopyToHostData(agg.data());
+        aggregate_root_nodes.CopyToHostData(agg_root.data());
+
+        // Each process owns the aggregates of its root nodes
+        int64_t row_begin = process_offset(
+            local_nrow, this->pm_->rank_, this->pm_->num_procs_, this->pm_->comm_);
+        int64_t nagg      = 0;
+
+        for(int64_t i = 0; i < local_nrow; ++i)
         {
-            this->matrix_interior_.RSExtPIInterpolation(CFmap, S, FF1, &prolong->matrix_interior_);
+            nagg += (agg_root[i] == row_begin + i);
+        }
 
-            // Prolongation PM
-            prolong->CreateParallelManager_();
-            prolong->pm_self_->SetMPICommunicator(this->pm_->comm_);
+        int64_t global_nagg;
+        communication_sync_allreduce_single_sum(&nagg, &global_nagg, this->pm_->comm_);
 
-            prolong->pm_self_->SetGlobalNrow(prolong->matrix_interior_.GetM());
-            prolong->pm_self_->SetGlobalNcol(prolong->matrix_interior_.GetN());
+        // Each aggregated row interpolates from its aggregate only
+        std::vector<PtrType>   p_ptr(local_nrow + 1, 0);
+        std::vector<int64_t>   p_col;
+        std::vector<ValueType> p_val;
 
-            prolong->pm_self_->SetLocalNrow(prolong->matrix_interior_.GetM());
-            prolong->pm_self_->SetLocalNcol(prolong->matrix_interior_.GetN());
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            if(agg[i] >= 0)
+            {
+                p_col.push_back(agg[i]);
+                p_val.push_back(static_cast<ValueType>(1));
+            }
 
-            return;
+            p_ptr[i + 1] = static_cast<PtrType>(p_col.size());
         }
 
-        // Only CSR matrices are supported
-        LocalMatrix<ValueType> csr_int;
-        LocalMatrix<ValueType> csr_gst;
+        prolong->GenerateFromGlobalRows_(this->pm_->comm_,
+                                         this->pm_->global_nrow_,
+                                         global_nagg,
+                                         local_nrow,
+                                         nagg,
+                                         p_ptr.data(),
+                                         p_col.data(),
+                                         p_val.data(),
+                                         "Prolongation of " + this->object_name_);
+#endif
+    }
 
-        const LocalMatrix<ValueType>* int_ptr = &this->matrix_interior_;
-        const LocalMatrix<ValueType>* gst_ptr = &this->matrix_ghost_;
+#ifdef SUPPORT_MULTINODE
+    // Smallest positive color that does not appear in the given neighbor colors
+    static int smallest_free_color(std::vector<int>& neighbor_colors)
+    {
+        std::sort(neighbor_colors.begin(), neighbor_colors.end());
 
-        if(int_ptr->GetFormat() != CSR)
+        int color = 1;
+        for(size_t k = 0; k < neighbor_colors.size(); ++k)
         {
-            csr_int.CloneFrom(*int_ptr);
-            csr_int.ConvertToCSR();
-            int_ptr = &csr_int;
+            if(neighbor_colors[k] == color)
+            {
+                ++color;
+            }
+            else if(neighbor_colors[k] > color)
+            {
+                break;
+            }
         }
 
-        if(gst_ptr->GetFormat() != CSR)
-        {
-            csr_gst.CloneFrom(*gst_ptr);
-            csr_gst.ConvertToCSR();
-            gst_ptr = &csr_gst;
-        }
+        return color;
+    }
+#endif
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::MultiColoring(int&              num_colors,
+                                                int**             size_colors,
+                                                LocalVector<int>* permutation) const
+    {
+        log_debug(this, "GlobalMatrix::MultiColoring()", num_colors, size_colors, permutation);
+
+        assert(*size_colors == NULL);
+        assert(permutation != NULL);
+        assert(this->pm_ != NULL);
+        assert(this->pm_->global_nrow_ == this->pm_->global_ncol_);
+
+        // Calling local routine with single process
+        if(this->pm_->num_procs_ == 1)
+        {
+            this->matrix_interior_.MultiColoring(num_colors, size_colors, permutation);
+
+            return;
+        }
+
+#ifdef SUPPORT_MULTINODE
+        int64_t local_nrow = this->pm_->local_nrow_;
+        int     nghost     = this->pm_->GetNumReceivers();
+        int64_t row_begin  = process_offset(
+            local_nrow, this->pm_->rank_, this->pm_->num_procs_, this->pm_->comm_);
+
+        const int64_t* ghost_map = this->pm_->GetGhostToGlobalMap();
+
+        PtrType*   int_ptr = NULL;
+        int*       int_col = NULL;
+        ValueType* int_val = NULL;
+        PtrType*   gst_ptr = NULL;
+        int*       gst_col = NULL;
+        ValueType* gst_val = NULL;
+
+        this->ExtractHostCSR_(&int_ptr, &int_col, &int_val, &gst_ptr, &gst_col, &gst_val);
+
+        free_host(&int_val);
+        free_host(&gst_val);
+
+        int64_t int_nnz = int_ptr[local_nrow];
+
+        // Transposed interior structure, such that non-symmetric couplings are respected
+        std::vector<PtrType> csc_ptr(local_nrow + 1, 0);
+        std::vector<int>     csc_ind(int_nnz);
+
+        for(int64_t j = 0; j < int_nnz; ++j)
+        {
+            ++csc_ptr[int_col[j] + 1];
+        }
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            csc_ptr[i + 1] += csc_ptr[i];
+        }
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+            {
+                csc_ind[csc_ptr[int_col[j]]++] = static_cast<int>(i);
+            }
+        }
+
+        for(int64_t i = local_nrow; i > 0; --i)
+        {
+            csc_ptr[i] = csc_ptr[i - 1];
+        }
+
+        csc_ptr[0] = 0;
+
+        // Colors of the local and the ghost rows, 0 marks an uncolored row
+        std::vector<int> color(local_nrow, 0);
+        std::vector<int> ghost_color(nghost, 0);
+        std::vector<int> neighbor_colors;
+
+        // Rows with ghost couplings are colored first by a distributed Jones-Plassmann
+        // scheme, where the global row index determines the priority of a row
+        std::vector<int> selected;
+        int64_t          boundary_uncolored = 0;
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            if(gst_ptr[i + 1] > gst_ptr[i])
+            {
+                ++boundary_uncolored;
+            }
+        }
+
+        while(true)
+        {
+            int64_t global_uncolored;
+            communication_sync_allreduce_single_sum(
+                &boundary_uncolored, &global_uncolored, this->pm_->comm_);
+
+            if(global_uncolored == 0)
+            {
+                break;
+            }
+
+            selected.clear();
+
+            for(int64_t i = 0; i < local_nrow; ++i)
+            {
+                if(color[i] != 0 || gst_ptr[i + 1] == gst_ptr[i])
+                {
+                    continue;
+                }
+
+                int64_t gid       = row_begin + i;
+                bool    local_max = true;
+
+                // Uncolored boundary neighbors with higher priority
+                for(PtrType j = int_ptr[i]; j < int_ptr[i + 1] && local_max; ++j)
+                {
+                    int c = int_col[j];
+
+                    if(c != i && color[c] == 0 && gst_ptr[c + 1] > gst_ptr[c]
+                       && pmis_greater(0, row_begin + c, 0, gid))
+                    {
+                        local_max = false;
+                    }
+                }
+
+                for(PtrType j = csc_ptr[i]; j < csc_ptr[i + 1] && local_max; ++j)
+                {
+                    int c = csc_ind[j];
+
+                    if(c != i && color[c] == 0 && gst_ptr[c + 1] > gst_ptr[c]
+                       && pmis_greater(0, row_begin + c, 0, gid))
+                    {
+                        local_max = false;
+                    }
+                }
+
+                for(PtrType j = gst_ptr[i]; j < gst_ptr[i + 1] && local_max; ++j)
+                {
+                    int g = gst_col[j];
+
+                    if(ghost_color[g] == 0 && pmis_greater(0, ghost_map[g], 0, gid))
+                    {
+                        local_max = false;
+                    }
+                }
+
+                if(local_max == true)
+                {
+                    selected.push_back(static_cast<int>(i));
+                }
+            }
+
+            // Selected rows are independent and pick the smallest free color
+            for(size_t k = 0; k < selected.size(); ++k)
+            {
+                int i = selected[k];
+
+                neighbor_colors.clear();
+
+                for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+                {
+                    neighbor_colors.push_back(color[int_col[j]]);
+                }
+
+                for(PtrType j = csc_ptr[i]; j < csc_ptr[i + 1]; ++j)
+                {
+                    neighbor_colors.push_back(color[csc_ind[j]]);
+                }
+
+                for(PtrType j = gst_ptr[i]; j < gst_ptr[i + 1]; ++j)
+                {
+                    neighbor_colors.push_back(ghost_color[gst_col[j]]);
+                }
+
+                color[i] = smallest_free_color(neighbor_colors);
+            }
+
+            boundary_uncolored -= selected.size();
+
+            // Colors of the boundary rows
+            this->CommunicateBoundary_(color.data(), ghost_color.data());
+        }
+
+        // All remaining rows are colored greedily
+        int local_num_colors = 0;
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            if(color[i] == 0)
+            {
+                neighbor_colors.clear();
+
+                for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+                {
+                    neighbor_colors.push_back(color[int_col[j]]);
+                }
+
+                for(PtrType j = csc_ptr[i]; j < csc_ptr[i + 1]; ++j)
+                {
+                    neighbor_colors.push_back(color[csc_ind[j]]);
+                }
+
+                color[i] = smallest_free_color(neighbor_colors);
+            }
+
+            local_num_colors = std::max(local_num_colors, color[i]);
+        }
+
+        free_host(&int_ptr);
+        free_host(&int_col);
+        free_host(&gst_ptr);
+        free_host(&gst_col);
+
+        // All processes sweep over the same number of colors
+        communication_sync_allreduce_single_max(
+            &local_num_colors, &num_colors, this->pm_->comm_);
+
+        allocate_host(num_colors, size_colors);
+        set_to_zero_host(num_colors, *size_colors);
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            ++(*size_colors)[color[i] - 1];
+        }
+
+        // Order the local rows by color
+        std::vector<int> offsets_color(num_colors, 0);
+
+        for(int c = 1; c < num_colors; ++c)
+        {
+            offsets_color[c] = offsets_color[c - 1] + (*size_colors)[c - 1];
+        }
+
+        std::vector<int> perm(local_nrow);
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            perm[i] = offsets_color[color[i] - 1]++;
+        }
+
+        permutation->Clear();
+        permutation->Allocate("MultiColoring permutation of " + this->object_name_, local_nrow);
+        permutation->CopyFromHostData(perm.data());
+#endif
+    }
+
+#ifdef SUPPORT_MULTINODE
+    // Map global column indices of ghost columns to their ghost index
+    static void ghost_lookup_table(int                                    nghost,
+                                   const int64_t*                         ghost_map,
+                                   std::vector<std::pair<int64_t, int>>& table)
+    {
+        table.resize(nghost);
+
+        for(int i = 0; i < nghost; ++i)
+        {
+            table[i] = std::make_pair(ghost_map[i], i);
+        }
+
+        std::sort(table.begin(), table.end());
+    }
+
+    static int ghost_lookup(const std::vector<std::pair<int64_t, int>>& table, int64_t gid)
+    {
+        std::vector<std::pair<int64_t, int>>::const_iterator it
+            = std::lower_bound(table.begin(), table.end(), std::make_pair(gid, -1));
+
+        assert(it != table.end() && it->first == gid);
+
+        return it->second;
+    }
+#endif
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::FSAI(int power, const GlobalMatrix<ValueType>* pattern)
+    {
+        log_debug(this, "GlobalMatrix::FSAI()", power, pattern);
+
+        assert(power > 0);
+        assert(pattern != this);
+        assert(this->pm_ != NULL);
+        assert(this->GetM() == this->GetN());
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        // Calling local routine with single process
+        if(this->pm_->num_procs_ == 1)
+        {
+            this->matrix_interior_.FSAI(power,
+                                        (pattern != NULL) ? &pattern->matrix_interior_ : NULL);
+
+            return;
+        }
+
+#ifdef SUPPORT_MULTINODE
+        // Sparsity pattern of the factor, either external or given by A^power
+        const GlobalMatrix<ValueType>* structure = this;
+        GlobalMatrix<ValueType>*       mat_power = NULL;
+
+        if(pattern != NULL)
+        {
+            assert(pattern->pm_ != NULL);
+            assert(pattern->pm_->local_nrow_ == this->pm_->local_nrow_);
+
+            structure = pattern;
+        }
+        else
+        {
+            for(int p = 1; p < power; ++p)
+            {
+                GlobalMatrix<ValueType>* next = new GlobalMatrix<ValueType>;
+                next->CloneBackend(*this);
+                next->MatrixMult((mat_power != NULL) ? *mat_power : *this, *this);
+
+                delete mat_power;
+                mat_power = next;
+            }
+
+            if(mat_power != NULL)
+            {
+                structure = mat_power;
+            }
+        }
+
+        int64_t local_nrow = this->pm_->local_nrow_;
+        int64_t row_begin
+            = process_offset(local_nrow, this->pm_->rank_, this->pm_->num_procs_, this->pm_->comm_);
+
+        // Local rows of A and rows of A that belong to the ghost columns of the pattern
+        PtrType*   a_ptr = NULL;
+        int64_t*   a_col = NULL;
+        ValueType* a_val = NULL;
+        PtrType*   g_ptr = NULL;
+        int64_t*   g_col = NULL;
+        ValueType* g_val = NULL;
+
+        this->ExtractGlobalRows_(&a_ptr, &a_col, &a_val);
+        structure->FetchGhostRows_(a_ptr, a_col, a_val, &g_ptr, &g_col, &g_val);
+
+        std::vector<std::pair<int64_t, int>> ghost_table;
+        ghost_lookup_table(structure->pm_->GetNumReceivers(),
+                           structure->pm_->GetGhostToGlobalMap(),
+                           ghost_table);
+
+        // Rows of the pattern
+        PtrType*   p_ptr = NULL;
+        int64_t*   p_col = NULL;
+        ValueType* p_val = NULL;
+
+        structure->ExtractGlobalRows_(&p_ptr, &p_col, &p_val);
+
+        free_host(&p_val);
+        delete mat_power;
+
+        // Lower triangular part of the pattern, including the diagonal
+        std::vector<PtrType>   l_ptr(local_nrow + 1, 0);
+        std::vector<int64_t>   l_col;
+        std::vector<ValueType> l_val;
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            int64_t gid = row_begin + i;
+
+            for(PtrType j = p_ptr[i]; j < p_ptr[i + 1] && p_col[j] < gid; ++j)
+            {
+                l_col.push_back(p_col[j]);
+            }
+
+            l_col.push_back(gid);
+            l_ptr[i + 1] = static_cast<PtrType>(l_col.size());
+        }
+
+        free_host(&p_ptr);
+        free_host(&p_col);
+
+        l_val.resize(l_col.size());
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            PtrType        nnz_row = l_ptr[i + 1] - l_ptr[i];
+            const int64_t* J       = l_col.data() + l_ptr[i];
+
+            // Submatrix of A with rows and columns of the pattern of row i
+            std::vector<ValueType> Asub(nnz_row * nnz_row, static_cast<ValueType>(0));
+
+            for(PtrType k = 0; k < nnz_row; ++k)
+            {
+                const PtrType*   ptr = a_ptr;
+                const int64_t*   col = a_col;
+                const ValueType* val = a_val;
+                int64_t          row = J[k] - row_begin;
+
+                if(J[k] < row_begin || J[k] >= row_begin + local_nrow)
+                {
+                    ptr = g_ptr;
+                    col = g_col;
+                    val = g_val;
+                    row = ghost_lookup(ghost_table, J[k]);
+                }
+
+                for(PtrType aj = ptr[row]; aj < ptr[row + 1]; ++aj)
+                {
+                    const int64_t* pos = std::lower_bound(J, J + nnz_row, col[aj]);
+
+                    if(pos != J + nnz_row && *pos == col[aj])
+                    {
+                        Asub[(pos - J) + k * nnz_row] = val[aj];
+                    }
+                }
+            }
+
+            std::vector<ValueType> mk(nnz_row, static_cast<ValueType>(0));
+            mk[nnz_row - 1] = static_cast<ValueType>(1);
+
+            // compute inplace LU factorization of Asub
+            for(PtrType ii = 0; ii < nnz_row - 1; ++ii)
+            {
+                for(PtrType k = ii + 1; k < nnz_row; ++k)
+                {
+                    Asub[ii + k * nnz_row] /= Asub[ii + ii * nnz_row];
+
+                    for(PtrType j = ii + 1; j < nnz_row; ++j)
+                    {
+                        Asub[j + k * nnz_row] -= Asub[ii + k * nnz_row] * Asub[j + ii * nnz_row];
+                    }
+                }
+            }
+
+            // backward sweeps
+            for(PtrType ii = nnz_row - 1; ii >= 0; --ii)
+            {
+                mk[ii] /= Asub[ii + ii * nnz_row];
+
+                for(PtrType j = 0; j < ii; ++j)
+                {
+                    mk[j] -= mk[ii] * Asub[ii + j * nnz_row];
+                }
+            }
+
+            // Scaling
+            ValueType fac = std::sqrt(static_cast<ValueType>(1) / std::abs(mk[nnz_row - 1]));
+
+            for(PtrType k = 0; k < nnz_row; ++k)
+            {
+                l_val[l_ptr[i] + k] = mk[k] * fac;
+            }
+        }
+
+        free_host(&a_ptr);
+        free_host(&a_col);
+        free_host(&a_val);
+        free_host(&g_ptr);
+        free_host(&g_col);
+        free_host(&g_val);
+
+        std::string name = this->object_name_;
+
+        this->GenerateFromGlobalRows_(this->pm_->comm_,
+                                      this->pm_->global_nrow_,
+                                      this->pm_->global_ncol_,
+                                      local_nrow,
+                                      this->pm_->local_ncol_,
+                                      l_ptr.data(),
+                                      l_col.data(),
+                                      l_val.data(),
+                                      name);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::SPAI(void)
+    {
+        log_debug(this, "GlobalMatrix::SPAI()");
+
+        assert(this->pm_ != NULL);
+        assert(this->GetM() == this->GetN());
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        // Calling local routine with single process
+        if(this->pm_->num_procs_ == 1)
+        {
+            this->matrix_interior_.SPAI();
+
+            return;
+        }
+
+#ifdef SUPPORT_MULTINODE
+        // Column k of the approximate inverse M minimizes ||A m_k - e_k||, which only
+        // involves the rows of A^T that belong to the pattern of row k of A^T
+        GlobalMatrix<ValueType> AT;
+        AT.CloneBackend(*this);
+        this->Transpose(&AT);
+
+        int64_t local_nrow = AT.pm_->local_nrow_;
+        int64_t row_begin
+            = process_offset(local_nrow, AT.pm_->rank_, AT.pm_->num_procs_, AT.pm_->comm_);
+
+        PtrType*   t_ptr = NULL;
+        int64_t*   t_col = NULL;
+        ValueType* t_val = NULL;
+        PtrType*   g_ptr = NULL;
+        int64_t*   g_col = NULL;
+        ValueType* g_val = NULL;
+
+        AT.ExtractGlobalRows_(&t_ptr, &t_col, &t_val);
+        AT.FetchGhostRows_(t_ptr, t_col, t_val, &g_ptr, &g_col, &g_val);
+
+        std::vector<std::pair<int64_t, int>> ghost_table;
+        ghost_lookup_table(AT.pm_->GetNumReceivers(), AT.pm_->GetGhostToGlobalMap(), ghost_table);
+
+        // Values of M^T, with the pattern of A^T
+        std::vector<ValueType> m_val(t_ptr[local_nrow]);
+        std::vector<int64_t>   I;
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            int            Jsize = static_cast<int>(t_ptr[i + 1] - t_ptr[i]);
+            const int64_t* J     = t_col + t_ptr[i];
+
+            if(Jsize == 0)
+            {
+                continue;
+            }
+
+            // Rows J of A^T
+            std::vector<const PtrType*>   ptr(Jsize);
+            std::vector<const int64_t*>   col(Jsize);
+            std::vector<const ValueType*> val(Jsize);
+            std::vector<int64_t>          row(Jsize);
+
+            I.clear();
+
+            for(int j = 0; j < Jsize; ++j)
+            {
+                if(J[j] >= row_begin && J[j] < row_begin + local_nrow)
+                {
+                    ptr[j] = t_ptr;
+                    col[j] = t_col;
+                    val[j] = t_val;
+                    row[j] = J[j] - row_begin;
+                }
+                else
+                {
+                    ptr[j] = g_ptr;
+                    col[j] = g_col;
+                    val[j] = g_val;
+                    row[j] = ghost_lookup(ghost_table, J[j]);
+                }
+
+                // Setup I = {i | row A(i,J) != 0}
+                for(PtrType aj = ptr[j][row[j]]; aj < ptr[j][row[j] + 1]; ++aj)
+                {
+                    I.push_back(col[j][aj]);
+                }
+            }
+
+            std::sort(I.begin(), I.end());
+            I.erase(std::unique(I.begin(), I.end()), I.end());
+
+            int Isize = static_cast<int>(I.size());
+
+            // Dense submatrix A(I,J) in column-major order
+            ValueType* Asub_val = NULL;
+            allocate_host(Isize * Jsize, &Asub_val);
+            set_to_zero_host(Isize * Jsize, Asub_val);
+
+            for(int j = 0; j < Jsize; ++j)
+            {
+                for(PtrType aj = ptr[j][row[j]]; aj < ptr[j][row[j] + 1]; ++aj)
+                {
+                    int k = static_cast<int>(std::lower_bound(I.begin(), I.end(), col[j][aj])
+                                             - I.begin());
+
+                    Asub_val[k + j * Isize] = val[j][aj];
+                }
+            }
+
+            std::vector<ValueType> ek(Isize, static_cast<ValueType>(0));
+            std::vector<ValueType> mk(Jsize);
+
+            std::vector<int64_t>::iterator diag
+                = std::lower_bound(I.begin(), I.end(), row_begin + i);
+
+            if(diag != I.end() && *diag == row_begin + i)
+            {
+                ek[diag - I.begin()] = static_cast<ValueType>(1);
+            }
+
+            // Solve least squares
+            LocalMatrix<ValueType> Asub;
+            LocalVector<ValueType> ek_vec;
+            LocalVector<ValueType> mk_vec;
+
+            Asub.SetDataPtrDENSE(&Asub_val, "Asub", Isize, Jsize);
+            ek_vec.Allocate("ek", Isize);
+            mk_vec.Allocate("mk", Jsize);
+            ek_vec.CopyFromHostData(ek.data());
+
+            Asub.QRDecompose();
+            Asub.QRSolve(ek_vec, &mk_vec);
+
+            mk_vec.CopyToHostData(m_val.data() + t_ptr[i]);
+        }
+
+        free_host(&t_val);
+        free_host(&g_ptr);
+        free_host(&g_col);
+        free_host(&g_val);
+
+        GlobalMatrix<ValueType> MT;
+        MT.CloneBackend(*this);
+        MT.GenerateFromGlobalRows_(AT.pm_->comm_,
+                                   AT.pm_->global_nrow_,
+                                   AT.pm_->global_ncol_,
+                                   local_nrow,
+                                   AT.pm_->local_ncol_,
+                                   t_ptr,
+                                   t_col,
+                                   m_val.data(),
+                                   "SPAI transpose");
+
+        free_host(&t_ptr);
+        free_host(&t_col);
+
+        std::string name = this->object_name_;
+
+        MT.Transpose(this);
+        this->object_name_ = name;
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ExtractOverlap(int                      overlap,
+                                                 LocalMatrix<ValueType>*  mat,
+                                                 GlobalMatrix<ValueType>* pattern) const
+    {
+        log_debug(this, "GlobalMatrix::ExtractOverlap()", overlap, mat, pattern);
+
+        assert(overlap >= 0);
+        assert(mat != NULL);
+        assert(pattern != NULL);
+        assert(pattern != this);
+        assert(this->pm_ != NULL);
+        assert(this->GetM() == this->GetN());
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        // Without overlap or other processes, the subdomain is given by the interior
+        if(overlap == 0 || this->pm_->num_procs_ == 1)
+        {
+            mat->CloneFrom(this->matrix_interior_);
+
+            // The pattern has no ghost part, thus exchanging its ghost values is a no-op
+            pattern->Clear();
+            pattern->pm_ = NULL;
+
+            return;
+        }
+
+#ifdef SUPPORT_MULTINODE
+        int64_t local_nrow = this->pm_->local_nrow_;
+        int64_t row_begin
+            = process_offset(local_nrow, this->pm_->rank_, this->pm_->num_procs_, this->pm_->comm_);
+        int64_t row_end = row_begin + local_nrow;
+
+        PtrType*   a_ptr = NULL;
+        int64_t*   a_col = NULL;
+        ValueType* a_val = NULL;
+        PtrType*   g_ptr = NULL;
+        int64_t*   g_col = NULL;
+        ValueType* g_val = NULL;
+
+        this->ExtractGlobalRows_(&a_ptr, &a_col, &a_val);
+
+        // Global ids of the overlap rows, in ascending order
+        std::vector<int64_t> overlap_rows;
+
+        // Each layer adds the rows that are coupled to the interior and the current overlap
+        // rows. The number of layers is the same on all processes, as the pattern is
+        // generated collectively.
+        for(int layer = 0; layer < overlap; ++layer)
+        {
+            std::vector<int64_t> next(overlap_rows);
+
+            const PtrType* ptr  = (layer == 0) ? a_ptr : g_ptr;
+            const int64_t* col  = (layer == 0) ? a_col : g_col;
+            int64_t        nrow
+                = (layer == 0) ? local_nrow : static_cast<int64_t>(overlap_rows.size());
+
+            for(PtrType j = 0; j < ptr[nrow]; ++j)
+            {
+                if(col[j] < row_begin || col[j] >= row_end)
+                {
+                    next.push_back(col[j]);
+                }
+            }
+
+            std::sort(next.begin(), next.end());
+            next.erase(std::unique(next.begin(), next.end()), next.end());
+
+            // Structural matrix, where the first row holds all overlap rows, such that they
+            // form the ghost columns and thus the communication pattern
+            std::vector<PtrType>   p_ptr(local_nrow + 1, static_cast<PtrType>(next.size()));
+            std::vector<ValueType> p_val(next.size(), static_cast<ValueType>(0));
+
+            p_ptr[0] = 0;
+
+            pattern->GenerateFromGlobalRows_(this->pm_->comm_,
+                                             this->pm_->global_nrow_,
+                                             this->pm_->global_ncol_,
+                                             local_nrow,
+                                             this->pm_->local_ncol_,
+                                             p_ptr.data(),
+                                             next.data(),
+                                             p_val.data(),
+                                             "Overlap pattern of " + this->object_name_);
+
+            // The fetched rows are ordered like the ghost columns of the pattern
+            free_host(&g_ptr);
+            free_host(&g_col);
+            free_host(&g_val);
+
+            pattern->FetchGhostRows_(a_ptr, a_col, a_val, &g_ptr, &g_col, &g_val);
+
+            overlap_rows.swap(next);
+        }
+
+        int64_t noverlap = overlap_rows.size();
+        int64_t nrow     = local_nrow + noverlap;
+
+        // Assemble the subdomain matrix with local column ids, interior rows first
+        PtrType*   ov_ptr = NULL;
+        int*       ov_col = NULL;
+        ValueType* ov_val = NULL;
+
+        allocate_host(nrow + 1, &ov_ptr);
+
+        std::vector<std::pair<int, ValueType>> row;
+        std::vector<int>                       cols;
+        std::vector<ValueType>                 vals;
+
+        ov_ptr[0] = 0;
+
+        for(int64_t i = 0; i < nrow; ++i)
+        {
+            const PtrType*   ptr = a_ptr;
+            const int64_t*   col = a_col;
+            const ValueType* val = a_val;
+            int64_t          r   = i;
+
+            if(i >= local_nrow)
+            {
+                ptr = g_ptr;
+                col = g_col;
+                val = g_val;
+                r   = i - local_nrow;
+            }
+
+            row.clear();
+
+            for(PtrType j = ptr[r]; j < ptr[r + 1]; ++j)
+            {
+                if(col[j] >= row_begin && col[j] < row_end)
+                {
+                    row.push_back(std::make_pair(static_cast<int>(col[j] - row_begin), val[j]));
+                }
+                else
+                {
+                    std::vector<int64_t>::const_iterator pos
+                        = std::lower_bound(overlap_rows.begin(), overlap_rows.end(), col[j]);
+
+                    // Couplings that leave the subdomain are dropped
+                    if(pos != overlap_rows.end() && *pos == col[j])
+                    {
+                        row.push_back(std::make_pair(
+                            static_cast<int>(local_nrow + (pos - overlap_rows.begin())), val[j]));
+                    }
+                }
+            }
+
+            std::sort(row.begin(),
+                      row.end(),
+                      [](const std::pair<int, ValueType>& a, const std::pair<int, ValueType>& b) {
+                          return a.first < b.first;
+                      });
+
+            for(size_t j = 0; j < row.size(); ++j)
+            {
+                cols.push_back(row[j].first);
+                vals.push_back(row[j].second);
+            }
+
+            ov_ptr[i + 1] = static_cast<PtrType>(cols.size());
+        }
+
+        free_host(&a_ptr);
+        free_host(&a_col);
+        free_host(&a_val);
+        free_host(&g_ptr);
+        free_host(&g_col);
+        free_host(&g_val);
+
+        int64_t nnz = cols.size();
+
+        allocate_host(nnz, &ov_col);
+        allocate_host(nnz, &ov_val);
+
+        copy_h2h(nnz, cols.data(), ov_col);
+        copy_h2h(nnz, vals.data(), ov_val);
+
+        bool on_accel = mat->is_accel_();
+
+        mat->Clear();
+        mat->MoveToHost();
+        mat->SetDataPtrCSR(
+            &ov_ptr, &ov_col, &ov_val, "Overlap of " + this->object_name_, nnz, nrow, nrow);
+
+        if(on_accel == true)
+        {
+            mat->MoveToAccelerator();
+        }
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSCoarsening(float              eps,
+                                               LocalVector<int>*  CFmap,
+                                               LocalVector<bool>* S) const
+    {
+        log_debug(this, "GlobalMatrix::RSCoarsening()", eps, CFmap, S);
+
+        assert(eps < 1.0f);
+        assert(eps > 0.0f);
+        assert(CFmap != NULL);
+        assert(S != NULL);
+        assert(this->is_host_() == CFmap->is_host_());
+        assert(this->is_host_() == S->is_host_());
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        // Calling global routine with single process
+        if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
+        {
+            this->matrix_interior_.RSCoarsening(eps, CFmap, S);
+
+            return;
+        }
+
+        LOG_VERBOSE_INFO(2,
+                         "*** error: GlobalMatrix::RSCoarsening() is not available on GlobalMatrix "
+                         "class - use PMIS coarsening instead");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSPMISCoarsening(float              eps,
+                                                   LocalVector<int>*  CFmap,
+                                                   LocalVector<bool>* S) const
+    {
+        log_debug(this, "GlobalMatrix::RSPMISCoarsening()", eps, CFmap, S);
+
+        assert(eps < 1.0f);
+        assert(eps > 0.0f);
+        assert(CFmap != NULL);
+        assert(S != NULL);
+        assert(this->is_host_() == CFmap->is_host_());
+        assert(this->is_host_() == S->is_host_());
+        assert(this->is_host_() == this->halo_.is_host_());
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        // Calling global routine with single process
+        if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
+        {
+            this->matrix_interior_.RSPMISCoarsening(eps, CFmap, S);
+
+            return;
+        }
+
+        // Only CSR matrices are supported
+        LocalMatrix<ValueType> csr_int;
+        LocalMatrix<ValueType> csr_gst;
+
+        const LocalMatrix<ValueType>* int_ptr = &this->matrix_interior_;
+        const LocalMatrix<ValueType>* gst_ptr = &this->matrix_ghost_;
+
+        if(int_ptr->GetFormat() != CSR)
+        {
+            csr_int.CloneFrom(*int_ptr);
+            csr_int.ConvertToCSR();
+            int_ptr = &csr_int;
+        }
+
+        if(gst_ptr->GetNnz() == 0)
+        {
+            // An empty ghost part (e.g. after agglomeration) has no dimensions in COO
+            csr_gst.CloneBackend(*this);
+            csr_gst.AllocateCSR("", 0, this->pm_->local_nrow_, this->pm_->GetNumReceivers());
+            gst_ptr = &csr_gst;
+        }
+        else if(gst_ptr->GetFormat() != CSR)
+        {
+            csr_gst.CloneFrom(*gst_ptr);
+            csr_gst.ConvertToCSR();
+            gst_ptr = &csr_gst;
+        }
+
+        if(this->GetNnz() > 0)
+        {
+            // Communication sizes
+            int nsend = this->pm_->GetNumSenders();
+            int nrecv = this->pm_->GetNumReceivers();
+
+            // Some communication related buffers
+            int*   hisend_buffer = NULL;
+            int*   hirecv_buffer = NULL;
+            float* hsend_buffer  = NULL;
+            float* hrecv_buffer  = NULL;
+
+            allocate_host(nsend, &hisend_buffer);
+            allocate_host(nrecv, &hirecv_buffer);
+            allocate_host(nsend, &hsend_buffer);
+            allocate_host(nrecv, &hrecv_buffer);
+
+            // Allocate S
+            S->Allocate("S", int_ptr->GetNnz() + gst_ptr->GetNnz());
+
+            // Sample rng
+            LocalVector<float> omega;
+            omega.CloneBackend(*this);
+            omega.Allocate("omega", int_ptr->GetM() + nrecv);
+
+            // Determine strong influences in the matrix
+            unsigned long long seed = this->pm_->GetGlobalRowBegin(); // TODO
+            int_ptr->matrix_->RSPMISStrongInfluences(
+                eps, S->vector_, omega.vector_, seed, *gst_ptr->matrix_);
+
+            // Update S, omega and CF mapping from neighbors
+
+            // Prepare send buffer
+            omega.GetContinuousValues(int_ptr->GetM(), omega.GetSize(), hrecv_buffer);
+
+            // Send omega ghost to neighbors
+            this->pm_->InverseCommunicateAsync_(hrecv_buffer, hsend_buffer);
+
+            // Allocate the communication buffers while omega is in flight
+            LocalVector<float> send_buffer;
+            send_buffer.CloneBackend(*this);
+            send_buffer.Allocate("send buffer", nsend);
+
+            LocalVector<int> isend_buffer;
+            isend_buffer.CloneBackend(*this);
+            isend_buffer.Allocate("int send buffer", nsend);
+
+            // Synchronize
+            this->pm_->InverseCommunicateSync_();
+
+            // Update omega with received omega from neighbors
+            send_buffer.CopyFromHostData(hsend_buffer);
+
+            omega.AddIndexValues(this->halo_, send_buffer);
+
+            // Pack updated omega
+            omega.GetIndexValues(this->halo_, &send_buffer);
+            send_buffer.CopyToHostData(hsend_buffer);
+
+            // Receive updated omega from neighbors
+            this->pm_->CommunicateAsync_(hsend_buffer, hrecv_buffer);
+
+            // Allocate CF mapping
+            CFmap->Allocate("CF map", int_ptr->GetM() + nrecv);
+
+            // Mark all vertices as undecided
+            CFmap->Zeros();
+
+            LocalVector<bool> marked;
+            marked.CloneBackend(*this);
+            marked.Allocate("marked coarse", int_ptr->GetM() + nrecv);
+
+            // Synchronize
+            this->pm_->CommunicateSync_();
+
+            // Update omega with received omega from neighbors
+            omega.SetContinuousValues(int_ptr->GetM(), omega.GetSize(), hrecv_buffer);
+
+            // Iteratively find coarse and fine vertices until all undecided vertices have
+            // been marked (JPL approach)
+            int iter = 0;
+
+            while(true)
+            {
+                // First, mark all vertices that have not been assigned yet, as coarse
+                int_ptr->matrix_->RSPMISUnassignedToCoarse(
+                    CFmap->vector_, marked.vector_, *omega.vector_);
+
+                // Now, correct previously marked vertices with respect to omega
+                int_ptr->matrix_->RSPMISCorrectCoarse(CFmap->vector_,
+                                                      *S->vector_,
+                                                      *marked.vector_,
+                                                      *omega.vector_,
+                                                      *gst_ptr->matrix_);
+
+                // Communicate ghost CF map to neighbors and update interior CF map with data
+                // received from neighbors
+
+                // Prepare send buffer
+                CFmap->GetContinuousValues(int_ptr->GetM(), CFmap->GetSize(), hirecv_buffer);
+
+                // Send CF map to neighbors
+                this->pm_->InverseCommunicateAsync_(hirecv_buffer, hisend_buffer);
+
+                // Synchronize
+                this->pm_->InverseCommunicateSync_();
+
+                // Update interior CF map with data received and pack send buffer
+                isend_buffer.CopyFromHostData(hisend_buffer);
+
+                CFmap->vector_->RSPMISUpdateCFmap(*this->halo_.vector_, isend_buffer.vector_);
+
+                isend_buffer.CopyToHostData(hisend_buffer);
+
+                // Receive updated CF map from neighbors
+                this->pm_->CommunicateAsync_(hisend_buffer, hirecv_buffer);
+
+                // Synchronize
+                this->pm_->CommunicateSync_();
+
+                // Update CFmap with received CFmap from neighbors
+                CFmap->SetContinuousValues(int_ptr->GetM(), CFmap->GetSize(), hirecv_buffer);
+
+                // Mark remaining edges of a coarse point to fine
+                int_ptr->matrix_->RSPMISCoarseEdgesToFine(
+                    CFmap->vector_, *S->vector_, *gst_ptr->matrix_);
+
+                // Pack updated CF map for communication
+                CFmap->GetIndexValues(this->halo_, &isend_buffer);
+                isend_buffer.CopyToHostData(hisend_buffer);
+
+                // Communicate
+                this->pm_->CommunicateAsync_(hisend_buffer, hirecv_buffer);
+
+                // Now, we need to check whether we have vertices left that are marked
+                // undecided, in order to restart the loop
+                bool undecided;
+                int_ptr->matrix_->RSPMISCheckUndecided(undecided, *CFmap->vector_);
+
+                // Get global number of undecided vertices
+                int local_undecided = undecided;
+                int global_undecided;
+
+#ifdef SUPPORT_MULTINODE
+                MRequest req;
+                communication_async_allreduce_single_max(
+                    &local_undecided, &global_undecided, this->pm_->GetComm(), &req);
+#endif
+
+                // Synchronize
+                this->pm_->CommunicateSync_();
+
+                // Update CFmap with received CFmap from neighbors
+                CFmap->SetContinuousValues(int_ptr->GetM(), CFmap->GetSize(), hirecv_buffer);
+
+#ifdef SUPPORT_MULTINODE
+                communication_sync(&req);
+#endif
+
+                // If no more undecided vertices are left, we are done
+                if(global_undecided == 0)
+                {
+                    break;
+                }
+
+                ++iter;
+
+                // Print some warning if number of iteration is getting huge
+                if(iter > 20)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: GlobalMatrix::RSPMISCoarsening() Current "
+                                     "number of iterations: "
+                                         << iter);
+                }
+            }
+
+            free_host(&hsend_buffer);
+            free_host(&hrecv_buffer);
+            free_host(&hisend_buffer);
+            free_host(&hirecv_buffer);
+
+            omega.Clear();
+        }
+
+        std::string CFmap_name = "CF map of " + this->object_name_;
+        std::string S_name     = "S of " + this->object_name_;
+
+        CFmap->object_name_ = CFmap_name;
+        S->object_name_     = S_name;
+
+        if(this->GetFormat() != CSR)
+        {
+            LOG_VERBOSE_INFO(
+                2, "*** warning: GlobalMatrix::RSPMISCoarsening() is performed in CSR format");
+        }
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSDirectInterpolation(const LocalVector<int>&  CFmap,
+                                                        const LocalVector<bool>& S,
+                                                        GlobalMatrix<ValueType>* prolong) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::RSDirectInterpolation()",
+                  (const void*&)CFmap,
+                  (const void*&)S,
+                  prolong);
+
+        assert(prolong != NULL);
+        assert(this != prolong);
+        assert(prolong->GetFormat() == CSR);
+
+        assert(this->is_host_() == prolong->is_host_());
+        assert(this->is_host_() == CFmap.is_host_());
+        assert(this->is_host_() == S.is_host_());
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        // Calling global routine with single process
+        if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
+        {
+            this->matrix_interior_.RSDirectInterpolation(CFmap, S, &prolong->matrix_interior_);
+
+            // Prolongation PM
+            prolong->CreateParallelManager_();
+            prolong->pm_self_->SetMPICommunicator(this->pm_->comm_);
+
+            prolong->pm_self_->SetGlobalNrow(prolong->matrix_interior_.GetM());
+            prolong->pm_self_->SetGlobalNcol(prolong->matrix_interior_.GetN());
+
+            prolong->pm_self_->SetLocalNrow(prolong->matrix_interior_.GetM());
+            prolong->pm_self_->SetLocalNcol(prolong->matrix_interior_.GetN());
+
+            return;
+        }
+
+        // Only CSR matrices are supported
+        LocalMatrix<ValueType> csr_int;
+        LocalMatrix<ValueType> csr_gst;
+
+        const LocalMatrix<ValueType>* int_ptr = &this->matrix_interior_;
+        const LocalMatrix<ValueType>* gst_ptr = &this->matrix_ghost_;
+
+        if(int_ptr->GetFormat() != CSR)
+        {
+            csr_int.CloneFrom(*int_ptr);
+            csr_int.ConvertToCSR();
+            int_ptr = &csr_int;
+        }
+
+        if(gst_ptr->GetNnz() == 0)
+        {
+            // An empty ghost part (e.g. after agglomeration) has no dimensions in COO
+            csr_gst.CloneBackend(*this);
+            csr_gst.AllocateCSR("", 0, this->pm_->local_nrow_, this->pm_->GetNumReceivers());
+            gst_ptr = &csr_gst;
+        }
+        else if(gst_ptr->GetFormat() != CSR)
+        {
+            csr_gst.CloneFrom(*gst_ptr);
+            csr_gst.ConvertToCSR();
+            gst_ptr = &csr_gst;
+        }
+
+        // Start with fresh P operator
+        prolong->Clear();
+
+        // fine to coarse map
+        LocalVector<int> f2c_map;
+        f2c_map.CloneBackend(*this);
+        f2c_map.Allocate("f2c map", int_ptr->GetM() + 1);
+
+        // Amin/max
+        LocalVector<ValueType> Amin;
+        LocalVector<ValueType> Amax;
+
+        Amin.CloneBackend(*this);
+        Amax.CloneBackend(*this);
+
+        Amin.Allocate("A min", int_ptr->GetM());
+        Amax.Allocate("A max", int_ptr->GetM());
+
+        // Determine number of non-zeros for P
+        int_ptr->matrix_->RSDirectProlongNnz(*CFmap.vector_,
+                                             *S.vector_,
+                                             *gst_ptr->matrix_,
+                                             Amin.vector_,
+                                             Amax.vector_,
+                                             f2c_map.vector_,
+                                             prolong->matrix_interior_.matrix_,
+                                             prolong->matrix_ghost_.matrix_);
+
+        // Obtain the local to global ghost mapping
+        LocalVector<int64_t> l2g;
+        l2g.CloneBackend(*this);
+        l2g.Allocate("l2g ghost map", this->pm_->GetNumReceivers());
+        l2g.CopyFromHostData(this->pm_->GetGhostToGlobalMap());
+
+        // Temporary array to store global ghost columns
+        LocalVector<int64_t> ghost_col;
+        ghost_col.CloneBackend(*this);
+
+        // Fill column indices and values of P
+        int_ptr->matrix_->RSDirectProlongFill(*l2g.vector_,
+                                              *f2c_map.vector_,
+                                              *CFmap.vector_,
+                                              *S.vector_,
+                                              *gst_ptr->matrix_,
+                                              *Amin.vector_,
+                                              *Amax.vector_,
+                                              prolong->matrix_interior_.matrix_,
+                                              prolong->matrix_ghost_.matrix_,
+                                              ghost_col.vector_);
+
+        Amin.Clear();
+        Amax.Clear();
+
+        // Ghost of P MUST be CSR
+        assert(prolong->matrix_ghost_.GetFormat() == CSR);
+
+        // Communicate global sizes of P
+        int64_t global_ncol;
+        int64_t local_ncol = prolong->GetLocalN();
+
+#ifdef SUPPORT_MULTINODE
+        MRequest req;
+        communication_async_allreduce_single_sum(&local_ncol, &global_ncol, this->pm_->comm_, &req);
+#endif
+
+        // Setup parallel manager of P
+        prolong->CreateParallelManager_();
+        prolong->pm_self_->SetMPICommunicator(this->pm_->comm_);
+
+        // To generate the parallel manager, we need to access the sorted global ghost column ids
+        LocalVector<int64_t> sorted_ghost_col;
+        sorted_ghost_col.CloneBackend(*this);
+        sorted_ghost_col.Allocate("sorted global ghost columns", ghost_col.GetSize());
+
+        // Sort the global ghost columns (we do not need the permutation vector)
+        ghost_col.Sort(&sorted_ghost_col, NULL);
+
+        // Get the sorted ghost columns on host
+        int64_t* pghost_col = NULL;
+        sorted_ghost_col.MoveToHost();
+        sorted_ghost_col.LeaveDataPtr(&pghost_col);
+
+#ifdef SUPPORT_MULTINODE
+        communication_sync(&req);
+#endif
+
+        // Sizes
+        prolong->pm_self_->SetGlobalNrow(this->pm_->global_nrow_);
+        prolong->pm_self_->SetGlobalNcol(global_ncol);
+        prolong->pm_self_->SetLocalNrow(this->pm_->local_nrow_);
+        prolong->pm_self_->SetLocalNcol(local_ncol);
+
+        // Generate the PM
+        prolong->pm_self_->GenerateFromGhostColumnsWithParent_(
+            prolong->matrix_ghost_.GetNnz(), pghost_col, *this->pm_);
+
+        // Communicate global offsets
+        prolong->pm_self_->CommunicateGlobalOffsetAsync_();
+
+        // This is a prolongation operator, means we need to convert the global
+        // fine boundary columns from to local coarse columns
+        int* f2c = NULL;
+        f2c_map.MoveToHost();
+        f2c_map.LeaveDataPtr(&f2c);
+
+        // Clear
+        free_host(&pghost_col);
+
+        // Sync global offsets communication
+        prolong->pm_self_->CommunicateGlobalOffsetSync_();
+
+        // Convert local boundary columns from global fine to local coarse
+        prolong->pm_self_->BoundaryTransformGlobalFineToLocalCoarse_(f2c);
+
+        // Communicate ghost to global map
+        prolong->pm_self_->CommunicateGhostToGlobalMapAsync_();
+
+        // Clear
+        free_host(&f2c);
+
+        // Finally, renumber ghost columns (from global to local)
+        // We couldn't do this earlier, because the parallel manager need
+        // to know the global ghost column ids
+        prolong->matrix_ghost_.matrix_->RenumberGlobalToLocal(*ghost_col.vector_);
+
+        // Synchronize
+        prolong->pm_self_->CommunicateGhostToGlobalMapSync_();
+
+        prolong->SetParallelManager(*prolong->pm_self_);
+
+        // Rename P
+        prolong->object_name_ = "Prolongation Operator of " + this->object_name_;
+
+        if(this->GetFormat() != CSR)
+        {
+            LOG_VERBOSE_INFO(
+                2, "*** warning: GlobalMatrix::RSDirectInterpolation() is performed in CSR format");
+        }
+
+#ifdef DEBUG_MODE
+        prolong->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::RSExtPIInterpolation(const LocalVector<int>&  CFmap,
+                                                       const LocalVector<bool>& S,
+                                                       bool                     FF1,
+                                                       GlobalMatrix<ValueType>* prolong) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::RSExtPIInterpolation()",
+                  (const void*&)CFmap,
+                  (const void*&)S,
+                  FF1,
+                  prolong);
+
+        assert(prolong != NULL);
+        assert(this != prolong);
+
+        assert(prolong->GetFormat() == CSR);
+
+        assert(this->is_host_() == prolong->is_host_());
+        assert(this->is_host_() == CFmap.is_host_());
+        assert(this->is_host_() == S.is_host_());
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        // Calling global routine with single process
+        if(this->pm_ == NULL || this->pm_->num_procs_ == 1)
+        {
+            this->matrix_interior_.RSExtPIInterpolation(CFmap, S, FF1, &prolong->matrix_interior_);
+
+            // Prolongation PM
+            prolong->CreateParallelManager_();
+            prolong->pm_self_->SetMPICommunicator(this->pm_->comm_);
+
+            prolong->pm_self_->SetGlobalNrow(prolong->matrix_interior_.GetM());
+            prolong->pm_self_->SetGlobalNcol(prolong->matrix_interior_.GetN());
+
+            prolong->pm_self_->SetLocalNrow(prolong->matrix_interior_.GetM());
+            prolong->pm_self_->SetLocalNcol(prolong->matrix_interior_.GetN());
+
+            return;
+        }
+
+        // Only CSR matrices are supported
+        LocalMatrix<ValueType> csr_int;
+        LocalMatrix<ValueType> csr_gst;
+
+        const LocalMatrix<ValueType>* int_ptr = &this->matrix_interior_;
+        const LocalMatrix<ValueType>* gst_ptr = &this->matrix_ghost_;
+
+        if(int_ptr->GetFormat() != CSR)
+        {
+            csr_int.CloneFrom(*int_ptr);
+            csr_int.ConvertToCSR();
+            int_ptr = &csr_int;
+        }
+
+        if(gst_ptr->GetNnz() == 0)
+        {
+            // An empty ghost part (e.g. after agglomeration) has no dimensions in COO
+            csr_gst.CloneBackend(*this);
+            csr_gst.AllocateCSR("", 0, this->pm_->local_nrow_, this->pm_->GetNumReceivers());
+            gst_ptr = &csr_gst;
+        }
+        else if(gst_ptr->GetFormat() != CSR)
+        {
+            csr_gst.CloneFrom(*gst_ptr);
+            csr_gst.ConvertToCSR();
+            gst_ptr = &csr_gst;
+        }
+
+        // Start with fresh P operator
+        prolong->Clear();
+
+        // Communication sizes
+        int nsend = this->pm_->GetNumSenders();
+        int nrecv = this->pm_->GetNumReceivers();
+
+        // To do Ext+I interpolation, we need to fetch additional rows of A, such that
+        // we can locally access all rows that do not belong to the current rank, but
+        // are required due to column dependencies.
+        // This means, we have to send all rows of A where A has a dependency on to
+        // the neighboring rank
+        int A_ext_m_send = nsend;
+
+        // First, count the total number of non-zero entries per boundary row that are strongly connected
+        // and coarse points, including ghost part (we need to send full rows, not only interior)
+        LocalVector<PtrType> A_ext_row_ptr_send;
+        A_ext_row_ptr_send.CloneBackend(*this);
+        A_ext_row_ptr_send.Allocate("A ext row ptr", A_ext_m_send + 1);
+
+        int_ptr->matrix_->RSExtPIBoundaryNnz(*this->halo_.vector_,
+                                             *CFmap.vector_,
+                                             *S.vector_,
+                                             *gst_ptr->matrix_,
+                                             A_ext_row_ptr_send.vector_);
+
+        // Transfer send buffer to host
+        PtrType* send_buffer = NULL;
+        allocate_host(A_ext_m_send + 1, &send_buffer);
+        A_ext_row_ptr_send.CopyToHostData(send_buffer);
+
+        // Number of rows of A we receive from our neighbors
+        int A_ext_m_recv = nrecv;
+
+        // Host receive buffer
+        PtrType* hA_ext_row_nnz_recv = NULL;
+        allocate_host(A_ext_m_recv + 1, &hA_ext_row_nnz_recv);
+
+        // Initiate communication of nnz per row (async)
+        this->pm_->CommunicateAsync_(send_buffer, hA_ext_row_nnz_recv);
+
+        // Extract ghost to global map
+        LocalVector<int64_t> l2g;
+        l2g.CloneBackend(*this);
+        l2g.Allocate("A ghost map", nrecv);
+        l2g.CopyFromHostData(this->pm_->GetGhostToGlobalMap());
+
+        // Exclusive sum to obtain row pointers
+        PtrType A_ext_nnz_send = A_ext_row_ptr_send.ExclusiveSum();
+
+        // Global column offset for this rank
+        int64_t global_col_begin = this->pm_->GetGlobalColumnBegin();
+        int64_t global_col_end   = this->pm_->GetGlobalColumnEnd();
+
+        // Now, extract boundary column indices and values of all strongly connected coarse points
+        LocalVector<int64_t> A_ext_col_ind_send;
+        A_ext_col_ind_send.CloneBackend(*this);
+        A_ext_col_ind_send.Allocate("A ext col ind send", A_ext_nnz_send);
+
+        int_ptr->matrix_->RSExtPIExtractBoundary(global_col_begin,
+                                                 *this->halo_.vector_,
+                                                 *l2g.vector_,
+                                                 *CFmap.vector_,
+                                                 *S.vector_,
+                                                 *gst_ptr->matrix_,
+                                                 *A_ext_row_ptr_send.vector_,
+                                                 A_ext_col_ind_send.vector_);
+
+        // Allocate row pointer array
+        LocalVector<PtrType> A_ext_row_ptr_recv;
+
+        // Synchronize communication
+        this->pm_->CommunicateSync_();
+
+        // Place our received data into structure
+        A_ext_row_ptr_recv.SetDataPtr(&hA_ext_row_nnz_recv, "A ext row ptr", A_ext_m_recv + 1);
+        A_ext_row_ptr_recv.CloneBackend(*this);
+
+        // Obtain row pointers
+        PtrType A_ext_nnz_recv = A_ext_row_ptr_recv.ExclusiveSum();
+
+        // We need a copy of A_ext_row_ptr on the host for communication
+        PtrType* hA_ext_row_ptr_recv = NULL;
+        allocate_host(A_ext_m_recv + 1, &hA_ext_row_ptr_recv);
+        A_ext_row_ptr_recv.CopyToHostData(hA_ext_row_ptr_recv);
+
+        // We need a copy of A_ext_col_ind_send on host for communication
+        int64_t* pA_ext_col_ind_send = NULL;
+        A_ext_col_ind_send.MoveToHost();
+        A_ext_col_ind_send.LeaveDataPtr(&pA_ext_col_ind_send);
+
+        // Initiate communication of column indices and values
+        int64_t* hA_ext_col_ind_recv = NULL;
+        allocate_host(A_ext_nnz_recv, &hA_ext_col_ind_recv);
+
+        // We need a copy of A_ext_row_ptr on host for communication
+        PtrType* hA_ext_row_ptr_send = NULL;
+        allocate_host(A_ext_m_send + 1, &hA_ext_row_ptr_send);
+        A_ext_row_ptr_send.CopyToHostData(hA_ext_row_ptr_send);
+
+        this->pm_->CommunicateCSRAsync_(hA_ext_row_ptr_send,
+                                        pA_ext_col_ind_send,
+                                        (ValueType*)NULL,
+                                        hA_ext_row_ptr_recv,
+                                        hA_ext_col_ind_recv,
+                                        (ValueType*)NULL);
+
+        // fine to coarse map
+        LocalVector<int> f2c_map;
+        f2c_map.CloneBackend(*this);
+        f2c_map.Allocate("f2c map", int_ptr->GetM() + 1);
+
+        // Synchronize communication
+        this->pm_->CommunicateCSRSync_();
+
+        // Clear
+        free_host(&hA_ext_row_ptr_send);
+        free_host(&pA_ext_col_ind_send);
+
+        LocalVector<int64_t> A_ext_col_ind_recv;
+        A_ext_col_ind_recv.SetDataPtr(&hA_ext_col_ind_recv, "A ext col ind", A_ext_nnz_recv);
+        A_ext_col_ind_recv.CloneBackend(*this);
+
+        // Determine number of non-zeros for P
+        int_ptr->matrix_->RSExtPIProlongNnz(global_col_begin,
+                                            global_col_end,
+                                            FF1,
+                                            *l2g.vector_,
+                                            *CFmap.vector_,
+                                            *S.vector_,
+                                            *gst_ptr->matrix_,
+                                            *A_ext_row_ptr_recv.vector_,
+                                            *A_ext_col_ind_recv.vector_,
+                                            f2c_map.vector_,
+                                            prolong->matrix_interior_.matrix_,
+                                            prolong->matrix_ghost_.matrix_);
+
+        // Obtain neighboring rows
+
+        // Count the non-zeros of each boundary row, including the ghost part
+        int_ptr->matrix_->ExtractBoundaryRowNnz(
+            A_ext_row_ptr_send.vector_, *this->halo_.vector_, *gst_ptr->matrix_);
+
+        // Transfer send buffer to host
+        A_ext_row_ptr_send.CopyToHostData(send_buffer);
+
+        // Initiate communication of nnz per row
+        this->pm_->CommunicateAsync_(send_buffer, &hA_ext_row_ptr_recv[1]);
+
+        // Exclusive sum to obtain row pointers of send buffer
+        A_ext_nnz_send = A_ext_row_ptr_send.ExclusiveSum();
+
+        // Extract the boundary nnz and convert them to global indices
+        LocalVector<ValueType> A_ext_val_send;
+        A_ext_val_send.CloneBackend(*this);
+
+        LocalVector<int64_t> A_ext_col_ind_send_global;
+        A_ext_col_ind_send_global.CloneBackend(*this);
+        A_ext_col_ind_send_global.Allocate("A ext col ind send", A_ext_nnz_send);
+        A_ext_val_send.Allocate("A ext val send", A_ext_nnz_send);
+
+        int_ptr->matrix_->ExtractBoundaryRows(*A_ext_row_ptr_send.vector_,
+                                              A_ext_col_ind_send_global.vector_,
+                                              A_ext_val_send.vector_,
+                                              global_col_begin,
+                                              *this->halo_.vector_,
+                                              *l2g.vector_,
+                                              *gst_ptr->matrix_);
+
+        // Wait for nnz per row communication to finish
+        this->pm_->CommunicateSync_();
+
+        // Clear
+        free_host(&send_buffer);
+
+        // Exclusive sum to obtain offsets from what we just received
+        hA_ext_row_ptr_recv[0] = 0;
+        for(int i = 0; i < A_ext_m_recv; ++i)
+        {
+            hA_ext_row_ptr_recv[i + 1] += hA_ext_row_ptr_recv[i];
+        }
+
+        // Number of non-zeros we are going to receive
+        A_ext_nnz_recv = hA_ext_row_ptr_recv[A_ext_m_recv];
+
+        // Prepare communication buffers
+        PtrType*   pA_ext_row_ptr_send        = NULL;
+        int64_t*   pA_ext_col_ind_send_global = NULL;
+        ValueType* pA_ext_val_send            = NULL;
+
+        int64_t*   pA_ext_col_ind_recv_global = NULL;
+        ValueType* pA_ext_val_recv            = NULL;
+
+        // Allocate receive buffers
+        allocate_host(A_ext_nnz_recv, &pA_ext_col_ind_recv_global);
+        allocate_host(A_ext_nnz_recv, &pA_ext_val_recv);
+
+        // Obtain send buffers
+        A_ext_row_ptr_send.MoveToHost();
+        A_ext_row_ptr_send.LeaveDataPtr(&pA_ext_row_ptr_send);
+        A_ext_col_ind_send_global.MoveToHost();
+        A_ext_col_ind_send_global.LeaveDataPtr(&pA_ext_col_ind_send_global);
+        A_ext_val_send.MoveToHost();
+        A_ext_val_send.LeaveDataPtr(&pA_ext_val_send);
+
+        // Initiate communication of column indices and values
+        this->pm_->CommunicateCSRAsync_(pA_ext_row_ptr_send,
+                                        pA_ext_col_ind_send_global,
+                                        pA_ext_val_send,
+                                        hA_ext_row_ptr_recv,
+                                        pA_ext_col_ind_recv_global,
+                                        pA_ext_val_recv);
+
+        // Synchronize communication
+        this->pm_->CommunicateCSRSync_();
+
+        // Clean up send buffers
+        free_host(&pA_ext_row_ptr_send);
+        free_host(&pA_ext_val_send);
+        free_host(&pA_ext_col_ind_send_global);
+
+        // Put received data into structure
+        LocalVector<PtrType>   A_ext_row_ptr_recv_full;
+        LocalVector<int64_t>   A_ext_col_ind_recv_full;
+        LocalVector<ValueType> A_ext_val_recv_full;
+
+        A_ext_row_ptr_recv_full.SetDataPtr(&hA_ext_row_ptr_recv, "", A_ext_m_recv + 1);
+        A_ext_col_ind_recv_full.SetDataPtr(&pA_ext_col_ind_recv_global, "", A_ext_nnz_recv);
+        A_ext_val_recv_full.SetDataPtr(&pA_ext_val_recv, "", A_ext_nnz_recv);
+
+        A_ext_row_ptr_recv_full.CloneBackend(*this);
+        A_ext_col_ind_recv_full.CloneBackend(*this);
+        A_ext_val_recv_full.CloneBackend(*this);
+
+        // Fill column indices and values of P
+        LocalVector<int64_t> ghost_col;
+        ghost_col.CloneBackend(*this);
+
+        int_ptr->matrix_->RSExtPIProlongFill(global_col_begin,
+                                             global_col_end,
+                                             FF1,
+                                             *l2g.vector_,
+                                             *f2c_map.vector_,
+                                             *CFmap.vector_,
+                                             *S.vector_,
+                                             *gst_ptr->matrix_,
+                                             *A_ext_row_ptr_recv.vector_,
+                                             *A_ext_col_ind_recv.vector_,
+                                             *A_ext_row_ptr_recv_full.vector_,
+                                             *A_ext_col_ind_recv_full.vector_,
+                                             *A_ext_val_recv_full.vector_,
+                                             prolong->matrix_interior_.matrix_,
+                                             prolong->matrix_ghost_.matrix_,
+                                             ghost_col.vector_);
+
+        // Clear
+        A_ext_col_ind_recv.Clear();
+
+        // Finally, generate the parallel manager for prolongation operator
+        // For this, we need to access the ghost columns.
+        // Additionally, we need the fine to coarse map in order to convert the
+        // received boundary indices to coarse.
+
+        // Ghost of P MUST be CSR
+        assert(prolong->matrix_ghost_.GetFormat() == CSR);
+
+        // Communicate global sizes of P
+        int64_t global_ncol;
+        int64_t local_ncol = prolong->matrix_interior_.GetN();
+
+#ifdef SUPPORT_MULTINODE
+        MRequest req;
+        communication_async_allreduce_single_sum(&local_ncol, &global_ncol, this->pm_->comm_, &req);
+#endif
+
+        // Setup parallel manager of P
+        prolong->CreateParallelManager_();
+        prolong->pm_self_->SetMPICommunicator(this->pm_->comm_);
+
+        // To generate the parallel manager, we need to access the sorted global ghost column ids
+        LocalVector<int64_t> sorted_ghost_col;
+        sorted_ghost_col.CloneBackend(*this);
+        sorted_ghost_col.Allocate("sorted global ghost columns", ghost_col.GetSize());
+
+        // Sort the global ghost columns (we do not need the permutation vector)
+        ghost_col.Sort(&sorted_ghost_col, NULL);
+
+        // Get the sorted ghost columns on host
+        int64_t* pghost_col = NULL;
+        sorted_ghost_col.MoveToHost();
+        sorted_ghost_col.LeaveDataPtr(&pghost_col);
+
+#ifdef SUPPORT_MULTINODE
+        communication_sync(&req);
+#endif
+
+        // Sizes
+        prolong->pm_self_->SetGlobalNrow(this->pm_->global_nrow_);
+        prolong->pm_self_->SetGlobalNcol(global_ncol);
+        prolong->pm_self_->SetLocalNrow(this->pm_->local_nrow_);
+        prolong->pm_self_->SetLocalNcol(local_ncol);
+
+        // Generate the PM
+        prolong->pm_self_->GenerateFromGhostColumnsWithParent_(
+            prolong->matrix_ghost_.GetNnz(), pghost_col, *this->pm_);
+
+        // Communicate offsets
+        prolong->pm_self_->CommunicateGlobalOffsetAsync_();
+
+        // This is a prolongation operator, means we need to convert the global
+        // fine boundary columns from to local coarse columns
+        // Convert local boundary columns from global fine to local coarse
+        int* f2c = NULL;
+        f2c_map.MoveToHost();
+        f2c_map.LeaveDataPtr(&f2c);
+
+        // Clear
+        free_host(&pghost_col);
+
+        // Sync global offsets communication
+        prolong->pm_self_->CommunicateGlobalOffsetSync_();
+
+        // Convert local boundary columns from global fine to local coarse
+        prolong->pm_self_->BoundaryTransformGlobalFineToLocalCoarse_(f2c);
+
+        // Clear
+        free_host(&f2c);
+
+        // Communicate ghost to global map
+        prolong->pm_self_->CommunicateGhostToGlobalMapAsync_();
+
+        // Finally, renumber ghost columns (from global to local)
+        // We couldn't do this earlier, because the parallel manager need
+        // to know the global ghost column ids
+        prolong->matrix_ghost_.matrix_->RenumberGlobalToLocal(*ghost_col.vector_);
+
+        // Synchronize
+        prolong->pm_self_->CommunicateGhostToGlobalMapSync_();
+
+        prolong->SetParallelManager(*prolong->pm_self_);
+
+        // Rename P
+        prolong->object_name_ = "Prolongation Operator of " + this->object_name_;
+
+        if(this->GetFormat() != CSR)
+        {
+            LOG_VERBOSE_INFO(
+                2, "*** warning: GlobalMatrix::RSExtPIInterpolation() is performed in CSR format");
+        }
+
+#ifdef DEBUG_MODE
+        prolong->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::Repartition(int num_vec, GlobalVector<ValueType>** vec)
+    {
+        log_debug(this, "GlobalMatrix::Repartition()", num_vec, vec);
+
+        assert(num_vec >= 0);
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+        if(num_vec > 0)
+        {
+            assert(vec != NULL);
+        }
+
+#ifdef SUPPORT_MULTINODE
+        if(this->pm_->global_nrow_ != this->pm_->global_ncol_)
+        {
+            LOG_INFO("Repartition: matrix has to be square");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        const void* comm      = this->pm_->comm_;
+        int         rank      = this->pm_->rank_;
+        int         num_procs = this->pm_->num_procs_;
+
+        int64_t global_nrow = this->pm_->global_nrow_;
+        int64_t local_nrow  = this->pm_->local_nrow_;
+
+        for(int k = 0; k < num_vec; ++k)
+        {
+            assert(vec[k] != NULL);
+            assert(vec[k]->GetLocalSize() == local_nrow);
+        }
+
+        // Local rows with ascending global column indices
+        PtrType*   row_offset = NULL;
+        int64_t*   col        = NULL;
+        ValueType* val        = NULL;
+
+        this->ExtractGlobalRows_(&row_offset, &col, &val);
+
+        // Current row and non-zero distribution
+        int64_t local_nnz = row_offset[local_nrow];
+
+        std::vector<int64_t> local_rows(num_procs);
+        std::vector<int64_t> local_nnzs(num_procs);
+
+        communication_sync_allgather_single(&local_nrow, local_rows.data(), comm);
+        communication_sync_allgather_single(&local_nnz, local_nnzs.data(), comm);
+
+        std::vector<int64_t> old_offset(num_procs + 1, 0);
+
+        int64_t nnz_begin = 0;
+        int64_t nnz       = 0;
+
+        for(int n = 0; n < num_procs; ++n)
+        {
+            old_offset[n + 1] = old_offset[n] + local_rows[n];
+
+            nnz_begin += (n < rank) ? local_nnzs[n] : 0;
+            nnz += local_nnzs[n];
+        }
+
+        // Process n starts at the first row that is preceded by at least n / num_procs
+        // of all non-zero entries. Each split is determined by the process that owns it.
+        std::vector<int64_t> split(num_procs + 1, 0);
+        std::vector<int64_t> new_offset(num_procs + 1, 0);
+
+        for(int n = 1; n < num_procs; ++n)
+        {
+            int64_t target = nnz / num_procs * n + (nnz % num_procs) * n / num_procs;
+
+            if(target > nnz_begin && target <= nnz_begin + local_nnz)
+            {
+                PtrType* pos = std::lower_bound(
+                    row_offset + 1, row_offset + local_nrow + 1, target - nnz_begin);
+
+                split[n] = old_offset[rank] + (pos - row_offset);
+            }
+        }
+
+        communication_sync_allreduce_sum(split.data(), new_offset.data(), num_procs + 1, comm);
+
+        new_offset[num_procs] = global_nrow;
+
+        // Nothing to do, if the distribution does not change
+        if(new_offset == old_offset)
+        {
+            free_host(&row_offset);
+            free_host(&col);
+            free_host(&val);
+
+            return;
+        }
+
+        int64_t new_nrow = new_offset[rank + 1] - new_offset[rank];
+
+        this->MigrateRows_(&row_offset,
+                           &col,
+                           &val,
+                           old_offset.data(),
+                           new_offset.data(),
+                           new_nrow,
+                           num_vec,
+                           vec);
+#endif
+    }
 
-        // Start with fresh P operator
-        prolong->Clear();
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::Repartition(int64_t                   local_nrow,
+                                              int64_t                   local_ncol,
+                                              int                       num_vec,
+                                              GlobalVector<ValueType>** vec)
+    {
+        log_debug(this, "GlobalMatrix::Repartition()", local_nrow, local_ncol, num_vec, vec);
 
-        // Communication sizes
-        int nsend = this->pm_->GetNumSenders();
-        int nrecv = this->pm_->GetNumReceivers();
+        assert(local_nrow >= 0);
+        assert(local_ncol >= 0);
+        assert(num_vec >= 0);
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
 
-        // To do Ext+I interpolation, we need to fetch additional rows of A, such that
-        // we can locally access all rows that do not belong to the current rank, but
-        // are required due to column dependencies.
-        // This means, we have to send all rows of A where A has a dependency on to
-        // the neighboring rank
-        int A_ext_m_send = nsend;
+        if(num_vec > 0)
+        {
+            assert(vec != NULL);
+        }
 
-        // First, count the total number of non-zero entries per boundary row that are strongly connected
-        // and coarse points, including ghost part (we need to send full rows, not only interior)
-        LocalVector<PtrType> A_ext_row_ptr_send;
-        A_ext_row_ptr_send.CloneBackend(*this);
-        A_ext_row_ptr_send.Allocate("A ext row ptr", A_ext_m_send + 1);
+#ifdef SUPPORT_MULTINODE
+        const void* comm      = this->pm_->comm_;
+        int         num_procs = this->pm_->num_procs_;
 
-        int_ptr->matrix_->RSExtPIBoundaryNnz(*this->halo_.vector_,
-                                             *CFmap.vector_,
-                                             *S.vector_,
-                                             *gst_ptr->matrix_,
-                                             A_ext_row_ptr_send.vector_);
+        for(int k = 0; k < num_vec; ++k)
+        {
+            assert(vec[k] != NULL);
+            assert(vec[k]->GetLocalSize() == this->pm_->local_nrow_);
+        }
 
-        // Transfer send buffer to host
-        PtrType* send_buffer = NULL;
-        allocate_host(A_ext_m_send + 1, &send_buffer);
-        A_ext_row_ptr_send.CopyToHostData(send_buffer);
+        // Current and requested row distribution
+        int64_t old_nrow = this->pm_->local_nrow_;
 
-        // Number of rows of A we receive from our neighbors
-        int A_ext_m_recv = nrecv;
+        std::vector<int64_t> old_rows(num_procs);
+        std::vector<int64_t> new_rows(num_procs);
 
-        // Host receive buffer
-        PtrType* hA_ext_row_nnz_recv = NULL;
-        allocate_host(A_ext_m_recv + 1, &hA_ext_row_nnz_recv);
+        communication_sync_allgather_single(&old_nrow, old_rows.data(), comm);
+        communication_sync_allgather_single(&local_nrow, new_rows.data(), comm);
 
-        // Initiate communication of nnz per row (async)
-        this->pm_->CommunicateAsync_(send_buffer, hA_ext_row_nnz_recv);
+        std::vector<int64_t> old_offset(num_procs + 1, 0);
+        std::vector<int64_t> new_offset(num_procs + 1, 0);
 
-        // Extract ghost to global map
-        LocalVector<int64_t> l2g;
-        l2g.CloneBackend(*this);
-        l2g.Allocate("A ghost map", nrecv);
-        l2g.CopyFromHostData(this->pm_->GetGhostToGlobalMap());
+        for(int n = 0; n < num_procs; ++n)
+        {
+            old_offset[n + 1] = old_offset[n] + old_rows[n];
+            new_offset[n + 1] = new_offset[n] + new_rows[n];
+        }
 
-        // Exclusive sum to obtain row pointers
-        PtrType A_ext_nnz_send = A_ext_row_ptr_send.ExclusiveSum();
+        int64_t global_ncol;
+        int     ncol_changed = (local_ncol != this->pm_->local_ncol_) ? 1 : 0;
+        int     changed;
 
-        // Global column offset for this rank
-        int64_t global_col_begin = this->pm_->GetGlobalColumnBegin();
-        int64_t global_col_end   = this->pm_->GetGlobalColumnEnd();
+        communication_sync_allreduce_single_sum(&local_ncol, &global_ncol, comm);
+        communication_sync_allreduce_single_max(&ncol_changed, &changed, comm);
 
-        // Now, extract boundary column indices and values of all strongly connected coarse points
-        LocalVector<int64_t> A_ext_col_ind_send;
-        A_ext_col_ind_send.CloneBackend(*this);
-        A_ext_col_ind_send.Allocate("A ext col ind send", A_ext_nnz_send);
+        if(new_offset[num_procs] != this->pm_->global_nrow_
+           || global_ncol != this->pm_->global_ncol_)
+        {
+            LOG_INFO("Repartition: local sizes do not match the global matrix size");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
 
-        int_ptr->matrix_->RSExtPIExtractBoundary(global_col_begin,
-                                                 *this->halo_.vector_,
-                                                 *l2g.vector_,
-                                                 *CFmap.vector_,
-                                                 *S.vector_,
-                                                 *gst_ptr->matrix_,
-                                                 *A_ext_row_ptr_send.vector_,
-                                                 A_ext_col_ind_send.vector_);
+        // Nothing to do, if the distribution does not change
+        if(new_offset == old_offset && changed == 0)
+        {
+            return;
+        }
 
-        // Allocate row pointer array
-        LocalVector<PtrType> A_ext_row_ptr_recv;
+        // Local rows with ascending global column indices
+        PtrType*   row_offset = NULL;
+        int64_t*   col        = NULL;
+        ValueType* val        = NULL;
+
+        this->ExtractGlobalRows_(&row_offset, &col, &val);
+
+        this->MigrateRows_(&row_offset,
+                           &col,
+                           &val,
+                           old_offset.data(),
+                           new_offset.data(),
+                           local_ncol,
+                           num_vec,
+                           vec);
+#endif
+    }
 
-        // Synchronize communication
+    template <typename ValueType>
+    bool GlobalMatrix<ValueType>::Agglomerate(int64_t                  min_rows,
+                                              GlobalMatrix<ValueType>* res,
+                                              GlobalMatrix<ValueType>* pro)
+    {
+        log_debug(this, "GlobalMatrix::Agglomerate()", min_rows, res, pro);
+
+        assert(min_rows > 0);
+        assert(res != this);
+        assert(pro != this);
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+#ifdef SUPPORT_MULTINODE
+        if(this->pm_->global_nrow_ != this->pm_->global_ncol_)
+        {
+            LOG_INFO("Agglomerate: matrix has to be square");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        const void* comm      = this->pm_->comm_;
+        int         rank      = this->pm_->rank_;
+        int         num_procs = this->pm_->num_procs_;
+
+        int64_t nrow = this->pm_->global_nrow_;
+
+        // Number of processes that currently hold rows
+        int local_active = (this->pm_->local_nrow_ > 0) ? 1 : 0;
+        int active;
+
+        communication_sync_allreduce_single_sum(&local_active, &active, comm);
+
+        if(active <= 1 || nrow >= min_rows * active)
+        {
+            return false;
+        }
+
+        // Transfer operators that are local to each process are distributed with the
+        // current coarse and fine distribution
+        if((res != NULL && res->pm_ == NULL) || (pro != NULL && pro->pm_ == NULL))
+        {
+            int64_t coarse_begin = this->pm_->GetGlobalRowBegin();
+            int64_t fine_nrow
+                = (res != NULL) ? res->matrix_interior_.GetN() : pro->matrix_interior_.GetM();
+
+            std::vector<int64_t> fine_rows(num_procs);
+            communication_sync_allgather_single(&fine_nrow, fine_rows.data(), comm);
+
+            int64_t fine_begin = 0;
+            int64_t fine_size  = 0;
+
+            for(int n = 0; n < num_procs; ++n)
+            {
+                fine_begin += (n < rank) ? fine_rows[n] : 0;
+                fine_size += fine_rows[n];
+            }
+
+            if(res != NULL && res->pm_ == NULL)
+            {
+                res->DistributeLocalOperator_(comm, nrow, fine_size, fine_begin);
+            }
+
+            if(pro != NULL && pro->pm_ == NULL)
+            {
+                pro->DistributeLocalOperator_(comm, fine_size, nrow, coarse_begin);
+            }
+        }
+
+        // Distribute the rows evenly among the first processes
+        int64_t nprocs = std::max(nrow / min_rows, static_cast<int64_t>(1));
+        int64_t local_nrow
+            = (rank < nprocs) ? nrow / nprocs + ((rank < nrow % nprocs) ? 1 : 0) : 0;
+
+        this->Repartition(local_nrow, local_nrow);
+
+        if(res != NULL)
+        {
+            res->Repartition(local_nrow, res->pm_->local_ncol_);
+        }
+
+        if(pro != NULL)
+        {
+            pro->Repartition(pro->pm_->local_nrow_, local_nrow);
+        }
+
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::DistributeLocalOperator_(const void* comm,
+                                                           int64_t     global_nrow,
+                                                           int64_t     global_ncol,
+                                                           int64_t     col_begin)
+    {
+        assert(this->pm_ == NULL);
+
+        // Host CSR copy of the local operator
+        LocalMatrix<ValueType> local;
+
+        local.CloneFrom(this->matrix_interior_);
+        local.MoveToHost();
+
+        int64_t local_nrow = local.GetM();
+        int64_t local_ncol = local.GetN();
+        int64_t nnz        = local.GetNnz();
+
+        PtrType*   row_offset = NULL;
+        int*       local_col  = NULL;
+        ValueType* val        = NULL;
+
+        local.LeaveDataPtrCSR(&row_offset, &local_col, &val);
+
+        // Global column indices
+        std::vector<int64_t> col(nnz);
+
+        for(int64_t j = 0; j < nnz; ++j)
+        {
+            col[j] = col_begin + local_col[j];
+        }
+
+        std::string name = this->object_name_;
+
+        this->GenerateFromGlobalRows_(comm,
+                                      global_nrow,
+                                      global_ncol,
+                                      local_nrow,
+                                      local_ncol,
+                                      row_offset,
+                                      col.data(),
+                                      val,
+                                      name);
+
+        free_host(&row_offset);
+        free_host(&local_col);
+        free_host(&val);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::MigrateRows_(PtrType**                 row_offset,
+                                               int64_t**                 col,
+                                               ValueType**               val,
+                                               const int64_t*            old_offset,
+                                               const int64_t*            new_offset,
+                                               int64_t                   local_ncol,
+                                               int                       num_vec,
+                                               GlobalVector<ValueType>** vec)
+    {
+        assert(row_offset != NULL);
+        assert(col != NULL);
+        assert(val != NULL);
+        assert(old_offset != NULL);
+        assert(new_offset != NULL);
+
+#ifdef SUPPORT_MULTINODE
+        const void* comm      = this->pm_->comm_;
+        int         rank      = this->pm_->rank_;
+        int         num_procs = this->pm_->num_procs_;
+
+        int64_t global_nrow = this->pm_->global_nrow_;
+        int64_t global_ncol = this->pm_->global_ncol_;
+        int64_t local_nrow  = this->pm_->local_nrow_;
+
+        int64_t new_nrow = new_offset[rank + 1] - new_offset[rank];
+
+        // Number of entries per row, that are sent
+        std::vector<PtrType> row_nnz(local_nrow);
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            row_nnz[i] = (*row_offset)[i + 1] - (*row_offset)[i];
+        }
+
+        PtrType*   new_row_offset = NULL;
+        int64_t*   new_col        = NULL;
+        ValueType* new_val        = NULL;
+
+        allocate_host(new_nrow + 1, &new_row_offset);
+
+        new_row_offset[0] = 0;
+
+        std::vector<MRequest> req;
+        req.reserve(2 * num_procs * (3 + num_vec));
+
+        // Exchange the row lengths
+        for(int n = 0; n < num_procs; ++n)
+        {
+            // Rows of process n that are moved to this process and vice versa
+            int64_t recv_begin = std::max(old_offset[n], new_offset[rank]);
+            int64_t recv_end   = std::min(old_offset[n + 1], new_offset[rank + 1]);
+            int64_t send_begin = std::max(old_offset[rank], new_offset[n]);
+            int64_t send_end   = std::min(old_offset[rank + 1], new_offset[n + 1]);
+
+            if(recv_begin < recv_end)
+            {
+                req.push_back(MRequest());
+                communication_async_recv(new_row_offset + 1 + recv_begin - new_offset[rank],
+                                         recv_end - recv_begin,
+                                         n,
+                                         0,
+                                         &req.back(),
+                                         comm);
+            }
+
+            if(send_begin < send_end)
+            {
+                req.push_back(MRequest());
+                communication_async_send(row_nnz.data() + send_begin - old_offset[rank],
+                                         send_end - send_begin,
+                                         n,
+                                         0,
+                                         &req.back(),
+                                         comm);
+            }
+        }
+
+        communication_syncall(req.size(), req.data());
+        req.clear();
+
+        for(int64_t i = 0; i < new_nrow; ++i)
+        {
+            new_row_offset[i + 1] += new_row_offset[i];
+        }
+
+        int64_t new_nnz = new_row_offset[new_nrow];
+
+        allocate_host(new_nnz, &new_col);
+        allocate_host(new_nnz, &new_val);
+
+        // Vector values on the host
+        std::vector<std::vector<ValueType>> vec_val(num_vec);
+        std::vector<std::vector<ValueType>> new_vec_val(num_vec);
+
+        for(int k = 0; k < num_vec; ++k)
+        {
+            vec_val[k].resize(local_nrow);
+            new_vec_val[k].resize(new_nrow);
+
+            vec[k]->vector_interior_.CopyToHostData(vec_val[k].data());
+        }
+
+        // Exchange column indices, values and vector entries
+        for(int n = 0; n < num_procs; ++n)
+        {
+            int64_t recv_begin = std::max(old_offset[n], new_offset[rank]);
+            int64_t recv_end   = std::min(old_offset[n + 1], new_offset[rank + 1]);
+            int64_t send_begin = std::max(old_offset[rank], new_offset[n]);
+            int64_t send_end   = std::min(old_offset[rank + 1], new_offset[n + 1]);
+
+            if(recv_begin < recv_end)
+            {
+                int64_t row_begin = recv_begin - new_offset[rank];
+                int64_t row_end   = recv_end - new_offset[rank];
+                int64_t begin     = new_row_offset[row_begin];
+                int64_t size      = new_row_offset[row_end] - begin;
+
+                req.push_back(MRequest());
+                communication_async_recv(new_col + begin, size, n, 1, &req.back(), comm);
+                req.push_back(MRequest());
+                communication_async_recv(new_val + begin, size, n, 2, &req.back(), comm);
+
+                for(int k = 0; k < num_vec; ++k)
+                {
+                    req.push_back(MRequest());
+                    communication_async_recv(new_vec_val[k].data() + row_begin,
+                                             row_end - row_begin,
+                                             n,
+                                             3 + k,
+                                             &req.back(),
+                                             comm);
+                }
+            }
+
+            if(send_begin < send_end)
+            {
+                int64_t row_begin = send_begin - old_offset[rank];
+                int64_t row_end   = send_end - old_offset[rank];
+                int64_t begin     = (*row_offset)[row_begin];
+                int64_t size      = (*row_offset)[row_end] - begin;
+
+                req.push_back(MRequest());
+                communication_async_send(*col + begin, size, n, 1, &req.back(), comm);
+                req.push_back(MRequest());
+                communication_async_send(*val + begin, size, n, 2, &req.back(), comm);
+
+                for(int k = 0; k < num_vec; ++k)
+                {
+                    req.push_back(MRequest());
+                    communication_async_send(vec_val[k].data() + row_begin,
+                                             row_end - row_begin,
+                                             n,
+                                             3 + k,
+                                             &req.back(),
+                                             comm);
+                }
+            }
+        }
+
+        communication_syncall(req.size(), req.data());
+
+        free_host(row_offset);
+        free_host(col);
+        free_host(val);
+
+        // Regenerate the matrix in its current format
+        unsigned int format   = this->matrix_interior_.GetFormat();
+        int          blockdim = this->matrix_interior_.GetBlockDimension();
+        std::string  name     = this->object_name_;
+
+        this->GenerateFromGlobalRows_(comm,
+                                      global_nrow,
+                                      global_ncol,
+                                      new_nrow,
+                                      local_ncol,
+                                      new_row_offset,
+                                      new_col,
+                                      new_val,
+                                      name);
+
+        free_host(&new_row_offset);
+        free_host(&new_col);
+        free_host(&new_val);
+
+        if(format != CSR)
+        {
+            this->ConvertTo(format, blockdim);
+        }
+
+        // Attach the vectors to the new distribution
+        for(int k = 0; k < num_vec; ++k)
+        {
+            vec[k]->SetParallelManager(*this->pm_);
+            vec[k]->vector_interior_.Allocate("Interior of " + vec[k]->object_name_, new_nrow);
+            vec[k]->vector_interior_.CopyFromHostData(new_vec_val[k].data());
+        }
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ExtractHostCSR_(PtrType**   int_row_offset,
+                                                  int**       int_col,
+                                                  ValueType** int_val,
+                                                  PtrType**   gst_row_offset,
+                                                  int**       gst_col,
+                                                  ValueType** gst_val) const
+    {
+        assert(*int_row_offset == NULL);
+        assert(*gst_row_offset == NULL);
+
+        int64_t local_nrow = this->pm_->local_nrow_;
+
+        LocalMatrix<ValueType> interior;
+        LocalMatrix<ValueType> ghost;
+
+        interior.CloneFrom(this->matrix_interior_);
+        ghost.CloneFrom(this->matrix_ghost_);
+
+        interior.MoveToHost();
+        ghost.MoveToHost();
+
+        int64_t interior_nnz = interior.GetNnz();
+        int64_t ghost_nnz    = ghost.GetNnz();
+
+        interior.LeaveDataPtrCSR(int_row_offset, int_col, int_val);
+        ghost.LeaveDataPtrCSR(gst_row_offset, gst_col, gst_val);
+
+        // Empty parts might come without valid row offsets
+        if(interior_nnz == 0)
+        {
+            free_host(int_row_offset);
+            allocate_host(local_nrow + 1, int_row_offset);
+            set_to_zero_host(local_nrow + 1, *int_row_offset);
+        }
+
+        if(ghost_nnz == 0)
+        {
+            free_host(gst_row_offset);
+            allocate_host(local_nrow + 1, gst_row_offset);
+            set_to_zero_host(local_nrow + 1, *gst_row_offset);
+        }
+    }
+
+    template <typename ValueType>
+    template <typename DataType>
+    void GlobalMatrix<ValueType>::CommunicateBoundary_(const DataType* in, DataType* ghost) const
+    {
+        int nsend = this->pm_->GetNumSenders();
+
+        DataType* send_buffer = NULL;
+        allocate_host(nsend, &send_buffer);
+
+        for(int i = 0; i < nsend; ++i)
+        {
+            send_buffer[i] = in[this->pm_->boundary_index_[i]];
+        }
+
+        this->pm_->CommunicateAsync_(send_buffer, ghost);
         this->pm_->CommunicateSync_();
 
-        // Place our received data into structure
-        A_ext_row_ptr_recv.SetDataPtr(&hA_ext_row_nnz_recv, "A ext row ptr", A_ext_m_recv + 1);
-        A_ext_row_ptr_recv.CloneBackend(*this);
+        free_host(&send_buffer);
+    }
 
-        // Obtain row pointers
-        PtrType A_ext_nnz_recv = A_ext_row_ptr_recv.ExclusiveSum();
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ExtractGlobalRows_(PtrType**   row_offset,
+                                                     int64_t**   col,
+                                                     ValueType** val) const
+    {
+        assert(row_offset != NULL);
+        assert(col != NULL);
+        assert(val != NULL);
+        assert(*row_offset == NULL);
+        assert(*col == NULL);
+        assert(*val == NULL);
+
+        int64_t local_nrow = this->pm_->local_nrow_;
+        int64_t col_begin  = this->pm_->GetGlobalColumnBegin();
+
+        const int64_t* ghost_map = this->pm_->GetGhostToGlobalMap();
+
+        PtrType*   int_ptr = NULL;
+        int*       int_col = NULL;
+        ValueType* int_val = NULL;
+        PtrType*   gst_ptr = NULL;
+        int*       gst_col = NULL;
+        ValueType* gst_val = NULL;
+
+        this->ExtractHostCSR_(&int_ptr, &int_col, &int_val, &gst_ptr, &gst_col, &gst_val);
+
+        int64_t interior_nnz = int_ptr[local_nrow];
+        int64_t ghost_nnz    = gst_ptr[local_nrow];
+
+        allocate_host(local_nrow + 1, row_offset);
+        allocate_host(interior_nnz + ghost_nnz, col);
+        allocate_host(interior_nnz + ghost_nnz, val);
+
+        // Merge interior and ghost into rows with ascending global column indices
+        std::vector<std::pair<int64_t, ValueType>> row;
+
+        (*row_offset)[0] = 0;
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            row.clear();
+
+            for(PtrType j = int_ptr[i]; j < int_ptr[i + 1]; ++j)
+            {
+                row.push_back(std::make_pair(col_begin + int_col[j], int_val[j]));
+            }
 
-        // We need a copy of A_ext_row_ptr on the host for communication
-        PtrType* hA_ext_row_ptr_recv = NULL;
-        allocate_host(A_ext_m_recv + 1, &hA_ext_row_ptr_recv);
-        A_ext_row_ptr_recv.CopyToHostData(hA_ext_row_ptr_recv);
+            for(PtrType j = gst_ptr[i]; j < gst_ptr[i + 1]; ++j)
+            {
+                row.push_back(std::make_pair(ghost_map[gst_col[j]], gst_val[j]));
+            }
 
-        // We need a copy of A_ext_col_ind_send on host for communication
-        int64_t* pA_ext_col_ind_send = NULL;
-        A_ext_col_ind_send.MoveToHost();
-        A_ext_col_ind_send.LeaveDataPtr(&pA_ext_col_ind_send);
+            std::sort(row.begin(),
+                      row.end(),
+                      [](const std::pair<int64_t, ValueType>& a,
+                         const std::pair<int64_t, ValueType>& b) { return a.first < b.first; });
 
-        // Initiate communication of column indices and values
-        int64_t* hA_ext_col_ind_recv = NULL;
-        allocate_host(A_ext_nnz_recv, &hA_ext_col_ind_recv);
+            PtrType k = (*row_offset)[i];
 
-        // We need a copy of A_ext_row_ptr on host for communication
-        PtrType* hA_ext_row_ptr_send = NULL;
-        allocate_host(A_ext_m_send + 1, &hA_ext_row_ptr_send);
-        A_ext_row_ptr_send.CopyToHostData(hA_ext_row_ptr_send);
+            for(size_t j = 0; j < row.size(); ++j)
+            {
+                (*col)[k + j] = row[j].first;
+                (*val)[k + j] = row[j].second;
+            }
 
-        this->pm_->CommunicateCSRAsync_(hA_ext_row_ptr_send,
-                                        pA_ext_col_ind_send,
-                                        (ValueType*)NULL,
-                                        hA_ext_row_ptr_recv,
-                                        hA_ext_col_ind_recv,
-                                        (ValueType*)NULL);
+            (*row_offset)[i + 1] = k + row.size();
+        }
 
-        // fine to coarse map
-        LocalVector<int> f2c_map;
-        f2c_map.CloneBackend(*this);
-        f2c_map.Allocate("f2c map", int_ptr->GetM() + 1);
+        free_host(&int_ptr);
+        free_host(&int_col);
+        free_host(&int_val);
+        free_host(&gst_ptr);
+        free_host(&gst_col);
+        free_host(&gst_val);
+    }
 
-        // Synchronize communication
-        this->pm_->CommunicateCSRSync_();
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::FetchGhostRows_(const PtrType*   row_offset,
+                                                  const int64_t*   col,
+                                                  const ValueType* val,
+                                                  PtrType**        ghost_row_offset,
+                                                  int64_t**        ghost_col,
+                                                  ValueType**      ghost_val) const
+    {
+        assert(row_offset != NULL);
+        assert(ghost_row_offset != NULL);
+        assert(ghost_col != NULL);
+        assert(ghost_val != NULL);
 
-        // Clear
-        free_host(&hA_ext_row_ptr_send);
-        free_host(&pA_ext_col_ind_send);
+        int nsend  = this->pm_->GetNumSenders();
+        int nghost = this->pm_->GetNumReceivers();
 
-        LocalVector<int64_t> A_ext_col_ind_recv;
-        A_ext_col_ind_recv.SetDataPtr(&hA_ext_col_ind_recv, "A ext col ind", A_ext_nnz_recv);
-        A_ext_col_ind_recv.CloneBackend(*this);
+        // Exchange the length of the boundary rows
+        int* send_nnz = NULL;
+        int* recv_nnz = NULL;
 
-        // Determine number of non-zeros for P
-        int_ptr->matrix_->RSExtPIProlongNnz(global_col_begin,
-                                            global_col_end,
-                                            FF1,
-                                            *l2g.vector_,
-                                            *CFmap.vector_,
-                                            *S.vector_,
-                                            *gst_ptr->matrix_,
-                                            *A_ext_row_ptr_recv.vector_,
-                                            *A_ext_col_ind_recv.vector_,
-                                            f2c_map.vector_,
-                                            prolong->matrix_interior_.matrix_,
-                                            prolong->matrix_ghost_.matrix_);
+        allocate_host(nsend, &send_nnz);
+        allocate_host(nghost, &recv_nnz);
 
-        // Obtain neighboring rows
+        PtrType* send_ptr = NULL;
+        PtrType* recv_ptr = NULL;
 
-        // Count the non-zeros of each boundary row, including the ghost part
-        int_ptr->matrix_->ExtractBoundaryRowNnz(
-            A_ext_row_ptr_send.vector_, *this->halo_.vector_, *gst_ptr->matrix_);
+        allocate_host(nsend + 1, &send_ptr);
+        allocate_host(nghost + 1, &recv_ptr);
 
-        // Transfer send buffer to host
-        A_ext_row_ptr_send.CopyToHostData(send_buffer);
+        send_ptr[0] = 0;
+        for(int i = 0; i < nsend; ++i)
+        {
+            int row = this->pm_->boundary_index_[i];
 
-        // Initiate communication of nnz per row
-        this->pm_->CommunicateAsync_(send_buffer, &hA_ext_row_ptr_recv[1]);
+            send_nnz[i]     = static_cast<int>(row_offset[row + 1] - row_offset[row]);
+            send_ptr[i + 1] = send_ptr[i] + send_nnz[i];
+        }
 
-        // Exclusive sum to obtain row pointers of send buffer
-        A_ext_nnz_send = A_ext_row_ptr_send.ExclusiveSum();
+        this->pm_->CommunicateAsync_(send_nnz, recv_nnz);
 
-        // Extract the boundary nnz and convert them to global indices
-        LocalVector<ValueType> A_ext_val_send;
-        A_ext_val_send.CloneBackend(*this);
+        // Pack the boundary rows while the row lengths are in flight
+        int64_t*   send_col = NULL;
+        ValueType* send_val = NULL;
 
-        LocalVector<int64_t> A_ext_col_ind_send_global;
-        A_ext_col_ind_send_global.CloneBackend(*this);
-        A_ext_col_ind_send_global.Allocate("A ext col ind send", A_ext_nnz_send);
-        A_ext_val_send.Allocate("A ext val send", A_ext_nnz_send);
+        allocate_host(send_ptr[nsend], &send_col);
+        allocate_host(send_ptr[nsend], &send_val);
 
-        int_ptr->matrix_->ExtractBoundaryRows(*A_ext_row_ptr_send.vector_,
-                                              A_ext_col_ind_send_global.vector_,
-                                              A_ext_val_send.vector_,
-                                              global_col_begin,
-                                              *this->halo_.vector_,
-                                              *l2g.vector_,
-                                              *gst_ptr->matrix_);
+        for(int i = 0; i < nsend; ++i)
+        {
+            int row = this->pm_->boundary_index_[i];
 
-        // Wait for nnz per row communication to finish
-        this->pm_->CommunicateSync_();
+            copy_h2h(send_nnz[i], col + row_offset[row], send_col + send_ptr[i]);
+            copy_h2h(send_nnz[i], val + row_offset[row], send_val + send_ptr[i]);
+        }
 
-        // Clear
-        free_host(&send_buffer);
+        this->pm_->CommunicateSync_();
 
-        // Exclusive sum to obtain offsets from what we just received
-        hA_ext_row_ptr_recv[0] = 0;
-        for(int i = 0; i < A_ext_m_recv; ++i)
+        recv_ptr[0] = 0;
+        for(int i = 0; i < nghost; ++i)
         {
-            hA_ext_row_ptr_recv[i + 1] += hA_ext_row_ptr_recv[i];
+            recv_ptr[i + 1] = recv_ptr[i] + recv_nnz[i];
         }
 
-        // Number of non-zeros we are going to receive
-        A_ext_nnz_recv = hA_ext_row_ptr_recv[A_ext_m_recv];
+        int64_t*   recv_col = NULL;
+        ValueType* recv_val = NULL;
 
-        // Prepare communication buffers
-        PtrType*   pA_ext_row_ptr_send        = NULL;
-        int64_t*   pA_ext_col_ind_send_global = NULL;
-        ValueType* pA_ext_val_send            = NULL;
+        allocate_host(recv_ptr[nghost], &recv_col);
+        allocate_host(recv_ptr[nghost], &recv_val);
 
-        int64_t*   pA_ext_col_ind_recv_global = NULL;
-        ValueType* pA_ext_val_recv            = NULL;
+        // Exchange the boundary rows
+        this->pm_->CommunicateCSRAsync_(send_ptr, send_col, send_val, recv_ptr, recv_col, recv_val);
+        this->pm_->CommunicateCSRSync_();
 
-        // Allocate receive buffers
-        allocate_host(A_ext_nnz_recv, &pA_ext_col_ind_recv_global);
-        allocate_host(A_ext_nnz_recv, &pA_ext_val_recv);
+        free_host(&send_nnz);
+        free_host(&recv_nnz);
+        free_host(&send_ptr);
+        free_host(&send_col);
+        free_host(&send_val);
 
-        // Obtain send buffers
-        A_ext_row_ptr_send.MoveToHost();
-        A_ext_row_ptr_send.LeaveDataPtr(&pA_ext_row_ptr_send);
-        A_ext_col_ind_send_global.MoveToHost();
-        A_ext_col_ind_send_global.LeaveDataPtr(&pA_ext_col_ind_send_global);
-        A_ext_val_send.MoveToHost();
-        A_ext_val_send.LeaveDataPtr(&pA_ext_val_send);
+        *ghost_row_offset = recv_ptr;
+        *ghost_col        = recv_col;
+        *ghost_val        = recv_val;
+    }
 
-        // Initiate communication of column indices and values
-        this->pm_->CommunicateCSRAsync_(pA_ext_row_ptr_send,
-                                        pA_ext_col_ind_send_global,
-                                        pA_ext_val_send,
-                                        hA_ext_row_ptr_recv,
-                                        pA_ext_col_ind_recv_global,
-                                        pA_ext_val_recv);
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::GenerateFromGlobalRows_(const void*        comm,
+                                                          int64_t            global_nrow,
+                                                          int64_t            global_ncol,
+                                                          int64_t            local_nrow,
+                                                          int64_t            local_ncol,
+                                                          const PtrType*     row_offset,
+                                                          const int64_t*     col,
+                                                          const ValueType*   val,
+                                                          const std::string& name)
+    {
+        log_debug(this,
+                  "GlobalMatrix::GenerateFromGlobalRows_()",
+                  comm,
+                  global_nrow,
+                  global_ncol,
+                  local_nrow,
+                  local_ncol,
+                  row_offset,
+                  col,
+                  val,
+                  name);
+
+        assert(comm != NULL);
+        assert(row_offset != NULL);
+        assert(row_offset[0] == 0);
 
-        // Synchronize communication
-        this->pm_->CommunicateCSRSync_();
+#ifdef SUPPORT_MULTINODE
+        // Data is assembled on the host
+        bool on_accel = this->is_accel_();
 
-        // Clean up send buffers
-        free_host(&pA_ext_row_ptr_send);
-        free_host(&pA_ext_val_send);
-        free_host(&pA_ext_col_ind_send_global);
+        this->Clear();
+        this->MoveToHost();
 
-        // Put received data into structure
-        LocalVector<PtrType>   A_ext_row_ptr_recv_full;
-        LocalVector<int64_t>   A_ext_col_ind_recv_full;
-        LocalVector<ValueType> A_ext_val_recv_full;
+        // Manager that only provides the row and column distribution
+        ParallelManager parent;
 
-        A_ext_row_ptr_recv_full.SetDataPtr(&hA_ext_row_ptr_recv, "", A_ext_m_recv + 1);
-        A_ext_col_ind_recv_full.SetDataPtr(&pA_ext_col_ind_recv_global, "", A_ext_nnz_recv);
-        A_ext_val_recv_full.SetDataPtr(&pA_ext_val_recv, "", A_ext_nnz_recv);
+        int zero = 0;
 
-        A_ext_row_ptr_recv_full.CloneBackend(*this);
-        A_ext_col_ind_recv_full.CloneBackend(*this);
-        A_ext_val_recv_full.CloneBackend(*this);
+        parent.SetMPICommunicator(comm);
+        parent.SetGlobalNrow(global_nrow);
+        parent.SetGlobalNcol(global_ncol);
+        parent.SetLocalNrow(local_nrow);
+        parent.SetLocalNcol(local_ncol);
+        parent.SetReceivers(0, NULL, &zero);
+        parent.SetSenders(0, NULL, &zero);
 
-        // Fill column indices and values of P
-        LocalVector<int64_t> ghost_col;
-        ghost_col.CloneBackend(*this);
+        // Global column range of this process (collective)
+        int64_t col_begin = parent.GetGlobalColumnBegin();
+        int64_t col_end   = parent.GetGlobalColumnEnd();
 
-        int_ptr->matrix_->RSExtPIProlongFill(global_col_begin,
-                                             global_col_end,
-                                             FF1,
-                                             *l2g.vector_,
-                                             *f2c_map.vector_,
-                                             *CFmap.vector_,
-                                             *S.vector_,
-                                             *gst_ptr->matrix_,
-                                             *A_ext_row_ptr_recv.vector_,
-                                             *A_ext_col_ind_recv.vector_,
-                                             *A_ext_row_ptr_recv_full.vector_,
-                                             *A_ext_col_ind_recv_full.vector_,
-                                             *A_ext_val_recv_full.vector_,
-                                             prolong->matrix_interior_.matrix_,
-                                             prolong->matrix_ghost_.matrix_,
-                                             ghost_col.vector_);
+        int64_t nnz          = row_offset[local_nrow];
+        int64_t interior_nnz = 0;
 
-        // Clear
-        A_ext_col_ind_recv.Clear();
+        // Collect the global ids of all ghost columns
+        std::vector<int64_t> ghost_col;
 
-        // Finally, generate the parallel manager for prolongation operator
-        // For this, we need to access the ghost columns.
-        // Additionally, we need the fine to coarse map in order to convert the
-        // received boundary indices to coarse.
+        for(int64_t j = 0; j < nnz; ++j)
+        {
+            if(col[j] >= col_begin && col[j] < col_end)
+            {
+                ++interior_nnz;
+            }
+            else
+            {
+                ghost_col.push_back(col[j]);
+            }
+        }
 
-        // Ghost of P MUST be CSR
-        assert(prolong->matrix_ghost_.GetFormat() == CSR);
+        int64_t ghost_nnz = nnz - interior_nnz;
 
-        // Communicate global sizes of P
-        int64_t global_ncol;
-        int64_t local_ncol = prolong->matrix_interior_.GetN();
+        // Sorted and unique ghost columns determine the local ghost ids
+        std::sort(ghost_col.begin(), ghost_col.end());
+        ghost_col.erase(std::unique(ghost_col.begin(), ghost_col.end()), ghost_col.end());
 
-#ifdef SUPPORT_MULTINODE
-        MRequest req;
-        communication_async_allreduce_single_sum(&local_ncol, &global_ncol, this->pm_->comm_, &req);
-#endif
+        int64_t nghost = ghost_col.size();
 
-        // Setup parallel manager of P
-        prolong->CreateParallelManager_();
-        prolong->pm_self_->SetMPICommunicator(this->pm_->comm_);
+        // Generate the communication pattern from the ghost columns
+        this->CreateParallelManager_();
 
-        // To generate the parallel manager, we need to access the sorted global ghost column ids
-        LocalVector<int64_t> sorted_ghost_col;
-        sorted_ghost_col.CloneBackend(*this);
-        sorted_ghost_col.Allocate("sorted global ghost columns", ghost_col.GetSize());
+        this->pm_self_->SetMPICommunicator(comm);
+        this->pm_self_->SetGlobalNrow(global_nrow);
+        this->pm_self_->SetGlobalNcol(global_ncol);
+        this->pm_self_->SetLocalNrow(local_nrow);
+        this->pm_self_->SetLocalNcol(local_ncol);
 
-        // Sort the global ghost columns (we do not need the permutation vector)
-        ghost_col.Sort(&sorted_ghost_col, NULL);
+        this->pm_self_->GenerateFromGhostColumnsWithParent_(nghost, ghost_col.data(), parent);
 
-        // Get the sorted ghost columns on host
-        int64_t* pghost_col = NULL;
-        sorted_ghost_col.MoveToHost();
-        sorted_ghost_col.LeaveDataPtr(&pghost_col);
+        this->pm_self_->CommunicateGlobalOffsetAsync_();
+        this->pm_self_->CommunicateGlobalOffsetSync_();
+        this->pm_self_->global_offset_ = true;
 
-#ifdef SUPPORT_MULTINODE
-        communication_sync(&req);
-#endif
+        // Convert global boundary index into local index
+        this->pm_self_->BoundaryTransformGlobalToLocal_();
 
-        // Sizes
-        prolong->pm_self_->SetGlobalNrow(this->pm_->global_nrow_);
-        prolong->pm_self_->SetGlobalNcol(global_ncol);
-        prolong->pm_self_->SetLocalNrow(this->pm_->local_nrow_);
-        prolong->pm_self_->SetLocalNcol(local_ncol);
+        // The ghost to global mapping is known locally
+        if(nghost > 0)
+        {
+            copy_h2h(nghost, ghost_col.data(), this->pm_self_->ghost_mapping_);
+        }
 
-        // Generate the PM
-        prolong->pm_self_->GenerateFromGhostColumnsWithParent_(
-            prolong->matrix_ghost_.GetNnz(), pghost_col, *this->pm_);
+        this->pm_self_->ghost_to_global_map_ = true;
 
-        // Communicate offsets
-        prolong->pm_self_->CommunicateGlobalOffsetAsync_();
+        // Split the rows into interior and ghost part
+        PtrType*   int_row_offset = NULL;
+        int*       int_col        = NULL;
+        ValueType* int_val        = NULL;
+        PtrType*   gst_row_offset = NULL;
+        int*       gst_col        = NULL;
+        ValueType* gst_val        = NULL;
 
-        // This is a prolongation operator, means we need to convert the global
-        // fine boundary columns from to local coarse columns
-        // Convert local boundary columns from global fine to local coarse
-        int* f2c = NULL;
-        f2c_map.MoveToHost();
-        f2c_map.LeaveDataPtr(&f2c);
+        allocate_host(local_nrow + 1, &int_row_offset);
+        allocate_host(interior_nnz, &int_col);
+        allocate_host(interior_nnz, &int_val);
+        allocate_host(local_nrow + 1, &gst_row_offset);
+        allocate_host(ghost_nnz, &gst_col);
+        allocate_host(ghost_nnz, &gst_val);
 
-        // Clear
-        free_host(&pghost_col);
+        int_row_offset[0] = 0;
+        gst_row_offset[0] = 0;
 
-        // Sync global offsets communication
-        prolong->pm_self_->CommunicateGlobalOffsetSync_();
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            PtrType int_idx = int_row_offset[i];
+            PtrType gst_idx = gst_row_offset[i];
 
-        // Convert local boundary columns from global fine to local coarse
-        prolong->pm_self_->BoundaryTransformGlobalFineToLocalCoarse_(f2c);
+            for(PtrType j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                if(col[j] >= col_begin && col[j] < col_end)
+                {
+                    int_col[int_idx] = static_cast<int>(col[j] - col_begin);
+                    int_val[int_idx] = val[j];
 
-        // Clear
-        free_host(&f2c);
+                    ++int_idx;
+                }
+                else
+                {
+                    gst_col[gst_idx] = static_cast<int>(
+                        std::lower_bound(ghost_col.begin(), ghost_col.end(), col[j])
+                        - ghost_col.begin());
+                    gst_val[gst_idx] = val[j];
 
-        // Communicate ghost to global map
-        prolong->pm_self_->CommunicateGhostToGlobalMapAsync_();
+                    ++gst_idx;
+                }
+            }
 
-        // Finally, renumber ghost columns (from global to local)
-        // We couldn't do this earlier, because the parallel manager need
-        // to know the global ghost column ids
-        prolong->matrix_ghost_.matrix_->RenumberGlobalToLocal(*ghost_col.vector_);
+            int_row_offset[i + 1] = int_idx;
+            gst_row_offset[i + 1] = gst_idx;
+        }
 
-        // Synchronize
-        prolong->pm_self_->CommunicateGhostToGlobalMapSync_();
+        this->object_name_ = name;
+
+        this->matrix_interior_.SetDataPtrCSR(&int_row_offset,
+                                             &int_col,
+                                             &int_val,
+                                             "Interior of " + name,
+                                             interior_nnz,
+                                             local_nrow,
+                                             local_ncol);
+        this->matrix_ghost_.SetDataPtrCSR(&gst_row_offset,
+                                          &gst_col,
+                                          &gst_val,
+                                          "Ghost of " + name,
+                                          ghost_nnz,
+                                          local_nrow,
+                                          nghost);
 
-        prolong->SetParallelManager(*prolong->pm_self_);
+        this->matrix_ghost_.ConvertTo(COO);
 
-        // Rename P
-        prolong->object_name_ = "Prolongation Operator of " + this->object_name_;
+        // Initialize communication pattern
+        this->InitCommPattern_();
 
-        if(this->GetFormat() != CSR)
+        if(on_accel == true)
         {
-            LOG_VERBOSE_INFO(
-                2, "*** warning: GlobalMatrix::RSExtPIInterpolation() is performed in CSR format");
+            this->MoveToAccelerator();
         }
-
-#ifdef DEBUG_MODE
-        prolong->Check();
 #endif
     }
 
@@ -2892,6 +6267,9 @@ namespace rocalution
         this->recv_buffer_.Allocate("receive buffer", this->pm_->GetNumReceivers());
         this->send_buffer_.Allocate("send buffer", this->pm_->GetNumSenders());
 
+        // Reduced precision buffers are allocated on demand
+        this->FreeReducedHalo_();
+
         if(this->recv_boundary_ == NULL)
         {
             allocate_pinned(this->pm_->GetNumReceivers(), &this->recv_boundary_);
@@ -105,6 +105,19 @@ namespace rocalution
         /** \brief Set the parallel manager of a global matrix */
         void SetParallelManager(const ParallelManager& pm);
 
+        /** \brief Enable or disable reduced precision halo exchange
+      * \details
+      * If enabled, the boundary values that are exchanged during Apply(), ApplyAdd() and
+      * MultiApply() are sent in single precision and expanded to the precision of the
+      * matrix on the receiving side. This halves the communication volume of double
+      * precision operators at the cost of perturbing the ghost values by single precision
+      * round-off. The option is set per operator, such that e.g. the operators of a
+      * multigrid hierarchy or a preconditioner can use the reduced exchange while the
+      * operator of the outer Krylov method remains exact. Has no effect for single
+      * precision matrices. Disabled by default.
+      */
+        void SetReducedPrecisionHalo(bool reduced);
+
         /** \brief Initialize a CSR matrix on the host with externally allocated data */
         void SetDataPtrCSR(PtrType**   local_row_offset,
                            int**       local_col,
@@ -165,6 +178,8 @@ namespace rocalution
 
         /** \brief Clone the entire matrix (values,structure+backend descr) from another
       * GlobalMatrix
+      * \details
+      * The clone shares the parallel manager of \p src.
       */
         void CloneFrom(const GlobalMatrix<ValueType>& src);
         /** \brief Copy matrix (values and structure) from another GlobalMatrix */
@@ -193,6 +208,17 @@ namespace rocalution
         virtual void ApplyAdd(const GlobalVector<ValueType>& in,
                               ValueType                      scalar,
                               GlobalVector<ValueType>*       out) const;
+        virtual void MultiApply(int                                   num,
+                                const GlobalVector<ValueType>* const* in,
+                                GlobalVector<ValueType>**             out) const;
+
+        /** \brief Exchange the ghost values of a vector
+      * \details
+      * \p ghost holds the values of \p in that belong to the ghost columns of the matrix,
+      * in the column order of the ghost part.
+      */
+        void ExchangeGhostValues(const GlobalVector<ValueType>& in,
+                                 LocalVector<ValueType>*        ghost) const;
 
         /** \brief Transpose the matrix */
         virtual void Transpose(void);
@@ -205,6 +231,88 @@ namespace rocalution
                                  const GlobalMatrix<ValueType>& A,
                                  const GlobalMatrix<ValueType>& P);
 
+        /** \brief Multiply two matrices, this = A * B
+      * \details
+      * The rows of \p B that are required by the ghost columns of \p A are fetched from
+      * the neighboring processes, using the communication pattern of \p A.
+      */
+        void MatrixMult(const GlobalMatrix<ValueType>& A, const GlobalMatrix<ValueType>& B);
+
+        /** \brief Factorized Sparse Approximate Inverse assembly for given system matrix
+      * power pattern or external sparsity pattern
+      * \details
+      * The rows of the matrix that are required by the ghost columns of the pattern are
+      * fetched from the neighboring processes. Each process then computes the rows of the
+      * lower triangular factor that it owns. The external pattern has to be distributed
+      * like the rows of the matrix.
+      */
+        void FSAI(int power, const GlobalMatrix<ValueType>* pattern);
+
+        /** \brief SParse Approximate Inverse assembly for given system matrix pattern
+      * \details
+      * The columns of the approximate inverse are computed as the rows of its transpose,
+      * using the rows of the transposed matrix that are fetched from the neighboring
+      * processes.
+      */
+        void SPAI(void);
+
+        /** \brief Extract the local matrix of an overlapping subdomain
+      * \details
+      * The interior rows of this process are extended by \p overlap layers of rows that
+      * are owned by other processes, where each layer adds the rows that are coupled to
+      * the rows of the previous layers. The rows of \p mat are ordered by the interior rows,
+      * followed by the overlap rows in ascending global order. Couplings to rows outside of
+      * the extended subdomain are dropped. The ghost part of \p pattern is given by the
+      * overlap rows, such that ExchangeGhostValues() of \p pattern gathers the entries of a
+      * vector that belong to the overlap rows.
+      */
+        void ExtractOverlap(int                      overlap,
+                            LocalMatrix<ValueType>*  mat,
+                            GlobalMatrix<ValueType>* pattern) const;
+
+        /** \brief Redistribute the rows of the matrix to balance the number of non-zero
+      * entries among the processes
+      * \details
+      * Each process receives a contiguous range of global rows such that all processes
+      * hold approximately the same number of non-zero entries. The rows are migrated
+      * between the processes and the interior and ghost matrices as well as the parallel
+      * manager are regenerated. The \p num_vec vectors in \p vec have to be distributed
+      * like the rows of the matrix. Their values are migrated with the rows and they are
+      * attached to the new parallel manager of the matrix. All other vectors that use
+      * the parallel manager of the matrix have to be allocated again. The matrix has to
+      * be square.
+      *
+      * @param[in]
+      * num_vec number of vectors that are migrated with the matrix
+      * @param[inout]
+      * vec     array of vectors that are migrated with the matrix
+      */
+        void Repartition(int num_vec = 0, GlobalVector<ValueType>** vec = NULL);
+        /** \brief Redistribute the rows and columns of the matrix with given local sizes
+      * \details
+      * Each process receives the next \p local_nrow global rows and owns the next
+      * \p local_ncol global columns. The local sizes of all processes have to sum up to
+      * the global sizes of the matrix. The \p num_vec vectors in \p vec have to be
+      * distributed like the rows of the matrix and are migrated with the rows.
+      */
+        void Repartition(int64_t                   local_nrow,
+                         int64_t                   local_ncol,
+                         int                       num_vec = 0,
+                         GlobalVector<ValueType>** vec     = NULL);
+        /** \brief Agglomerate a coarse grid operator onto fewer processes
+      * \details
+      * If the processes that hold rows of the matrix own less than \p min_rows rows on
+      * average, the rows are distributed evenly among the first max(1, M / min_rows)
+      * processes. The remaining processes hold no rows. The rows of the restriction
+      * operator \p res and the columns of the prolongation operator \p pro follow the
+      * new distribution. Transfer operators that are local to each process are
+      * distributed first. Returns true, if the matrix has been redistributed. The
+      * matrix has to be square.
+      */
+        bool Agglomerate(int64_t                  min_rows,
+                         GlobalMatrix<ValueType>* res = NULL,
+                         GlobalMatrix<ValueType>* pro = NULL);
+
         /** \brief Read matrix from MTX (Matrix Market Format) file */
         void ReadFileMTX(const std::string& filename);
         /** \brief Write matrix to MTX (Matrix Market Format) file */
@@ -213,6 +321,26 @@ namespace rocalution
         void ReadFileCSR(const std::string& filename);
         /** \brief Write matrix to CSR (ROCALUTION binary format) file */
         void WriteFileCSR(const std::string& filename) const;
+        /** \brief Read matrix from a single CSR (ROCALUTION binary format) file using
+      * collective MPI I/O
+      * \details
+      * Each process reads only the byte ranges of the row offsets, column indices and
+      * values of its own rows, see LocalMatrix::WriteFileCSR() for the file format. If
+      * the parallel manager of the matrix provides local sizes that match the global
+      * size of the file, this row distribution is used. Otherwise, the rows are
+      * distributed evenly among the processes. The interior and ghost matrices as well
+      * as the parallel manager are generated automatically. Vectors that are used with
+      * the matrix can obtain the generated parallel manager via
+      * GlobalVector::CloneBackend().
+      */
+        void ReadFileCSRCollective(const std::string& filename);
+        /** \brief Write matrix to a single CSR (ROCALUTION binary format) file using
+      * collective MPI I/O
+      * \details
+      * The file can be read with LocalMatrix::ReadFileCSR() or, with any number of
+      * processes, with ReadFileCSRCollective().
+      */
+        void WriteFileCSRCollective(const std::string& filename) const;
 
         /** \brief Sort the matrix indices
       * \details
@@ -261,6 +389,54 @@ namespace rocalution
                            int64_t                  m,
                            GlobalMatrix<ValueType>* pro);
 
+        /** \brief Perform multi-coloring decomposition of the matrix
+      * \details
+      * Rows that are coupled across processes never share a color. These rows are colored
+      * first by a distributed Jones-Plassmann scheme, all remaining rows are colored
+      * greedily. \p num_colors is identical on all processes, \p size_colors holds the
+      * number of local rows of each color and \p permutation orders the local rows by
+      * color, as in LocalMatrix::MultiColoring().
+      */
+        void MultiColoring(int& num_colors, int** size_colors, LocalVector<int>* permutation) const;
+
+        /** \brief Strong couplings for aggregation-based AMG
+      * \details
+      * \p connections holds the strong coupling flags of the interior entries, followed by
+      * the flags of the ghost entries.
+      */
+        void AMGConnect(ValueType eps, LocalVector<int>* connections) const;
+        /** \brief Plain aggregation - Modification of a greedy aggregation scheme from
+      * Vanek (1996)
+      * \details
+      * Each process aggregates its rows based on the interior couplings only.
+      * \p aggregates holds the global index of the aggregate of each row, or a negative
+      * value if the row is not aggregated. \p aggregate_root_nodes holds the global row
+      * index of the root node of the aggregate.
+      */
+        void AMGAggregate(const LocalVector<int>& connections,
+                          LocalVector<int64_t>*   aggregates,
+                          LocalVector<int64_t>*   aggregate_root_nodes) const;
+        /** \brief Parallel aggregation - Parallel maximal independent set aggregation scheme from
+      * Bell, Dalton, & Olsen (2012)
+      * \details
+      * Aggregates can span multiple processes. The output is the same as for
+      * AMGAggregate().
+      */
+        void AMGPMISAggregate(const LocalVector<int>& connections,
+                              LocalVector<int64_t>*   aggregates,
+                              LocalVector<int64_t>*   aggregate_root_nodes) const;
+        /** \brief Interpolation scheme based on smoothed aggregation from Vanek (1996) */
+        void AMGSmoothedAggregation(ValueType                   relax,
+                                    const LocalVector<int64_t>& aggregates,
+                                    const LocalVector<int64_t>& aggregate_root_nodes,
+                                    const LocalVector<int>&     connections,
+                                    GlobalMatrix<ValueType>*    prolong,
+                                    int                         lumping_strat = 0) const;
+        /** \brief Aggregation-based interpolation scheme */
+        void AMGAggregation(const LocalVector<int64_t>& aggregates,
+                            const LocalVector<int64_t>& aggregate_root_nodes,
+                            GlobalMatrix<ValueType>*    prolong) const;
+
         /** \brief Ruge Stueben coarsening */
         void RSCoarsening(float eps, LocalVector<int>* CFmap, LocalVector<bool>* S) const;
         /** \brief Parallel maximal independent set coarsening for RS AMG*/
@@ -284,11 +460,70 @@ namespace rocalution
         void CreateParallelManager_(void);
         void InitCommPattern_(void);
 
+        // Pack the halo of in and post the non-blocking exchange of the boundary values
+        void StartHaloExchange_(const LocalVector<ValueType>& in, ValueType** send_buffer) const;
+        // Wait for the exchange to complete and unpack the ghost values into recv_buffer_
+        void FinishHaloExchange_(ValueType** send_buffer) const;
+        // Release the reduced precision halo buffers
+        void FreeReducedHalo_(void) const;
+
+        // Host CSR copies of interior and ghost, the row offsets are always allocated
+        void ExtractHostCSR_(PtrType**   int_row_offset,
+                             int**       int_col,
+                             ValueType** int_val,
+                             PtrType**   gst_row_offset,
+                             int**       gst_col,
+                             ValueType** gst_val) const;
+        // Exchange the boundary entries of a local host array into a ghost host array
+        template <typename DataType>
+        void CommunicateBoundary_(const DataType* in, DataType* ghost) const;
+
+        // Extract the local rows with global column indices in ascending order
+        void ExtractGlobalRows_(PtrType** row_offset, int64_t** col, ValueType** val) const;
+        // Fetch the rows, given with global columns, that belong to the ghost columns
+        void FetchGhostRows_(const PtrType*   row_offset,
+                             const int64_t*   col,
+                             const ValueType* val,
+                             PtrType**        ghost_row_offset,
+                             int64_t**        ghost_col,
+                             ValueType**      ghost_val) const;
+        // Move local rows with global columns from the old to the new row distribution
+        // and regenerate the matrix, the host arrays are released
+        void MigrateRows_(PtrType**                 row_offset,
+                          int64_t**                 col,
+                          ValueType**               val,
+                          const int64_t*            old_offset,
+                          const int64_t*            new_offset,
+                          int64_t                   local_ncol,
+                          int                       num_vec,
+                          GlobalVector<ValueType>** vec);
+        // Distribute an operator that is local to each process, given its global sizes and
+        // the global index of its first local column
+        void DistributeLocalOperator_(const void* comm,
+                                      int64_t     global_nrow,
+                                      int64_t     global_ncol,
+                                      int64_t     col_begin);
+        // Generate interior, ghost and parallel manager from local rows with global columns
+        void GenerateFromGlobalRows_(const void*        comm,
+                                     int64_t            global_nrow,
+                                     int64_t            global_ncol,
+                                     int64_t            local_nrow,
+                                     int64_t            local_ncol,
+                                     const PtrType*     row_offset,
+                                     const int64_t*     col,
+                                     const ValueType*   val,
+                                     const std::string& name);
+
         ParallelManager* pm_self_;
 
         ValueType* recv_boundary_;
         ValueType* send_boundary_;
 
+        // Reduced precision halo exchange and its host buffers
+        bool          reduced_halo_;
+        mutable void* recv_boundary_reduced_;
+        mutable void* send_boundary_reduced_;
+
         mutable LocalVector<ValueType> recv_buffer_;
         mutable LocalVector<ValueType> send_buffer_;
 
@@ -25,7 +25,9 @@
 #include "../utils/allocate_free.hpp"
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
+#include "host/host_io.hpp"
 #include "local_vector.hpp"
+#include "rocalution/version.hpp"
 
 #ifdef SUPPORT_MULTINODE
 #include "../utils/communicator.hpp"
@@ -34,9 +36,14 @@
 
 #include <algorithm>
 #include <complex>
+#include <cstring>
 #include <limits>
 #include <math.h>
 #include <sstream>
+#include <vector>
+
+// Maximum number of non-blocking dot products that can be pending on a single vector
+#define GLOBAL_VECTOR_MAX_PENDING_DOT 16
 
 namespace rocalution
 {
@@ -54,6 +61,10 @@ namespace rocalution
         this->pm_ = NULL;
 
         this->object_name_ = "";
+
+        this->dot_pending_ = 0;
+        this->dot_local_   = NULL;
+        this->dot_req_     = NULL;
     }
 
     template <typename ValueType>
@@ -66,6 +77,10 @@ namespace rocalution
         this->object_name_ = "";
 
         this->pm_ = &pm;
+
+        this->dot_pending_ = 0;
+        this->dot_local_   = NULL;
+        this->dot_req_     = NULL;
     }
 
     template <typename ValueType>
@@ -81,6 +96,14 @@ namespace rocalution
     {
         log_debug(this, "GlobalVector::Clear()");
 
+        // Complete outstanding reductions before releasing their buffers
+        this->DotSync();
+
+        free_host(&this->dot_local_);
+#ifdef SUPPORT_MULTINODE
+        free_host(&this->dot_req_);
+#endif
+
         this->vector_interior_.Clear();
     }
 
@@ -490,6 +513,164 @@ namespace rocalution
         this->vector_interior_.WriteFileBinary(name);
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::ReadFileBinaryCollective(const std::string& filename)
+    {
+        log_debug(this, "GlobalVector::ReadFileBinaryCollective()", filename);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+#ifdef SUPPORT_MULTINODE
+        const void* comm = this->pm_->comm_;
+
+        LOG_INFO("ReadFileBinaryCollective: filename=" << filename << "; reading...");
+
+        MFile file;
+
+        if(communication_file_open_read(filename.c_str(), &file, comm) == false)
+        {
+            LOG_INFO("Cannot open GlobalVector file [read]: " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Header, rocALUTION version and size
+        const std::string header = "#rocALUTION binary vector file\n";
+
+        std::vector<char> head(header.size() + sizeof(int) + sizeof(int64_t), 0);
+        communication_file_read_at_all(&file, 0, head.data(), head.size(), comm);
+
+        if(std::string(head.data(), header.size()) != header)
+        {
+            LOG_INFO("ReadFileBinaryCollective: filename=" << filename
+                                                           << " is not a rocALUTION vector");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        int version;
+        std::memcpy(&version, head.data() + header.size(), sizeof(int));
+
+        int64_t n;
+        int64_t offset = header.size() + sizeof(int);
+
+        // We need backward compatibility, v3.0.0 and later store sizes with 64 bits
+        if(version < 30000)
+        {
+            int size32;
+            std::memcpy(&size32, head.data() + offset, sizeof(int));
+
+            n = size32;
+            offset += sizeof(int);
+        }
+        else
+        {
+            std::memcpy(&n, head.data() + offset, sizeof(int64_t));
+            offset += sizeof(int64_t);
+        }
+
+        if(n != this->pm_->global_nrow_)
+        {
+            LOG_INFO("ReadFileBinaryCollective: filename=" << filename << "; size mismatch");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        int64_t row_begin  = this->pm_->GetGlobalRowBegin();
+        int64_t local_nrow = this->pm_->local_nrow_;
+
+        // Read the values of this process
+        typedef typename binary_io_type<ValueType>::type FileType;
+
+        std::vector<FileType> file_val(local_nrow);
+
+        communication_file_read_at_all(&file,
+                                       offset + row_begin * sizeof(FileType),
+                                       file_val.data(),
+                                       local_nrow * sizeof(FileType),
+                                       comm);
+
+        communication_file_close(&file);
+
+        std::vector<ValueType> val(local_nrow);
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            val[i] = static_cast<ValueType>(file_val[i]);
+        }
+
+        if(this->GetLocalSize() != local_nrow)
+        {
+            this->Allocate(filename, this->pm_->global_nrow_);
+        }
+
+        this->vector_interior_.CopyFromHostData(val.data());
+
+        this->object_name_ = filename;
+
+        LOG_INFO("ReadFileBinaryCollective: filename=" << filename << "; done");
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::WriteFileBinaryCollective(const std::string& filename) const
+    {
+        log_debug(this, "GlobalVector::WriteFileBinaryCollective()", filename);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+#ifdef SUPPORT_MULTINODE
+        const void* comm = this->pm_->comm_;
+
+        LOG_INFO("WriteFileBinaryCollective: filename=" << filename << "; writing...");
+
+        int64_t n          = this->pm_->global_nrow_;
+        int64_t row_begin  = this->pm_->GetGlobalRowBegin();
+        int64_t local_nrow = this->GetLocalSize();
+
+        // Values are stored in double precision
+        typedef typename binary_io_type<ValueType>::type FileType;
+
+        std::vector<ValueType> val(local_nrow);
+        std::vector<FileType>  file_val(local_nrow);
+
+        this->vector_interior_.CopyToHostData(val.data());
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            file_val[i] = static_cast<FileType>(val[i]);
+        }
+
+        MFile file;
+
+        if(communication_file_open_write(filename.c_str(), &file, comm) == false)
+        {
+            LOG_INFO("Cannot open GlobalVector file [write]: " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Header, rocALUTION version and size are written by the master rank
+        const std::string header  = "#rocALUTION binary vector file\n";
+        int               version = __ROCALUTION_VER;
+
+        std::vector<char> head(header.begin(), header.end());
+        head.insert(head.end(), (char*)&version, (char*)&version + sizeof(int));
+        head.insert(head.end(), (char*)&n, (char*)&n + sizeof(int64_t));
+
+        communication_file_write_at_all(
+            &file, 0, head.data(), this->pm_->rank_ == 0 ? head.size() : 0, comm);
+
+        communication_file_write_at_all(&file,
+                                        head.size() + row_begin * sizeof(FileType),
+                                        file_val.data(),
+                                        local_nrow * sizeof(FileType),
+                                        comm);
+
+        communication_file_close(&file);
+
+        LOG_INFO("WriteFileBinaryCollective: filename=" << filename << "; done");
+#endif
+    }
+
     template <typename ValueType>
     void GlobalVector<ValueType>::AddScale(const GlobalVector<ValueType>& x, ValueType alpha)
     {
@@ -498,6 +679,34 @@ namespace rocalution
         this->vector_interior_.AddScale(x.vector_interior_, alpha);
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::MultiAddScale(const GlobalVector<ValueType>* const* vs,
+                                                int                                   k,
+                                                const ValueType*                      alpha)
+    {
+        log_debug(this, "GlobalVector::MultiAddScale()", vs, k, alpha);
+
+        assert(k >= 0);
+
+        if(k == 0)
+        {
+            return;
+        }
+
+        assert(vs != NULL);
+
+        std::vector<const LocalVector<ValueType>*> interior(k);
+
+        for(int j = 0; j < k; ++j)
+        {
+            assert(vs[j] != NULL);
+
+            interior[j] = &vs[j]->vector_interior_;
+        }
+
+        this->vector_interior_.MultiAddScale(interior.data(), k, alpha);
+    }
+
     template <typename ValueType>
     void GlobalVector<ValueType>::ScaleAdd2(ValueType                      alpha,
                                             const GlobalVector<ValueType>& x,
@@ -577,6 +786,161 @@ namespace rocalution
         return global;
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::DotAsync(const GlobalVector<ValueType>& x, ValueType* result)
+    {
+        log_debug(this, "GlobalVector::DotAsync()", (const void*&)x, result);
+
+        this->StartDotReduction_(this->vector_interior_.Dot(x.vector_interior_), result);
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::DotNonConjAsync(const GlobalVector<ValueType>& x,
+                                                  ValueType*                     result)
+    {
+        log_debug(this, "GlobalVector::DotNonConjAsync()", (const void*&)x, result);
+
+        this->StartDotReduction_(this->vector_interior_.DotNonConj(x.vector_interior_), result);
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::StartDotReduction_(ValueType local, ValueType* result)
+    {
+        assert(result != NULL);
+
+        if(this->dot_pending_ == GLOBAL_VECTOR_MAX_PENDING_DOT)
+        {
+            LOG_INFO("GlobalVector: too many pending dot products, call DotSync() first");
+            this->Info();
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Buffers are allocated once and kept, such that they remain valid while
+        // reductions are in flight
+        if(this->dot_local_ == NULL)
+        {
+            allocate_host(GLOBAL_VECTOR_MAX_PENDING_DOT, &this->dot_local_);
+#ifdef SUPPORT_MULTINODE
+            allocate_host(GLOBAL_VECTOR_MAX_PENDING_DOT, &this->dot_req_);
+#endif
+        }
+
+        this->dot_local_[this->dot_pending_] = local;
+
+#ifdef SUPPORT_MULTINODE
+        communication_async_allreduce_single_sum(&this->dot_local_[this->dot_pending_],
+                                                 result,
+                                                 this->pm_->comm_,
+                                                 &this->dot_req_[this->dot_pending_]);
+#else
+        *result = local;
+#endif
+
+        ++this->dot_pending_;
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::DotSync(void)
+    {
+        log_debug(this, "GlobalVector::DotSync()", this->dot_pending_);
+
+        if(this->dot_pending_ > 0)
+        {
+#ifdef SUPPORT_MULTINODE
+            communication_syncall(this->dot_pending_, this->dot_req_);
+#endif
+            this->dot_pending_ = 0;
+        }
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::MultiDot(const GlobalVector<ValueType>* const* vs,
+                                           int                                   k,
+                                           ValueType*                            out) const
+    {
+        log_debug(this, "GlobalVector::MultiDot()", vs, k, out);
+
+        assert(k >= 0);
+
+        if(k == 0)
+        {
+            return;
+        }
+
+        assert(vs != NULL);
+        assert(out != NULL);
+
+        std::vector<const LocalVector<ValueType>*> interior(k);
+
+        for(int j = 0; j < k; ++j)
+        {
+            assert(vs[j] != NULL);
+
+            interior[j] = &vs[j]->vector_interior_;
+        }
+
+#ifdef SUPPORT_MULTINODE
+        std::vector<ValueType> local(k);
+
+        this->vector_interior_.MultiDot(interior.data(), k, local.data());
+
+        // All k partial results are reduced at once
+        communication_sync_allreduce_sum(local.data(), out, k, this->pm_->comm_);
+#else
+        this->vector_interior_.MultiDot(interior.data(), k, out);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::BlockDot(int                                   m,
+                                           const GlobalVector<ValueType>* const* x,
+                                           int                                   n,
+                                           const GlobalVector<ValueType>* const* y,
+                                           ValueType*                            out)
+    {
+        log_debug(y, "GlobalVector::BlockDot()", m, x, n, out);
+
+        assert(m >= 0);
+        assert(n >= 0);
+
+        if(m == 0 || n == 0)
+        {
+            return;
+        }
+
+        assert(x != NULL);
+        assert(y != NULL);
+        assert(out != NULL);
+
+        std::vector<const LocalVector<ValueType>*> x_interior(m);
+        std::vector<const LocalVector<ValueType>*> y_interior(n);
+
+        for(int i = 0; i < m; ++i)
+        {
+            assert(x[i] != NULL);
+
+            x_interior[i] = &x[i]->vector_interior_;
+        }
+
+        for(int j = 0; j < n; ++j)
+        {
+            assert(y[j] != NULL);
+
+            y_interior[j] = &y[j]->vector_interior_;
+        }
+
+#ifdef SUPPORT_MULTINODE
+        std::vector<ValueType> local(m * n);
+
+        LocalVector<ValueType>::BlockDot(m, x_interior.data(), n, y_interior.data(), local.data());
+
+        // All m * n partial results are reduced at once
+        communication_sync_allreduce_sum(local.data(), out, m * n, y[0]->pm_->comm_);
+#else
+        LocalVector<ValueType>::BlockDot(m, x_interior.data(), n, y_interior.data(), out);
+#endif
+    }
+
     template <typename ValueType>
     ValueType GlobalVector<ValueType>::Norm(void) const
     {
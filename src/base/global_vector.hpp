@@ -108,8 +108,21 @@ namespace rocalution
         virtual void WriteFileASCII(const std::string& filename) const;
         virtual void ReadFileBinary(const std::string& filename);
         virtual void WriteFileBinary(const std::string& filename) const;
+        /** \brief Read the vector from a single rocALUTION binary vector file using
+      * collective MPI I/O
+      * \details
+      * Each process reads only the byte range of its own rows, as given by the
+      * parallel manager of the vector.
+      */
+        void ReadFileBinaryCollective(const std::string& filename);
+        /** \brief Write the vector to a single rocALUTION binary vector file using
+      * collective MPI I/O
+      */
+        void WriteFileBinaryCollective(const std::string& filename) const;
 
         virtual void AddScale(const GlobalVector<ValueType>& x, ValueType alpha);
+        virtual void
+            MultiAddScale(const GlobalVector<ValueType>* const* vs, int k, const ValueType* alpha);
         virtual void ScaleAdd(ValueType alpha, const GlobalVector<ValueType>& x);
         virtual void ScaleAdd2(ValueType                      alpha,
                                const GlobalVector<ValueType>& x,
@@ -121,6 +134,19 @@ namespace rocalution
         virtual void      Scale(ValueType alpha);
         virtual ValueType Dot(const GlobalVector<ValueType>& x) const;
         virtual ValueType DotNonConj(const GlobalVector<ValueType>& x) const;
+        virtual void      DotAsync(const GlobalVector<ValueType>& x, ValueType* result);
+        virtual void      DotNonConjAsync(const GlobalVector<ValueType>& x, ValueType* result);
+        virtual void      DotSync(void);
+        virtual void
+            MultiDot(const GlobalVector<ValueType>* const* vs, int k, ValueType* out) const;
+        /** \brief Compute the block \f$out = X^{H} Y\f$ of dot products with a single global
+      * reduction, see LocalVector::BlockDot()
+      */
+        static void BlockDot(int                                   m,
+                             const GlobalVector<ValueType>* const* x,
+                             int                                   n,
+                             const GlobalVector<ValueType>* const* y,
+                             ValueType*                            out);
         virtual ValueType Norm(void) const;
         virtual ValueType Reduce(void) const;
         virtual ValueType InclusiveSum(void);
@@ -146,8 +172,16 @@ namespace rocalution
         virtual bool is_accel_(void) const;
 
     private:
+        // Post the global reduction of a local dot product contribution
+        void StartDotReduction_(ValueType local, ValueType* result);
+
         LocalVector<ValueType> vector_interior_;
 
+        // Pending non-blocking dot product reductions
+        int        dot_pending_;
+        ValueType* dot_local_;
+        MRequest*  dot_req_;
+
         friend class LocalMatrix<ValueType>;
         friend class GlobalMatrix<ValueType>;
 
@@ -28,6 +28,9 @@
 
 #include "hip_atomics.hpp"
 
+// Maximum number of vectors that are passed to kernel_multi_axpy at once
+#define HIP_MULTI_AXPY_SIZE 8
+
 namespace rocalution
 {
     template <typename ValueType, typename IndexType>
@@ -62,6 +65,36 @@ namespace rocalution
         out[ind] = alpha * out[ind] + x[ind];
     }
 
+    template <typename ValueType>
+    struct hip_multi_axpy_args
+    {
+        const ValueType* x[HIP_MULTI_AXPY_SIZE];
+        ValueType        alpha[HIP_MULTI_AXPY_SIZE];
+    };
+
+    template <typename ValueType, typename IndexType>
+    __global__ void kernel_multi_axpy(IndexType                      n,
+                                      int                            k,
+                                      hip_multi_axpy_args<ValueType> args,
+                                      ValueType* __restrict__ out)
+    {
+        IndexType ind = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+        if(ind >= n)
+        {
+            return;
+        }
+
+        ValueType sum = out[ind];
+
+        for(int j = 0; j < k; ++j)
+        {
+            sum += args.alpha[j] * args.x[j][ind];
+        }
+
+        out[ind] = sum;
+    }
+
     template <typename ValueType, typename IndexType>
     __global__ void kernel_scaleaddscale(IndexType n,
                                          ValueType alpha,
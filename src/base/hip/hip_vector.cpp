@@ -38,6 +38,8 @@
 #include <hip/hip_runtime.h>
 #include <rocprim/rocprim.hpp>
 
+#include <algorithm>
+
 #ifdef SUPPORT_COMPLEX
 #include <complex>
 #include <hip/hip_complex.h>
@@ -610,6 +612,76 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void HIPAcceleratorVector<ValueType>::MultiAddScale(const BaseVector<ValueType>* const* x,
+                                                        int                                 k,
+                                                        const ValueType*                    alpha)
+    {
+        assert(k >= 0);
+        assert(x != NULL);
+        assert(alpha != NULL);
+
+        if(this->size_ > 0)
+        {
+            dim3 BlockSize(this->local_backend_.HIP_block_size);
+            dim3 GridSize(this->size_ / this->local_backend_.HIP_block_size + 1);
+
+            // Vectors are processed in groups, each group updates this vector once
+            for(int j = 0; j < k; j += HIP_MULTI_AXPY_SIZE)
+            {
+                int nvec = std::min(k - j, HIP_MULTI_AXPY_SIZE);
+
+                hip_multi_axpy_args<ValueType> args;
+
+                for(int l = 0; l < nvec; ++l)
+                {
+                    const HIPAcceleratorVector<ValueType>* cast_x
+                        = dynamic_cast<const HIPAcceleratorVector<ValueType>*>(x[j + l]);
+
+                    assert(cast_x != NULL);
+                    assert(this->size_ == cast_x->size_);
+
+                    args.x[l]     = cast_x->vec_;
+                    args.alpha[l] = alpha[j + l];
+                }
+
+                kernel_multi_axpy<<<GridSize,
+                                    BlockSize,
+                                    0,
+                                    HIPSTREAM(this->local_backend_.HIP_stream_current)>>>(
+                    this->size_, nvec, args, this->vec_);
+                CHECK_HIP_ERROR(__FILE__, __LINE__);
+            }
+        }
+    }
+
+    template <>
+    void HIPAcceleratorVector<bool>::MultiAddScale(const BaseVector<bool>* const* x,
+                                                   int                            k,
+                                                   const bool*                    alpha)
+    {
+        LOG_INFO("No bool multi axpy function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HIPAcceleratorVector<int>::MultiAddScale(const BaseVector<int>* const* x,
+                                                  int                           k,
+                                                  const int*                    alpha)
+    {
+        LOG_INFO("No int multi axpy function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HIPAcceleratorVector<int64_t>::MultiAddScale(const BaseVector<int64_t>* const* x,
+                                                      int                               k,
+                                                      const int64_t*                    alpha)
+    {
+        LOG_INFO("No integral multi axpy function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     void HIPAcceleratorVector<ValueType>::ScaleAdd(ValueType alpha, const BaseVector<ValueType>& x)
     {
@@ -862,6 +934,89 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void HIPAcceleratorVector<ValueType>::MultiDot(const BaseVector<ValueType>* const* x,
+                                                   int                                 k,
+                                                   ValueType*                          out) const
+    {
+        assert(k >= 0);
+        assert(x != NULL);
+        assert(out != NULL);
+
+        if(k == 0)
+        {
+            return;
+        }
+
+        if(this->size_ > 0)
+        {
+            rocblas_handle handle = ROCBLAS_HANDLE(this->local_backend_.ROC_blas_handle);
+
+            // The results are gathered on the device, such that all k dot products are
+            // queued without synchronizing in between
+            ValueType* res = NULL;
+            allocate_hip(k, &res);
+
+            rocblas_status status;
+            status = rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+            CHECK_ROCBLAS_ERROR(status, __FILE__, __LINE__);
+
+            for(int j = 0; j < k; ++j)
+            {
+                const HIPAcceleratorVector<ValueType>* cast_x
+                    = dynamic_cast<const HIPAcceleratorVector<ValueType>*>(x[j]);
+
+                assert(cast_x != NULL);
+                assert(this->size_ == cast_x->size_);
+
+                status = rocblasTdotc(
+                    handle, this->size_, cast_x->vec_, 1, this->vec_, 1, res + j);
+                CHECK_ROCBLAS_ERROR(status, __FILE__, __LINE__);
+            }
+
+            status = rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+            CHECK_ROCBLAS_ERROR(status, __FILE__, __LINE__);
+
+            // Synchronize stream to make sure, results are available
+            hipStreamSynchronize(HIPSTREAM(this->local_backend_.HIP_stream_current));
+            CHECK_HIP_ERROR(__FILE__, __LINE__);
+
+            copy_d2h(k, res, out);
+            free_hip(&res);
+        }
+        else
+        {
+            set_to_zero_host(k, out);
+        }
+    }
+
+    template <>
+    void HIPAcceleratorVector<bool>::MultiDot(const BaseVector<bool>* const* x,
+                                              int                            k,
+                                              bool*                          out) const
+    {
+        LOG_INFO("No bool multi dot function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HIPAcceleratorVector<int>::MultiDot(const BaseVector<int>* const* x,
+                                             int                           k,
+                                             int*                          out) const
+    {
+        LOG_INFO("No int multi dot function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HIPAcceleratorVector<int64_t>::MultiDot(const BaseVector<int64_t>* const* x,
+                                                 int                               k,
+                                                 int64_t*                          out) const
+    {
+        LOG_INFO("No integral multi dot function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     ValueType HIPAcceleratorVector<ValueType>::Norm(void) const
     {
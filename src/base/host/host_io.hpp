@@ -24,10 +24,30 @@
 #ifndef ROCALUTION_HOST_IO_HPP_
 #define ROCALUTION_HOST_IO_HPP_
 
+#include <complex>
 #include <string>
 
 namespace rocalution
 {
+    // Type that is used to store values in rocALUTION binary files, floating point
+    // values are always stored in double precision
+    template <typename ValueType>
+    struct binary_io_type
+    {
+        typedef ValueType type;
+    };
+
+    template <>
+    struct binary_io_type<float>
+    {
+        typedef double type;
+    };
+
+    template <>
+    struct binary_io_type<std::complex<float>>
+    {
+        typedef std::complex<double> type;
+    };
 
     template <typename ValueType>
     bool read_matrix_mtx(int&        nrow,
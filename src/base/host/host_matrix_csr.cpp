@@ -684,6 +684,76 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void HostMatrixCSR<ValueType>::MultiApply(int                                 num,
+                                              const BaseVector<ValueType>* const* in,
+                                              BaseVector<ValueType>**             out) const
+    {
+        assert(num >= 0);
+
+        // Number of vectors that are processed per sweep over the matrix
+        const int block = 8;
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        for(int j0 = 0; j0 < num; j0 += block)
+        {
+            int nv = std::min(block, num - j0);
+
+            const ValueType* x[block];
+            ValueType*       y[block];
+
+            for(int l = 0; l < nv; ++l)
+            {
+                assert(in[j0 + l]->GetSize() == this->ncol_);
+                assert(out[j0 + l]->GetSize() == this->nrow_);
+
+                const HostVector<ValueType>* cast_in
+                    = dynamic_cast<const HostVector<ValueType>*>(in[j0 + l]);
+                HostVector<ValueType>* cast_out = dynamic_cast<HostVector<ValueType>*>(out[j0 + l]);
+
+                assert(cast_in != NULL);
+                assert(cast_out != NULL);
+
+                x[l] = cast_in->vec_;
+                y[l] = cast_out->vec_;
+            }
+
+            // Each row of the matrix is loaded once for all nv vectors
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int ai = 0; ai < this->nrow_; ++ai)
+            {
+                ValueType sum[block];
+
+                for(int l = 0; l < nv; ++l)
+                {
+                    sum[l] = static_cast<ValueType>(0);
+                }
+
+                PtrType row_beg = this->mat_.row_offset[ai];
+                PtrType row_end = this->mat_.row_offset[ai + 1];
+
+                for(PtrType aj = row_beg; aj < row_end; ++aj)
+                {
+                    ValueType val = this->mat_.val[aj];
+                    int       col = this->mat_.col[aj];
+
+                    for(int l = 0; l < nv; ++l)
+                    {
+                        sum[l] += val * x[l][col];
+                    }
+                }
+
+                for(int l = 0; l < nv; ++l)
+                {
+                    y[l][ai] = sum[l];
+                }
+            }
+        }
+    }
+
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::ApplyAdd(const BaseVector<ValueType>& in,
                                             ValueType                    scalar,
@@ -158,6 +158,9 @@ namespace rocalution
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const;
+        virtual void MultiApply(int                                 num,
+                                const BaseVector<ValueType>* const* in,
+                                BaseVector<ValueType>**             out) const;
 
         virtual bool Compress(double drop_off);
         virtual bool Transpose(void);
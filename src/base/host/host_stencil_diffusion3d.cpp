@@ -0,0 +1,449 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "host_stencil_diffusion3d.hpp"
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/def.hpp"
+#include "../../utils/log.hpp"
+#include "../stencil_types.hpp"
+#include "host_stencil_blocking.hpp"
+#include "host_vector.hpp"
+
+#include <algorithm>
+#include <complex>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_set_num_threads(num) ;
+#endif
+
+namespace rocalution
+{
+
+    // Harmonic average of two cell coefficients
+    template <typename ValueType>
+    static inline ValueType face_coefficient(ValueType a, ValueType b)
+    {
+        return (a + b == static_cast<ValueType>(0)) ? static_cast<ValueType>(0)
+                                                     : static_cast<ValueType>(2) * a * b / (a + b);
+    }
+
+    template <typename ValueType>
+    HostStencilDiffusion3D<ValueType>::HostStencilDiffusion3D()
+    {
+        // no default constructors
+        LOG_INFO("no default constructor");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    HostStencilDiffusion3D<ValueType>::HostStencilDiffusion3D(
+        const Rocalution_Backend_Descriptor& local_backend)
+    {
+        log_debug(this,
+                  "HostStencilDiffusion3D::HostStencilDiffusion3D()",
+                  "constructor with local_backend");
+
+        this->set_backend(local_backend);
+
+        this->ndim_ = 3;
+
+        this->coeff_      = NULL;
+        this->coeff_size_ = 0;
+
+        this->diag_   = NULL;
+        this->face_x_ = NULL;
+        this->face_y_ = NULL;
+        this->face_z_ = NULL;
+    }
+
+    template <typename ValueType>
+    HostStencilDiffusion3D<ValueType>::~HostStencilDiffusion3D()
+    {
+        log_debug(this, "HostStencilDiffusion3D::~HostStencilDiffusion3D()", "destructor");
+
+        this->Clear_();
+    }
+
+    template <typename ValueType>
+    void HostStencilDiffusion3D<ValueType>::Info(void) const
+    {
+        LOG_INFO("Stencil 3D Diffusion 7pt (Host) size=" << this->size_
+                                                         << " dim=" << this->GetNDim());
+    }
+
+    template <typename ValueType>
+    int64_t HostStencilDiffusion3D<ValueType>::GetNnz(void) const
+    {
+        return 7;
+    }
+
+    template <typename ValueType>
+    void HostStencilDiffusion3D<ValueType>::Clear_(void)
+    {
+        if(this->diag_ != NULL)
+        {
+            free_host(&this->diag_);
+            free_host(&this->face_x_);
+            free_host(&this->face_y_);
+            free_host(&this->face_z_);
+        }
+
+        if(this->coeff_ != NULL)
+        {
+            free_host(&this->coeff_);
+            this->coeff_size_ = 0;
+        }
+    }
+
+    template <typename ValueType>
+    void HostStencilDiffusion3D<ValueType>::SetGrid(int size)
+    {
+        log_debug(this, "HostStencilDiffusion3D::SetGrid()", size);
+
+        assert(size >= 0);
+
+        this->Clear_();
+        this->size_ = size;
+
+        if(size == 0)
+        {
+            return;
+        }
+
+        // Start with a unit coefficient field, which gives the 7pt Laplacian
+        HostVector<ValueType> unit(this->local_backend_);
+        unit.Allocate(this->GetM());
+        unit.Ones();
+
+        this->SetCoefficients(unit);
+    }
+
+    template <typename ValueType>
+    void HostStencilDiffusion3D<ValueType>::SetCoefficients(const BaseVector<ValueType>& coeff)
+    {
+        log_debug(this, "HostStencilDiffusion3D::SetCoefficients()", (const void*&)coeff);
+
+        int     n    = this->size_;
+        int64_t nrow = this->GetM();
+
+        assert(n > 0);
+        assert(coeff.GetSize() == nrow || coeff.GetSize() == 3 * nrow);
+
+        const HostVector<ValueType>* cast_coeff
+            = dynamic_cast<const HostVector<ValueType>*>(&coeff);
+
+        assert(cast_coeff != NULL);
+
+        if(this->diag_ == NULL)
+        {
+            allocate_host(nrow, &this->diag_);
+            allocate_host(nrow, &this->face_x_);
+            allocate_host(nrow, &this->face_y_);
+            allocate_host(nrow, &this->face_z_);
+        }
+
+        // Keep the cell coefficients, they are required for coarsening
+        if(this->coeff_size_ != coeff.GetSize())
+        {
+            free_host(&this->coeff_);
+
+            this->coeff_size_ = coeff.GetSize();
+            allocate_host(this->coeff_size_, &this->coeff_);
+        }
+
+        copy_h2h(this->coeff_size_, cast_coeff->vec_, this->coeff_);
+
+        // Isotropic field k (size n^3) or anisotropic field (kx, ky, kz) (size 3*n^3)
+        const ValueType* kx = this->coeff_;
+        const ValueType* ky = (coeff.GetSize() == nrow) ? kx : kx + nrow;
+        const ValueType* kz = (coeff.GetSize() == nrow) ? kx : kx + 2 * nrow;
+
+        int64_t nn = static_cast<int64_t>(n) * n;
+
+        _set_omp_backend_threads(this->local_backend_, nrow);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int z = 0; z < n; ++z)
+        {
+            for(int y = 0; y < n; ++y)
+            {
+                for(int x = 0; x < n; ++x)
+                {
+                    int64_t i = z * nn + static_cast<int64_t>(y) * n + x;
+
+                    // Faces towards the +x, +y and +z neighbors, zero on the domain boundary
+                    this->face_x_[i] = (x < n - 1) ? face_coefficient(kx[i], kx[i + 1])
+                                                   : static_cast<ValueType>(0);
+                    this->face_y_[i] = (y < n - 1) ? face_coefficient(ky[i], ky[i + n])
+                                                   : static_cast<ValueType>(0);
+                    this->face_z_[i] = (z < n - 1) ? face_coefficient(kz[i], kz[i + nn])
+                                                   : static_cast<ValueType>(0);
+                }
+            }
+        }
+
+        // Boundary faces use the cell coefficient, such that k = 1 gives the
+        // 7pt Laplacian
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int z = 0; z < n; ++z)
+        {
+            for(int y = 0; y < n; ++y)
+            {
+                for(int x = 0; x < n; ++x)
+                {
+                    int64_t i = z * nn + static_cast<int64_t>(y) * n + x;
+
+                    this->diag_[i] = ((x > 0) ? this->face_x_[i - 1] : kx[i])
+                                     + ((x < n - 1) ? this->face_x_[i] : kx[i])
+                                     + ((y > 0) ? this->face_y_[i - n] : ky[i])
+                                     + ((y < n - 1) ? this->face_y_[i] : ky[i])
+                                     + ((z > 0) ? this->face_z_[i - nn] : kz[i])
+                                     + ((z < n - 1) ? this->face_z_[i] : kz[i]);
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void HostStencilDiffusion3D<ValueType>::Coarsen(BaseStencil<ValueType>* coarse) const
+    {
+        log_debug(this, "HostStencilDiffusion3D::Coarsen()", coarse);
+
+        assert(coarse != NULL);
+
+        HostStencilDiffusion3D<ValueType>* cast_coarse
+            = dynamic_cast<HostStencilDiffusion3D<ValueType>*>(coarse);
+
+        assert(cast_coarse != NULL);
+
+        int nc = (this->size_ - 1) / 2;
+
+        cast_coarse->SetGrid(nc);
+
+        if(nc == 0)
+        {
+            return;
+        }
+
+        // Coarse cell coefficients are full weighting averages of the fine ones,
+        // each component of an anisotropic field is coarsened separately
+        int64_t nrow   = this->GetM();
+        int64_t nrow_c = cast_coarse->GetM();
+        int     ncomp  = static_cast<int>(this->coeff_size_ / nrow);
+
+        HostVector<ValueType> coeff_c(this->local_backend_);
+        coeff_c.Allocate(ncomp * nrow_c);
+
+        for(int i = 0; i < ncomp; ++i)
+        {
+            this->Restriction_(this->coeff_ + i * nrow, coeff_c.vec_ + i * nrow_c);
+        }
+
+        cast_coarse->SetCoefficients(coeff_c);
+    }
+
+    template <typename ValueType>
+    void HostStencilDiffusion3D<ValueType>::ExtractInverseDiagonal(
+        BaseVector<ValueType>* vec_inv_diag) const
+    {
+        log_debug(this, "HostStencilDiffusion3D::ExtractInverseDiagonal()", vec_inv_diag);
+
+        assert(vec_inv_diag != NULL);
+        assert(vec_inv_diag->GetSize() == this->GetM());
+
+        HostVector<ValueType>* cast_vec = dynamic_cast<HostVector<ValueType>*>(vec_inv_diag);
+
+        assert(cast_vec != NULL);
+
+        int64_t nrow = this->GetM();
+
+        _set_omp_backend_threads(this->local_backend_, nrow);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int64_t i = 0; i < nrow; ++i)
+        {
+            cast_vec->vec_[i] = static_cast<ValueType>(1) / this->diag_[i];
+        }
+    }
+
+    template <typename ValueType>
+    void HostStencilDiffusion3D<ValueType>::Apply_(const ValueType* in,
+                                                   ValueType        scalar,
+                                                   bool             add,
+                                                   ValueType*       out) const
+    {
+        int     n  = this->size_;
+        int64_t nn = static_cast<int64_t>(n) * n;
+
+        // Neighbor lines outside of the domain (homogeneous Dirichlet) point to a
+        // zero line, such that the inner loop is free of any branches
+        ValueType* zero = NULL;
+        allocate_host(n, &zero);
+        set_to_zero_host(n, zero);
+
+        int ntiles_x = (n + STENCIL_BLOCK_X - 1) / STENCIL_BLOCK_X;
+        int ntiles_y = (n + STENCIL_BLOCK_Y - 1) / STENCIL_BLOCK_Y;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int tile = 0; tile < ntiles_x * ntiles_y; ++tile)
+        {
+            int x_begin = (tile % ntiles_x) * STENCIL_BLOCK_X;
+            int x_end   = std::min(x_begin + STENCIL_BLOCK_X, n);
+            int y_begin = (tile / ntiles_x) * STENCIL_BLOCK_Y;
+            int y_end   = std::min(y_begin + STENCIL_BLOCK_Y, n);
+
+            // Interior x range of this tile, end points are peeled
+            int xi_begin = std::max(x_begin, 1);
+            int xi_end   = std::min(x_end, n - 1);
+
+            for(int z = 0; z < n; ++z)
+            {
+                for(int y = y_begin; y < y_end; ++y)
+                {
+                    int64_t row = z * nn + static_cast<int64_t>(y) * n;
+
+                    const ValueType* c  = in + row;
+                    const ValueType* ym = (y > 0) ? c - n : zero;
+                    const ValueType* yp = (y < n - 1) ? c + n : zero;
+                    const ValueType* zm = (z > 0) ? c - nn : zero;
+                    const ValueType* zp = (z < n - 1) ? c + nn : zero;
+
+                    const ValueType* d   = this->diag_ + row;
+                    const ValueType* fx  = this->face_x_ + row;
+                    const ValueType* fy  = this->face_y_ + row;
+                    const ValueType* fz  = this->face_z_ + row;
+                    const ValueType* fym = (y > 0) ? fy - n : zero;
+                    const ValueType* fzm = (z > 0) ? fz - nn : zero;
+
+                    ValueType* o = out + row;
+
+                    for(int x = xi_begin; x < xi_end; ++x)
+                    {
+                        ValueType val = d[x] * c[x] - fx[x - 1] * c[x - 1] - fx[x] * c[x + 1]
+                                        - fym[x] * ym[x] - fy[x] * yp[x] - fzm[x] * zm[x]
+                                        - fz[x] * zp[x];
+
+                        o[x] = add ? o[x] + scalar * val : val;
+                    }
+
+                    // Peeled boundary points in x
+                    for(int b = 0; b < 2; ++b)
+                    {
+                        int x = (b == 0) ? 0 : n - 1;
+
+                        if(x < x_begin || x >= x_end || (b == 1 && n == 1))
+                        {
+                            continue;
+                        }
+
+                        ValueType val = d[x] * c[x] - fym[x] * ym[x] - fy[x] * yp[x]
+                                        - fzm[x] * zm[x] - fz[x] * zp[x];
+
+                        if(x > 0)
+                        {
+                            val -= fx[x - 1] * c[x - 1];
+                        }
+
+                        if(x < n - 1)
+                        {
+                            val -= fx[x] * c[x + 1];
+                        }
+
+                        o[x] = add ? o[x] + scalar * val : val;
+                    }
+                }
+            }
+        }
+
+        free_host(&zero);
+    }
+
+    template <typename ValueType>
+    void HostStencilDiffusion3D<ValueType>::Apply(const BaseVector<ValueType>& in,
+                                                  BaseVector<ValueType>*       out) const
+    {
+        if((this->ndim_ > 0) && (this->size_ > 0))
+        {
+            assert(in.GetSize() >= 0);
+            assert(out->GetSize() >= 0);
+            int64_t nrow = this->GetM();
+            assert(in.GetSize() == nrow);
+            assert(out->GetSize() == nrow);
+            assert(this->diag_ != NULL);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, nrow);
+
+            this->Apply_(cast_in->vec_, static_cast<ValueType>(1), false, cast_out->vec_);
+        }
+    }
+
+    template <typename ValueType>
+    void HostStencilDiffusion3D<ValueType>::ApplyAdd(const BaseVector<ValueType>& in,
+                                                     ValueType                    scalar,
+                                                     BaseVector<ValueType>*       out) const
+    {
+        if((this->ndim_ > 0) && (this->size_ > 0))
+        {
+            assert(in.GetSize() >= 0);
+            assert(out->GetSize() >= 0);
+            int64_t nrow = this->GetM();
+            assert(in.GetSize() == nrow);
+            assert(out->GetSize() == nrow);
+            assert(this->diag_ != NULL);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, nrow);
+
+            this->Apply_(cast_in->vec_, scalar, true, cast_out->vec_);
+        }
+    }
+
+    template class HostStencilDiffusion3D<double>;
+    template class HostStencilDiffusion3D<float>;
+#ifdef SUPPORT_COMPLEX
+    template class HostStencilDiffusion3D<std::complex<double>>;
+    template class HostStencilDiffusion3D<std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_STENCIL_DIFFUSION3D_HPP_
+#define ROCALUTION_HOST_STENCIL_DIFFUSION3D_HPP_
+
+#include "../base_stencil.hpp"
+#include "../base_vector.hpp"
+#include "../stencil_types.hpp"
+
+namespace rocalution
+{
+
+    /// 7pt finite volume discretization of -div(k grad u) with homogeneous Dirichlet
+    /// boundary conditions and a (possibly anisotropic) cell coefficient field k
+    template <typename ValueType>
+    class HostStencilDiffusion3D : public HostStencil<ValueType>
+    {
+    public:
+        HostStencilDiffusion3D();
+        explicit HostStencilDiffusion3D(const Rocalution_Backend_Descriptor& local_backend);
+        virtual ~HostStencilDiffusion3D();
+
+        virtual int64_t      GetNnz(void) const;
+        virtual void         Info(void) const;
+        virtual unsigned int GetStencilId(void) const
+        {
+            return Diffusion3D;
+        }
+
+        virtual void SetGrid(int size);
+        virtual void SetCoefficients(const BaseVector<ValueType>& coeff);
+        virtual void Coarsen(BaseStencil<ValueType>* coarse) const;
+
+        virtual void ExtractInverseDiagonal(BaseVector<ValueType>* vec_inv_diag) const;
+
+        virtual void Apply(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
+        virtual void ApplyAdd(const BaseVector<ValueType>& in,
+                              ValueType                    scalar,
+                              BaseVector<ValueType>*       out) const;
+
+    private:
+        // Blocked sweep, computes out = A*in (add == false) or out += scalar*A*in
+        void Apply_(const ValueType* in, ValueType scalar, bool add, ValueType* out) const;
+
+        // Free the face coefficients
+        void Clear_(void);
+
+        /// Cell coefficient field, k (isotropic) or (kx, ky, kz)
+        ValueType* coeff_;
+        /// Size of the cell coefficient field
+        int64_t coeff_size_;
+
+        /// Diagonal, sum of all face coefficients of a cell
+        ValueType* diag_;
+        /// Face coefficients between cell i and its +x, +y and +z neighbor
+        ValueType* face_x_;
+        ValueType* face_y_;
+        ValueType* face_z_;
+
+        friend class BaseVector<ValueType>;
+        friend class HostVector<ValueType>;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_STENCIL_DIFFUSION3D_HPP_
@@ -82,6 +82,18 @@ namespace rocalution
         return 5;
     }
 
+    template <typename ValueType>
+    void HostStencilLaplace2D<ValueType>::ExtractInverseDiagonal(
+        BaseVector<ValueType>* vec_inv_diag) const
+    {
+        log_debug(this, "HostStencilLaplace2D::ExtractInverseDiagonal()", vec_inv_diag);
+
+        assert(vec_inv_diag != NULL);
+        assert(vec_inv_diag->GetSize() == this->GetM());
+
+        vec_inv_diag->SetValues(static_cast<ValueType>(1) / static_cast<ValueType>(4));
+    }
+
     template <typename ValueType>
     void HostStencilLaplace2D<ValueType>::Apply(const BaseVector<ValueType>& in,
                                                 BaseVector<ValueType>*       out) const
@@ -109,7 +121,7 @@ namespace rocalution
 
 // interior
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for private(idx)
 #endif
             for(int i = 1; i < this->size_ - 1; ++i)
                 for(int j = 1; j < this->size_ - 1; ++j)
@@ -127,7 +139,7 @@ namespace rocalution
                 // boundary layers
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for private(idx)
 #endif
             for(int j = 1; j < this->size_ - 1; ++j)
             {
@@ -148,7 +160,7 @@ namespace rocalution
             }
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for private(idx)
 #endif
             for(int i = 1; i < this->size_ - 1; ++i)
             {
@@ -221,7 +233,7 @@ namespace rocalution
 
 // interior
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for private(idx)
 #endif
             for(int i = 1; i < this->size_ - 1; ++i)
                 for(int j = 1; j < this->size_ - 1; ++j)
@@ -229,79 +241,93 @@ namespace rocalution
                     idx = i * this->size_ + j;
 
                     cast_out->vec_[idx]
-                        += static_cast<ValueType>(-1) * cast_in->vec_[idx - this->size_] // i-1
-                           + static_cast<ValueType>(-1) * cast_in->vec_[idx - 1] // j-1
-                           + static_cast<ValueType>(4) * cast_in->vec_[idx] // i,j
-                           + static_cast<ValueType>(-1) * cast_in->vec_[idx + 1] // j+1
-                           + static_cast<ValueType>(-1) * cast_in->vec_[idx + this->size_]; // i+1
+                        += scalar
+                           * (-cast_in->vec_[idx - this->size_] // i-1
+                              - cast_in->vec_[idx - 1] // j-1
+                              + static_cast<ValueType>(4) * cast_in->vec_[idx] // i,j
+                              - cast_in->vec_[idx + 1] // j+1
+                              - cast_in->vec_[idx + this->size_]); // i+1
                 }
 
                 // boundary layers
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for private(idx)
 #endif
             for(int j = 1; j < this->size_ - 1; ++j)
             {
                 idx = 0 * this->size_ + j;
 
                 cast_out->vec_[idx]
-                    += static_cast<ValueType>(-1) * cast_in->vec_[idx - 1]
-                       + static_cast<ValueType>(4) * cast_in->vec_[idx]
-                       + static_cast<ValueType>(-1) * cast_in->vec_[idx + 1]
-                       + static_cast<ValueType>(-1) * cast_in->vec_[idx + this->size_];
+                    += scalar
+                       * (-cast_in->vec_[idx - 1]
+                          + static_cast<ValueType>(4) * cast_in->vec_[idx]
+                          - cast_in->vec_[idx + 1]
+                          - cast_in->vec_[idx + this->size_]);
 
                 idx = (this->size_ - 1) * this->size_ + j;
 
-                cast_out->vec_[idx] += static_cast<ValueType>(-1) * cast_in->vec_[idx - this->size_]
-                                       + static_cast<ValueType>(-1) * cast_in->vec_[idx - 1]
-                                       + static_cast<ValueType>(4) * cast_in->vec_[idx]
-                                       + static_cast<ValueType>(-1) * cast_in->vec_[idx + 1];
+                cast_out->vec_[idx]
+                    += scalar
+                       * (-cast_in->vec_[idx - this->size_]
+                          - cast_in->vec_[idx - 1]
+                          + static_cast<ValueType>(4) * cast_in->vec_[idx]
+                          - cast_in->vec_[idx + 1]);
             }
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for private(idx)
 #endif
             for(int i = 1; i < this->size_ - 1; ++i)
             {
                 idx = i * this->size_ + 0;
 
                 cast_out->vec_[idx]
-                    += static_cast<ValueType>(-1) * cast_in->vec_[idx - this->size_]
-                       + static_cast<ValueType>(4) * cast_in->vec_[idx]
-                       + static_cast<ValueType>(-1) * cast_in->vec_[idx + 1]
-                       + static_cast<ValueType>(-1) * cast_in->vec_[idx + this->size_];
+                    += scalar
+                       * (-cast_in->vec_[idx - this->size_]
+                          + static_cast<ValueType>(4) * cast_in->vec_[idx]
+                          - cast_in->vec_[idx + 1]
+                          - cast_in->vec_[idx + this->size_]);
 
                 idx = i * this->size_ + this->size_ - 1;
 
                 cast_out->vec_[idx]
-                    += static_cast<ValueType>(-1) * cast_in->vec_[idx - this->size_]
-                       + static_cast<ValueType>(-1) * cast_in->vec_[idx - 1]
-                       + static_cast<ValueType>(4) * cast_in->vec_[idx]
-                       + static_cast<ValueType>(-1) * cast_in->vec_[idx + this->size_];
+                    += scalar
+                       * (-cast_in->vec_[idx - this->size_]
+                          - cast_in->vec_[idx - 1]
+                          + static_cast<ValueType>(4) * cast_in->vec_[idx]
+                          - cast_in->vec_[idx + this->size_]);
             }
 
             // boundary points
 
             idx = 0 * (this->size_) + 0;
-            cast_out->vec_[idx] += static_cast<ValueType>(4) * cast_in->vec_[idx]
-                                   + static_cast<ValueType>(-1) * cast_in->vec_[idx + 1]
-                                   + static_cast<ValueType>(-1) * cast_in->vec_[idx + this->size_];
+            cast_out->vec_[idx]
+                += scalar
+                   * (static_cast<ValueType>(4) * cast_in->vec_[idx]
+                      - cast_in->vec_[idx + 1]
+                      - cast_in->vec_[idx + this->size_]);
 
             idx = 0 * (this->size_) + this->size_ - 1;
-            cast_out->vec_[idx] += static_cast<ValueType>(-1) * cast_in->vec_[idx - 1]
-                                   + static_cast<ValueType>(4) * cast_in->vec_[idx]
-                                   + static_cast<ValueType>(-1) * cast_in->vec_[idx + this->size_];
+            cast_out->vec_[idx]
+                += scalar
+                   * (-cast_in->vec_[idx - 1]
+                      + static_cast<ValueType>(4) * cast_in->vec_[idx]
+                      - cast_in->vec_[idx + this->size_]);
 
             idx = (this->size_ - 1) * (this->size_) + 0;
-            cast_out->vec_[idx] += static_cast<ValueType>(-1) * cast_in->vec_[idx - this->size_]
-                                   + static_cast<ValueType>(4) * cast_in->vec_[idx]
-                                   + static_cast<ValueType>(-1) * cast_in->vec_[idx + 1];
+            cast_out->vec_[idx]
+                += scalar
+                   * (-cast_in->vec_[idx - this->size_]
+                      + static_cast<ValueType>(4) * cast_in->vec_[idx]
+                      - cast_in->vec_[idx + 1]);
 
             idx = (this->size_ - 1) * (this->size_) + this->size_ - 1;
-            cast_out->vec_[idx] += static_cast<ValueType>(-1) * cast_in->vec_[idx - this->size_]
-                                   + static_cast<ValueType>(-1) * cast_in->vec_[idx - 1]
-                                   + static_cast<ValueType>(4) * cast_in->vec_[idx];
+            cast_out->vec_[idx]
+                += scalar
+                   * (-cast_in->vec_[idx - this->size_]
+                      - cast_in->vec_[idx - 1]
+                      + static_cast<ValueType>(4) * cast_in->vec_[idx]);
         }
     }
 
@@ -46,6 +46,8 @@ namespace rocalution
             return Laplace2D;
         }
 
+        virtual void ExtractInverseDiagonal(BaseVector<ValueType>* vec_inv_diag) const;
+
         virtual void Apply(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
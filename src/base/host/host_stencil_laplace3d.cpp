@@ -0,0 +1,227 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "host_stencil_laplace3d.hpp"
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/def.hpp"
+#include "../../utils/log.hpp"
+#include "../stencil_types.hpp"
+#include "host_stencil_blocking.hpp"
+#include "host_vector.hpp"
+
+#include <algorithm>
+#include <complex>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp_set_num_threads(num) ;
+#endif
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    HostStencilLaplace3D<ValueType>::HostStencilLaplace3D()
+    {
+        // no default constructors
+        LOG_INFO("no default constructor");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    HostStencilLaplace3D<ValueType>::HostStencilLaplace3D(
+        const Rocalution_Backend_Descriptor& local_backend)
+    {
+        log_debug(
+            this, "HostStencilLaplace3D::HostStencilLaplace3D()", "constructor with local_backend");
+
+        this->set_backend(local_backend);
+
+        this->ndim_ = 3;
+    }
+
+    template <typename ValueType>
+    HostStencilLaplace3D<ValueType>::~HostStencilLaplace3D()
+    {
+        log_debug(this, "HostStencilLaplace3D::~HostStencilLaplace3D()", "destructor");
+    }
+
+    template <typename ValueType>
+    void HostStencilLaplace3D<ValueType>::Info(void) const
+    {
+        LOG_INFO("Stencil 3D Laplace 7pt (Host) size=" << this->size_
+                                                       << " dim=" << this->GetNDim());
+    }
+
+    template <typename ValueType>
+    int64_t HostStencilLaplace3D<ValueType>::GetNnz(void) const
+    {
+        return 7;
+    }
+
+    template <typename ValueType>
+    void HostStencilLaplace3D<ValueType>::ExtractInverseDiagonal(
+        BaseVector<ValueType>* vec_inv_diag) const
+    {
+        log_debug(this, "HostStencilLaplace3D::ExtractInverseDiagonal()", vec_inv_diag);
+
+        assert(vec_inv_diag != NULL);
+        assert(vec_inv_diag->GetSize() == this->GetM());
+
+        vec_inv_diag->SetValues(static_cast<ValueType>(1) / static_cast<ValueType>(6));
+    }
+
+    template <typename ValueType>
+    void HostStencilLaplace3D<ValueType>::Apply_(const ValueType* in,
+                                                 ValueType        scalar,
+                                                 bool             add,
+                                                 ValueType*       out) const
+    {
+        int n = this->size_;
+
+        // Neighbor planes / lines outside of the domain (homogeneous Dirichlet) point
+        // to a zero line, such that the inner loop is free of any branches
+        ValueType* zero = NULL;
+        allocate_host(n, &zero);
+        set_to_zero_host(n, zero);
+
+        int ntiles_x = (n + STENCIL_BLOCK_X - 1) / STENCIL_BLOCK_X;
+        int ntiles_y = (n + STENCIL_BLOCK_Y - 1) / STENCIL_BLOCK_Y;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int tile = 0; tile < ntiles_x * ntiles_y; ++tile)
+        {
+            int x_begin = (tile % ntiles_x) * STENCIL_BLOCK_X;
+            int x_end   = std::min(x_begin + STENCIL_BLOCK_X, n);
+            int y_begin = (tile / ntiles_x) * STENCIL_BLOCK_Y;
+            int y_end   = std::min(y_begin + STENCIL_BLOCK_Y, n);
+
+            // Interior x range of this tile, end points are peeled
+            int xi_begin = std::max(x_begin, 1);
+            int xi_end   = std::min(x_end, n - 1);
+
+            for(int z = 0; z < n; ++z)
+            {
+                for(int y = y_begin; y < y_end; ++y)
+                {
+                    int64_t row = (static_cast<int64_t>(z) * n + y) * n;
+
+                    const ValueType* c  = in + row;
+                    const ValueType* ym = (y > 0) ? c - n : zero;
+                    const ValueType* yp = (y < n - 1) ? c + n : zero;
+                    const ValueType* zm = (z > 0) ? c - static_cast<int64_t>(n) * n : zero;
+                    const ValueType* zp = (z < n - 1) ? c + static_cast<int64_t>(n) * n : zero;
+
+                    ValueType* o = out + row;
+
+                    for(int x = xi_begin; x < xi_end; ++x)
+                    {
+                        ValueType val = static_cast<ValueType>(6) * c[x] - c[x - 1] - c[x + 1]
+                                        - ym[x] - yp[x] - zm[x] - zp[x];
+
+                        o[x] = add ? o[x] + scalar * val : val;
+                    }
+
+                    // Peeled boundary points in x
+                    for(int b = 0; b < 2; ++b)
+                    {
+                        int x = (b == 0) ? 0 : n - 1;
+
+                        if(x < x_begin || x >= x_end || (b == 1 && n == 1))
+                        {
+                            continue;
+                        }
+
+                        ValueType val = static_cast<ValueType>(6) * c[x] - ym[x] - yp[x] - zm[x]
+                                        - zp[x] - ((x > 0) ? c[x - 1] : static_cast<ValueType>(0))
+                                        - ((x < n - 1) ? c[x + 1] : static_cast<ValueType>(0));
+
+                        o[x] = add ? o[x] + scalar * val : val;
+                    }
+                }
+            }
+        }
+
+        free_host(&zero);
+    }
+
+    template <typename ValueType>
+    void HostStencilLaplace3D<ValueType>::Apply(const BaseVector<ValueType>& in,
+                                                BaseVector<ValueType>*       out) const
+    {
+        if((this->ndim_ > 0) && (this->size_ > 0))
+        {
+            assert(in.GetSize() >= 0);
+            assert(out->GetSize() >= 0);
+            int64_t nrow = this->GetM();
+            assert(in.GetSize() == nrow);
+            assert(out->GetSize() == nrow);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, nrow);
+
+            this->Apply_(cast_in->vec_, static_cast<ValueType>(1), false, cast_out->vec_);
+        }
+    }
+
+    template <typename ValueType>
+    void HostStencilLaplace3D<ValueType>::ApplyAdd(const BaseVector<ValueType>& in,
+                                                   ValueType                    scalar,
+                                                   BaseVector<ValueType>*       out) const
+    {
+        if((this->ndim_ > 0) && (this->size_ > 0))
+        {
+            assert(in.GetSize() >= 0);
+            assert(out->GetSize() >= 0);
+            int64_t nrow = this->GetM();
+            assert(in.GetSize() == nrow);
+            assert(out->GetSize() == nrow);
+
+            const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+            HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+            assert(cast_in != NULL);
+            assert(cast_out != NULL);
+
+            _set_omp_backend_threads(this->local_backend_, nrow);
+
+            this->Apply_(cast_in->vec_, scalar, true, cast_out->vec_);
+        }
+    }
+
+    template class HostStencilLaplace3D<double>;
+    template class HostStencilLaplace3D<float>;
+#ifdef SUPPORT_COMPLEX
+    template class HostStencilLaplace3D<std::complex<double>>;
+    template class HostStencilLaplace3D<std::complex<float>>;
+#endif
+
+} // namespace rocalution
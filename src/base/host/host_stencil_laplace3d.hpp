@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_STENCIL_LAPLACE3D_HPP_
+#define ROCALUTION_HOST_STENCIL_LAPLACE3D_HPP_
+
+#include "../base_stencil.hpp"
+#include "../base_vector.hpp"
+#include "../stencil_types.hpp"
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    class HostStencilLaplace3D : public HostStencil<ValueType>
+    {
+    public:
+        HostStencilLaplace3D();
+        explicit HostStencilLaplace3D(const Rocalution_Backend_Descriptor& local_backend);
+        virtual ~HostStencilLaplace3D();
+
+        virtual int64_t      GetNnz(void) const;
+        virtual void         Info(void) const;
+        virtual unsigned int GetStencilId(void) const
+        {
+            return Laplace3D;
+        }
+
+        virtual void ExtractInverseDiagonal(BaseVector<ValueType>* vec_inv_diag) const;
+
+        virtual void Apply(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
+        virtual void ApplyAdd(const BaseVector<ValueType>& in,
+                              ValueType                    scalar,
+                              BaseVector<ValueType>*       out) const;
+
+    private:
+        // Blocked sweep, computes out = A*in (add == false) or out += scalar*A*in
+        void Apply_(const ValueType* in, ValueType scalar, bool add, ValueType* out) const;
+
+        friend class BaseVector<ValueType>;
+        friend class HostVector<ValueType>;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_STENCIL_LAPLACE3D_HPP_
@@ -40,6 +40,7 @@
 #include <numeric>
 #include <typeindex>
 #include <typeinfo>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -650,6 +651,55 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void HostVector<ValueType>::MultiAddScale(const BaseVector<ValueType>* const* x,
+                                              int                                 k,
+                                              const ValueType*                    alpha)
+    {
+        assert(k >= 0);
+        assert(x != NULL);
+        assert(alpha != NULL);
+
+        std::vector<const ValueType*> vec(k);
+
+        for(int j = 0; j < k; ++j)
+        {
+            const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(x[j]);
+
+            assert(cast_x != NULL);
+            assert(this->size_ == cast_x->size_);
+
+            vec[j] = cast_x->vec_;
+        }
+
+        // The vector is processed in chunks that stay in cache while all k updates of the
+        // chunk are applied, such that it is read and written only once
+        const int64_t chunk  = 1024;
+        const int64_t nchunk = (this->size_ + chunk - 1) / chunk;
+
+        _set_omp_backend_threads(this->local_backend_, this->size_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int64_t c = 0; c < nchunk; ++c)
+        {
+            int64_t begin = c * chunk;
+            int64_t end   = std::min(begin + chunk, this->size_);
+
+            for(int j = 0; j < k; ++j)
+            {
+                const ValueType* xj = vec[j];
+                ValueType        aj = alpha[j];
+
+                for(int64_t i = begin; i < end; ++i)
+                {
+                    this->vec_[i] += aj * xj[i];
+                }
+            }
+        }
+    }
+
     template <typename ValueType>
     void HostVector<ValueType>::ScaleAdd(ValueType alpha, const BaseVector<ValueType>& x)
     {
@@ -912,6 +962,96 @@ namespace rocalution
         return std::complex<double>(dot_real, dot_imag);
     }
 
+    template <typename ValueType>
+    void HostVector<ValueType>::MultiDot(const BaseVector<ValueType>* const* x,
+                                         int                                 k,
+                                         ValueType*                          out) const
+    {
+        assert(k >= 0);
+        assert(x != NULL);
+        assert(out != NULL);
+
+        std::vector<const ValueType*> vec(k);
+
+        for(int j = 0; j < k; ++j)
+        {
+            const HostVector<ValueType>* cast_x = dynamic_cast<const HostVector<ValueType>*>(x[j]);
+
+            assert(cast_x != NULL);
+            assert(this->size_ == cast_x->size_);
+
+            vec[j] = cast_x->vec_;
+            out[j] = static_cast<ValueType>(0);
+        }
+
+        // The vector is processed in chunks that stay in cache while all k dot products
+        // of the chunk are computed, such that it is read from memory only once
+        const int64_t chunk  = 1024;
+        const int64_t nchunk = (this->size_ + chunk - 1) / chunk;
+
+        _set_omp_backend_threads(this->local_backend_, this->size_);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<ValueType> part(k, static_cast<ValueType>(0));
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for(int64_t c = 0; c < nchunk; ++c)
+            {
+                int64_t begin = c * chunk;
+                int64_t end   = std::min(begin + chunk, this->size_);
+
+                for(int j = 0; j < k; ++j)
+                {
+                    const ValueType* xj  = vec[j];
+                    ValueType        sum = static_cast<ValueType>(0);
+
+                    for(int64_t i = begin; i < end; ++i)
+                    {
+                        sum += rocalution_conj(xj[i]) * this->vec_[i];
+                    }
+
+                    part[j] += sum;
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            for(int j = 0; j < k; ++j)
+            {
+                out[j] += part[j];
+            }
+        }
+    }
+
+    template <>
+    void HostVector<bool>::MultiDot(const BaseVector<bool>* const* x, int k, bool* out) const
+    {
+        LOG_INFO("No bool multi dot function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HostVector<int>::MultiDot(const BaseVector<int>* const* x, int k, int* out) const
+    {
+        LOG_INFO("No int multi dot function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <>
+    void HostVector<int64_t>::MultiDot(const BaseVector<int64_t>* const* x,
+                                       int                               k,
+                                       int64_t*                          out) const
+    {
+        LOG_INFO("No integral multi dot function");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     ValueType HostVector<ValueType>::Asum(void) const
     {
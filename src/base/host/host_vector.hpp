@@ -93,6 +93,9 @@ namespace rocalution
 
         // this = this + alpha*x
         virtual void AddScale(const BaseVector<ValueType>& x, ValueType alpha);
+        // this = this + sum_j alpha[j]*x[j]
+        virtual void
+            MultiAddScale(const BaseVector<ValueType>* const* x, int k, const ValueType* alpha);
         // this = alpha*this + x
         virtual void ScaleAdd(ValueType alpha, const BaseVector<ValueType>& x);
         // this = alpha*this + x*beta
@@ -116,6 +119,7 @@ namespace rocalution
         virtual ValueType Dot(const BaseVector<ValueType>& x) const;
         // this^T x
         virtual ValueType DotNonConj(const BaseVector<ValueType>& x) const;
+        virtual void MultiDot(const BaseVector<ValueType>* const* x, int k, ValueType* out) const;
         // srqt(this^T this)
         virtual ValueType Norm(void) const;
         // reduce vector
@@ -198,6 +202,9 @@ namespace rocalution
 
         friend class HostStencil<ValueType>;
         friend class HostStencilLaplace2D<ValueType>;
+        friend class HostStencilLaplace3D<ValueType>;
+        friend class HostStencilLaplace3D27<ValueType>;
+        friend class HostStencilDiffusion3D<ValueType>;
     };
 
 } // namespace rocalution
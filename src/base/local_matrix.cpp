@@ -2010,6 +2010,61 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::MultiApply(int                                  num,
+                                            const LocalVector<ValueType>* const* in,
+                                            LocalVector<ValueType>**             out) const
+    {
+        log_debug(this, "LocalMatrix::MultiApply()", num, in, out);
+
+        assert(num >= 0);
+
+        if(num == 0)
+        {
+            return;
+        }
+
+        assert(in != NULL);
+        assert(out != NULL);
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        std::vector<const BaseVector<ValueType>*> vec_in(num);
+        std::vector<BaseVector<ValueType>*>       vec_out(num);
+
+        for(int j = 0; j < num; ++j)
+        {
+            assert(in[j] != NULL);
+            assert(out[j] != NULL);
+            assert(in[j]->GetSize() == this->GetN());
+            assert(out[j]->GetSize() == this->GetM());
+            assert(((this->matrix_ == this->matrix_host_)
+                    && (in[j]->vector_ == in[j]->vector_host_)
+                    && (out[j]->vector_ == out[j]->vector_host_))
+                   || ((this->matrix_ == this->matrix_accel_)
+                       && (in[j]->vector_ == in[j]->vector_accel_)
+                       && (out[j]->vector_ == out[j]->vector_accel_)));
+
+            vec_in[j]  = in[j]->vector_;
+            vec_out[j] = out[j]->vector_;
+        }
+
+        if(this->GetNnz() > 0)
+        {
+            this->matrix_->MultiApply(num, vec_in.data(), vec_out.data());
+        }
+        else
+        {
+            // If matrix is empty, but not a 0x0 matrix, output vectors need to be set to zero
+            for(int j = 0; j < num; ++j)
+            {
+                vec_out[j]->Zeros();
+            }
+        }
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::ExtractDiagonal(LocalVector<ValueType>* vec_diag) const
     {
@@ -3615,8 +3670,8 @@ namespace rocalution
         log_debug(this, "LocalMatrix::QRSolve()", (const void*&)in, out);
 
         assert(out != NULL);
-        assert(in.GetSize() == this->GetN());
-        assert(out->GetSize() == this->GetM());
+        assert(in.GetSize() == this->GetM());
+        assert(out->GetSize() == this->GetN());
 
         assert(((this->matrix_ == this->matrix_host_) && (in.vector_ == in.vector_host_)
                 && (out->vector_ == out->vector_host_))
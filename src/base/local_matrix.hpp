@@ -840,6 +840,10 @@ namespace rocalution
         virtual void ApplyAdd(const LocalVector<ValueType>& in,
                               ValueType                     scalar,
                               LocalVector<ValueType>*       out) const;
+        ROCALUTION_EXPORT
+        virtual void MultiApply(int                                  num,
+                                const LocalVector<ValueType>* const* in,
+                                LocalVector<ValueType>**             out) const;
 
         /** \brief Perform symbolic computation (structure only) of \f$|this|^p\f$ */
         ROCALUTION_EXPORT
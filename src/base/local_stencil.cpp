@@ -23,7 +23,10 @@
 
 #include "local_stencil.hpp"
 #include "../utils/def.hpp"
+#include "host/host_stencil_diffusion3d.hpp"
 #include "host/host_stencil_laplace2d.hpp"
+#include "host/host_stencil_laplace3d.hpp"
+#include "host/host_stencil_laplace3d27.hpp"
 #include "host/host_vector.hpp"
 #include "local_vector.hpp"
 #include "stencil_types.hpp"
@@ -60,12 +63,29 @@ namespace rocalution
     {
         log_debug(this, "LocalStencil::LocalStencil()", type);
 
-        assert(type == Laplace2D); // the only one at the moment
-
         this->object_name_ = _stencil_type_names[type];
 
-        this->stencil_host_ = new HostStencilLaplace2D<ValueType>(this->local_backend_);
-        this->stencil_      = this->stencil_host_;
+        switch(type)
+        {
+        case Laplace2D:
+            this->stencil_host_ = new HostStencilLaplace2D<ValueType>(this->local_backend_);
+            break;
+        case Laplace3D:
+            this->stencil_host_ = new HostStencilLaplace3D<ValueType>(this->local_backend_);
+            break;
+        case Laplace3D27:
+            this->stencil_host_ = new HostStencilLaplace3D27<ValueType>(this->local_backend_);
+            break;
+        case Diffusion3D:
+            this->stencil_host_ = new HostStencilDiffusion3D<ValueType>(this->local_backend_);
+            break;
+        default:
+            LOG_INFO("Unknown stencil type");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        this->stencil_accel_ = NULL;
+        this->stencil_       = this->stencil_host_;
     }
 
     template <typename ValueType>
@@ -92,6 +112,18 @@ namespace rocalution
         return this->stencil_->GetN();
     }
 
+    template <typename ValueType>
+    unsigned int LocalStencil<ValueType>::GetStencilId(void) const
+    {
+        return this->stencil_->GetStencilId();
+    }
+
+    template <typename ValueType>
+    int LocalStencil<ValueType>::GetGrid(void) const
+    {
+        return this->stencil_->GetGrid();
+    }
+
     template <typename ValueType>
     void LocalStencil<ValueType>::Info(void) const
     {
@@ -116,6 +148,85 @@ namespace rocalution
         this->stencil_->SetGrid(size);
     }
 
+    template <typename ValueType>
+    void LocalStencil<ValueType>::SetCoefficients(const LocalVector<ValueType>& coeff)
+    {
+        log_debug(this, "LocalStencil::SetCoefficients()", (const void*&)coeff);
+
+        assert(coeff.GetSize() == this->GetM() || coeff.GetSize() == 3 * this->GetM());
+
+        assert(((this->stencil_ == this->stencil_host_) && (coeff.vector_ == coeff.vector_host_))
+               || ((this->stencil_ == this->stencil_accel_)
+                   && (coeff.vector_ == coeff.vector_accel_)));
+
+        this->stencil_->SetCoefficients(*coeff.vector_);
+    }
+
+    template <typename ValueType>
+    void LocalStencil<ValueType>::ExtractInverseDiagonal(LocalVector<ValueType>* vec_inv_diag) const
+    {
+        log_debug(this, "LocalStencil::ExtractInverseDiagonal()", vec_inv_diag);
+
+        assert(vec_inv_diag != NULL);
+
+        assert(((this->stencil_ == this->stencil_host_)
+                && (vec_inv_diag->vector_ == vec_inv_diag->vector_host_))
+               || ((this->stencil_ == this->stencil_accel_)
+                   && (vec_inv_diag->vector_ == vec_inv_diag->vector_accel_)));
+
+        std::string vec_inv_diag_name = "Inverse of the diagonal elements of " + this->object_name_;
+        vec_inv_diag->Allocate(vec_inv_diag_name, this->GetM());
+
+        this->stencil_->ExtractInverseDiagonal(vec_inv_diag->vector_);
+    }
+
+    template <typename ValueType>
+    void LocalStencil<ValueType>::Coarsen(LocalStencil<ValueType>* coarse) const
+    {
+        log_debug(this, "LocalStencil::Coarsen()", coarse);
+
+        assert(coarse != NULL);
+        assert(coarse != this);
+        assert(coarse->GetStencilId() == this->GetStencilId());
+        assert(this->GetGrid() > 2);
+
+        this->stencil_->Coarsen(coarse->stencil_);
+    }
+
+    template <typename ValueType>
+    void LocalStencil<ValueType>::Restriction(const LocalVector<ValueType>& fine,
+                                              LocalVector<ValueType>*       coarse) const
+    {
+        log_debug(this, "LocalStencil::Restriction()", (const void*&)fine, coarse);
+
+        assert(coarse != NULL);
+
+        assert(((this->stencil_ == this->stencil_host_) && (fine.vector_ == fine.vector_host_)
+                && (coarse->vector_ == coarse->vector_host_))
+               || ((this->stencil_ == this->stencil_accel_)
+                   && (fine.vector_ == fine.vector_accel_)
+                   && (coarse->vector_ == coarse->vector_accel_)));
+
+        this->stencil_->Restriction(*fine.vector_, coarse->vector_);
+    }
+
+    template <typename ValueType>
+    void LocalStencil<ValueType>::Prolongation(const LocalVector<ValueType>& coarse,
+                                               LocalVector<ValueType>*       fine) const
+    {
+        log_debug(this, "LocalStencil::Prolongation()", (const void*&)coarse, fine);
+
+        assert(fine != NULL);
+
+        assert(((this->stencil_ == this->stencil_host_) && (coarse.vector_ == coarse.vector_host_)
+                && (fine->vector_ == fine->vector_host_))
+               || ((this->stencil_ == this->stencil_accel_)
+                   && (coarse.vector_ == coarse.vector_accel_)
+                   && (fine->vector_ == fine->vector_accel_)));
+
+        this->stencil_->Prolongation(*coarse.vector_, fine->vector_);
+    }
+
     template <typename ValueType>
     void LocalStencil<ValueType>::Apply(const LocalVector<ValueType>& in,
                                         LocalVector<ValueType>*       out) const
@@ -146,7 +257,7 @@ namespace rocalution
                || ((this->stencil_ == this->stencil_accel_) && (in.vector_ == in.vector_accel_)
                    && (out->vector_ == out->vector_accel_)));
 
-        this->stencil_->Apply(*in.vector_, out->vector_);
+        this->stencil_->ApplyAdd(*in.vector_, scalar, out->vector_);
     }
 
     template <typename ValueType>
@@ -159,8 +270,10 @@ namespace rocalution
     template <typename ValueType>
     void LocalStencil<ValueType>::MoveToHost(void)
     {
-        LOG_INFO("The function is not implemented (yet)!");
-        FATAL_ERROR(__FILE__, __LINE__);
+        log_debug(this, "LocalStencil::MoveToHost()");
+
+        // Stencils are only available on the host, nothing to do
+        assert(this->stencil_ == this->stencil_host_);
     }
 
     template class LocalStencil<double>;
@@ -79,14 +79,51 @@ namespace rocalution
         virtual int64_t GetN(void) const;
         ROCALUTION_EXPORT
         virtual int64_t GetNnz(void) const;
+        /** \brief Return the stencil type, see stencil_types.hpp */
+        ROCALUTION_EXPORT
+        unsigned int GetStencilId(void) const;
+        /** \brief Return the stencil grid size in each dimension */
+        ROCALUTION_EXPORT
+        int GetGrid(void) const;
 
         /** \brief Set the stencil grid size */
         ROCALUTION_EXPORT
         void SetGrid(int size);
 
+        /** \brief Set the coefficient field of a variable coefficient stencil
+        * \details
+        * For \p Diffusion3D, \p coeff holds either one isotropic coefficient per grid
+        * point (size \f$n^3\f$) or the three directional coefficients
+        * \f$(k_x, k_y, k_z)\f$ stored one after another (size \f$3n^3\f$). Face
+        * coefficients are the harmonic average of the adjacent grid points. The grid
+        * size has to be set before, and \p SetGrid() resets the field to one.
+        */
+        ROCALUTION_EXPORT
+        void SetCoefficients(const LocalVector<ValueType>& coeff);
+
         ROCALUTION_EXPORT
         virtual void Clear();
 
+        /** \brief Extract the inverse of the diagonal of the stencil */
+        ROCALUTION_EXPORT
+        void ExtractInverseDiagonal(LocalVector<ValueType>* vec_inv_diag) const;
+
+        /** \brief Set up the same stencil on the next coarser grid
+        * \details
+        * The coarse grid consists of every second grid point of the fine grid, such that
+        * a grid of size \f$n\f$ is coarsened to size \f$(n-1)/2\f$. Variable coefficients
+        * are coarsened by full weighting averages.
+        */
+        ROCALUTION_EXPORT
+        void Coarsen(LocalStencil<ValueType>* coarse) const;
+
+        /** \brief Full weighting restriction of a vector to the next coarser grid */
+        ROCALUTION_EXPORT
+        void Restriction(const LocalVector<ValueType>& fine, LocalVector<ValueType>* coarse) const;
+        /** \brief Linear interpolation of a vector from the next coarser grid */
+        ROCALUTION_EXPORT
+        void Prolongation(const LocalVector<ValueType>& coarse, LocalVector<ValueType>* fine) const;
+
         ROCALUTION_EXPORT
         virtual void Apply(const LocalVector<ValueType>& in, LocalVector<ValueType>* out) const;
         ROCALUTION_EXPORT
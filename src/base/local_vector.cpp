@@ -34,6 +34,7 @@
 #include <complex>
 #include <sstream>
 #include <stdlib.h>
+#include <vector>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -620,6 +621,43 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void LocalVector<ValueType>::MultiAddScale(const LocalVector<ValueType>* const* vs,
+                                               int                                  k,
+                                               const ValueType*                     alpha)
+    {
+        log_debug(this, "LocalVector::MultiAddScale()", vs, k, alpha);
+
+        assert(k >= 0);
+
+        if(k == 0)
+        {
+            return;
+        }
+
+        assert(vs != NULL);
+        assert(alpha != NULL);
+
+        if(this->GetSize() > 0)
+        {
+            std::vector<const BaseVector<ValueType>*> vec(k);
+
+            for(int j = 0; j < k; ++j)
+            {
+                assert(vs[j] != NULL);
+                assert(this->GetSize() == vs[j]->GetSize());
+                assert(((this->vector_ == this->vector_host_)
+                        && (vs[j]->vector_ == vs[j]->vector_host_))
+                       || ((this->vector_ == this->vector_accel_)
+                           && (vs[j]->vector_ == vs[j]->vector_accel_)));
+
+                vec[j] = vs[j]->vector_;
+            }
+
+            this->vector_->MultiAddScale(vec.data(), k, alpha);
+        }
+    }
+
     template <typename ValueType>
     void LocalVector<ValueType>::ScaleAdd(ValueType alpha, const LocalVector<ValueType>& x)
     {
@@ -752,6 +790,100 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void LocalVector<ValueType>::DotAsync(const LocalVector<ValueType>& x, ValueType* result)
+    {
+        log_debug(this, "LocalVector::DotAsync()", (const void*&)x, result);
+
+        assert(result != NULL);
+
+        // No global reduction involved, compute the result right away
+        *result = this->Dot(x);
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::DotNonConjAsync(const LocalVector<ValueType>& x,
+                                                 ValueType*                    result)
+    {
+        log_debug(this, "LocalVector::DotNonConjAsync()", (const void*&)x, result);
+
+        assert(result != NULL);
+
+        // No global reduction involved, compute the result right away
+        *result = this->DotNonConj(x);
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::MultiDot(const LocalVector<ValueType>* const* vs,
+                                          int                                  k,
+                                          ValueType*                           out) const
+    {
+        log_debug(this, "LocalVector::MultiDot()", vs, k, out);
+
+        assert(k >= 0);
+
+        if(k == 0)
+        {
+            return;
+        }
+
+        assert(vs != NULL);
+        assert(out != NULL);
+
+        if(this->GetSize() > 0)
+        {
+            std::vector<const BaseVector<ValueType>*> vec(k);
+
+            for(int j = 0; j < k; ++j)
+            {
+                assert(vs[j] != NULL);
+                assert(this->GetSize() == vs[j]->GetSize());
+                assert(((this->vector_ == this->vector_host_)
+                        && (vs[j]->vector_ == vs[j]->vector_host_))
+                       || ((this->vector_ == this->vector_accel_)
+                           && (vs[j]->vector_ == vs[j]->vector_accel_)));
+
+                vec[j] = vs[j]->vector_;
+            }
+
+            this->vector_->MultiDot(vec.data(), k, out);
+        }
+        else
+        {
+            set_to_zero_host(k, out);
+        }
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::BlockDot(int                                  m,
+                                          const LocalVector<ValueType>* const* x,
+                                          int                                  n,
+                                          const LocalVector<ValueType>* const* y,
+                                          ValueType*                           out)
+    {
+        log_debug(y, "LocalVector::BlockDot()", m, x, n, out);
+
+        assert(m >= 0);
+        assert(n >= 0);
+
+        if(m == 0 || n == 0)
+        {
+            return;
+        }
+
+        assert(x != NULL);
+        assert(y != NULL);
+        assert(out != NULL);
+
+        // Each column of the block reads its vector y_j only once
+        for(int j = 0; j < n; ++j)
+        {
+            assert(y[j] != NULL);
+
+            y[j]->MultiDot(x, m, out + j * m);
+        }
+    }
+
     template <typename ValueType>
     ValueType LocalVector<ValueType>::Norm(void) const
     {
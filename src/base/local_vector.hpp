@@ -316,6 +316,9 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void AddScale(const LocalVector<ValueType>& x, ValueType alpha);
         ROCALUTION_EXPORT
+        virtual void
+            MultiAddScale(const LocalVector<ValueType>* const* vs, int k, const ValueType* alpha);
+        ROCALUTION_EXPORT
         virtual void ScaleAdd(ValueType alpha, const LocalVector<ValueType>& x);
         ROCALUTION_EXPORT
         virtual void
@@ -340,6 +343,36 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual ValueType DotNonConj(const LocalVector<ValueType>& x) const;
         ROCALUTION_EXPORT
+        virtual void DotAsync(const LocalVector<ValueType>& x, ValueType* result);
+        ROCALUTION_EXPORT
+        virtual void DotNonConjAsync(const LocalVector<ValueType>& x, ValueType* result);
+        ROCALUTION_EXPORT
+        virtual void
+            MultiDot(const LocalVector<ValueType>* const* vs, int k, ValueType* out) const;
+
+        /** \brief Compute the block of dot products of two sets of vectors
+      * \details
+      * Computes the \p m x \p n matrix \f$out = X^{H} Y\f$, stored in column-major order,
+      * i.e. \f$out_{i + j m} = x_{i}^{H} y_{j}\f$.
+      *
+      * @param[in]
+      * m       number of vectors in \p x
+      * @param[in]
+      * x       array of \p m vectors
+      * @param[in]
+      * n       number of vectors in \p y
+      * @param[in]
+      * y       array of \p n vectors
+      * @param[out]
+      * out     array of \p m * \p n dot products
+      */
+        ROCALUTION_EXPORT
+        static void BlockDot(int                                  m,
+                             const LocalVector<ValueType>* const* x,
+                             int                                  n,
+                             const LocalVector<ValueType>* const* y,
+                             ValueType*                           out);
+        ROCALUTION_EXPORT
         virtual ValueType Norm(void) const;
         ROCALUTION_EXPORT
         virtual ValueType Reduce(void) const;
@@ -146,6 +146,40 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void Operator<ValueType>::MultiApply(int                                  num,
+                                         const LocalVector<ValueType>* const* in,
+                                         LocalVector<ValueType>**             out) const
+    {
+        log_debug(this, "Operator::MultiApply()", num, in, out);
+
+        assert(num >= 0);
+        assert(num == 0 || in != NULL);
+        assert(num == 0 || out != NULL);
+
+        for(int j = 0; j < num; ++j)
+        {
+            this->Apply(*in[j], out[j]);
+        }
+    }
+
+    template <typename ValueType>
+    void Operator<ValueType>::MultiApply(int                                   num,
+                                         const GlobalVector<ValueType>* const* in,
+                                         GlobalVector<ValueType>**             out) const
+    {
+        log_debug(this, "Operator::MultiApply()", num, in, out);
+
+        assert(num >= 0);
+        assert(num == 0 || in != NULL);
+        assert(num == 0 || out != NULL);
+
+        for(int j = 0; j < num; ++j)
+        {
+            this->Apply(*in[j], out[j]);
+        }
+    }
+
     template class Operator<double>;
     template class Operator<float>;
 #ifdef SUPPORT_COMPLEX
@@ -116,6 +116,22 @@ namespace rocalution
         virtual void ApplyAdd(const GlobalVector<ValueType>& in,
                               ValueType                      scalar,
                               GlobalVector<ValueType>*       out) const;
+
+        /** \brief Apply the operator to multiple vectors, out[j] = Operator(in[j]), where in
+      * and out are \p num local vectors
+      */
+        ROCALUTION_EXPORT
+        virtual void MultiApply(int                                  num,
+                                const LocalVector<ValueType>* const* in,
+                                LocalVector<ValueType>**             out) const;
+
+        /** \brief Apply the operator to multiple vectors, out[j] = Operator(in[j]), where in
+      * and out are \p num global vectors
+      */
+        ROCALUTION_EXPORT
+        virtual void MultiApply(int                                   num,
+                                const GlobalVector<ValueType>* const* in,
+                                GlobalVector<ValueType>**             out) const;
     };
 
 } // namespace rocalution
@@ -33,6 +33,7 @@
 #include <fstream>
 #include <limits>
 #include <sstream>
+#include <typeinfo>
 #include <vector>
 
 #ifdef SUPPORT_MULTINODE
@@ -82,6 +83,9 @@ namespace rocalution
         this->recv_event_ = NULL;
         this->send_event_ = NULL;
 
+        this->persistent_        = false;
+        this->persistent_active_ = -1;
+
         // if new values are added, also put check into status function
     }
 
@@ -130,6 +134,8 @@ namespace rocalution
         free_host(&this->sends_);
         free_host(&this->send_offset_index_);
 
+        this->FreePersistent_();
+
 #ifdef SUPPORT_MULTINODE
         free_host(&this->recv_event_);
         free_host(&this->send_event_);
@@ -359,6 +365,9 @@ namespace rocalution
             assert(recvs != NULL);
         }
 
+        // Communication pattern changes, persistent requests are invalid
+        this->FreePersistent_();
+
         this->nrecv_ = nrecv;
 
         allocate_host(nrecv, &this->recvs_);
@@ -391,6 +400,9 @@ namespace rocalution
             assert(sends != NULL);
         }
 
+        // Communication pattern changes, persistent requests are invalid
+        this->FreePersistent_();
+
         this->nsend_ = nsend;
 
         allocate_host(nsend, &this->sends_);
@@ -415,6 +427,21 @@ namespace rocalution
 #endif
     }
 
+    void ParallelManager::SetPersistentCommunication(bool persistent)
+    {
+        log_debug(this, "ParallelManager::SetPersistentCommunication()", persistent);
+
+        // Make sure no persistent exchange is in flight
+        this->Synchronize_();
+
+        if(persistent == false)
+        {
+            this->FreePersistent_();
+        }
+
+        this->persistent_ = persistent;
+    }
+
     bool ParallelManager::Status(void) const
     {
         // clang-format off
@@ -712,6 +739,17 @@ namespace rocalution
     void ParallelManager::Synchronize_(void) const
     {
 #ifdef SUPPORT_MULTINODE
+        // Sync ongoing persistent exchange
+        if(this->persistent_active_ >= 0)
+        {
+            const PersistentExchange_& ex = this->persistent_exchange_[this->persistent_active_];
+
+            communication_syncall(ex.nrecv, ex.recv_event);
+            communication_syncall(ex.nsend, ex.send_event);
+
+            this->persistent_active_ = -1;
+        }
+
         // Sync all events
         communication_syncall(this->async_recv_, this->recv_event_);
         communication_syncall(this->async_send_, this->send_event_);
@@ -722,6 +760,47 @@ namespace rocalution
 #endif
     }
 
+    void ParallelManager::FreePersistent_(void) const
+    {
+        if(this->persistent_exchange_.empty() == true)
+        {
+            return;
+        }
+
+        // Persistent requests are released by MPI, if it has already been finalized
+        int finalized = 0;
+
+#ifdef SUPPORT_MULTINODE
+        MPI_Finalized(&finalized);
+#endif
+
+        // Persistent requests must not be freed while active
+        if(finalized == 0)
+        {
+            this->Synchronize_();
+        }
+
+        for(size_t i = 0; i < this->persistent_exchange_.size(); ++i)
+        {
+            PersistentExchange_& ex = this->persistent_exchange_[i];
+
+#ifdef SUPPORT_MULTINODE
+            if(finalized == 0)
+            {
+                communication_request_free(ex.nrecv, ex.recv_event);
+                communication_request_free(ex.nsend, ex.send_event);
+            }
+#endif
+
+            free_host(&ex.recv_event);
+            free_host(&ex.send_event);
+        }
+
+        this->persistent_exchange_.clear();
+
+        this->persistent_active_ = -1;
+    }
+
     template <typename ValueType>
     void ParallelManager::CommunicateAsync_(ValueType* send_buffer, ValueType* recv_buffer) const
     {
@@ -730,10 +809,123 @@ namespace rocalution
 
         assert(this->async_send_ == 0);
         assert(this->async_recv_ == 0);
+        assert(this->persistent_active_ < 0);
         assert(this->Status());
 
         int tag = 0;
 
+        if(this->persistent_ == true)
+        {
+            // Maximum number of buffer pairs with cached persistent requests
+            const size_t max_cache = 8;
+
+            size_t type = typeid(ValueType).hash_code();
+            int    idx  = -1;
+
+            // Look up persistent requests for this pair of buffers
+            for(size_t i = 0; i < this->persistent_exchange_.size(); ++i)
+            {
+                const PersistentExchange_& ex = this->persistent_exchange_[i];
+
+                if(ex.send_buffer == send_buffer && ex.recv_buffer == recv_buffer
+                   && ex.type == type)
+                {
+                    idx = static_cast<int>(i);
+                    break;
+                }
+            }
+
+            if(idx < 0)
+            {
+                // Evict the oldest entry, if cache is full
+                if(this->persistent_exchange_.size() >= max_cache)
+                {
+                    PersistentExchange_& ex = this->persistent_exchange_.front();
+
+#ifdef SUPPORT_MULTINODE
+                    communication_request_free(ex.nrecv, ex.recv_event);
+                    communication_request_free(ex.nsend, ex.send_event);
+#endif
+
+                    free_host(&ex.recv_event);
+                    free_host(&ex.send_event);
+
+                    this->persistent_exchange_.erase(this->persistent_exchange_.begin());
+                }
+
+                PersistentExchange_ ex;
+
+                ex.send_buffer = send_buffer;
+                ex.recv_buffer = recv_buffer;
+                ex.type        = type;
+                ex.recv_event  = NULL;
+                ex.send_event  = NULL;
+                ex.nrecv       = 0;
+                ex.nsend       = 0;
+
+                allocate_host(this->nrecv_ + 1, &ex.recv_event);
+                allocate_host(this->nsend_ + 1, &ex.send_event);
+
+                // Build persistent receive requests
+                for(int n = 0; n < this->nrecv_; ++n)
+                {
+                    int nnz = this->recv_offset_index_[n + 1] - this->recv_offset_index_[n];
+
+                    if(nnz > 0)
+                    {
+                        assert(recv_buffer != NULL);
+
+#ifdef SUPPORT_MULTINODE
+                        communication_recv_init(recv_buffer + this->recv_offset_index_[n],
+                                                nnz,
+                                                this->recvs_[n],
+                                                tag,
+                                                &ex.recv_event[ex.nrecv++],
+                                                this->comm_);
+#endif
+                    }
+                }
+
+                // Build persistent send requests
+                for(int n = 0; n < this->nsend_; ++n)
+                {
+                    int nnz = this->send_offset_index_[n + 1] - this->send_offset_index_[n];
+
+                    if(nnz > 0)
+                    {
+                        assert(send_buffer != NULL);
+
+#ifdef SUPPORT_MULTINODE
+                        communication_send_init(send_buffer + this->send_offset_index_[n],
+                                                nnz,
+                                                this->sends_[n],
+                                                tag,
+                                                &ex.send_event[ex.nsend++],
+                                                this->comm_);
+#endif
+                    }
+                }
+
+                this->persistent_exchange_.push_back(ex);
+
+                idx = static_cast<int>(this->persistent_exchange_.size()) - 1;
+            }
+
+            const PersistentExchange_& ex = this->persistent_exchange_[idx];
+
+#ifdef SUPPORT_MULTINODE
+            // Restart receives first, then sends
+            communication_startall(ex.nrecv, ex.recv_event);
+            communication_startall(ex.nsend, ex.send_event);
+#endif
+
+            this->persistent_active_ = idx;
+
+            log_debug(this, "ParallelManager::CommunicateAsync_()", "#*# end");
+
+            return;
+        }
+
         // async recv boundary from neighbors
         for(int n = 0; n < this->nrecv_; ++n)
         {
@@ -1170,6 +1362,9 @@ namespace rocalution
                                                               const ParallelManager& parent,
                                                               bool                   transposed)
     {
+        // Communication pattern is regenerated, persistent requests are invalid
+        this->FreePersistent_();
+
         // Allocate
         std::vector<int>     recv_size(parent.num_procs_, 0);
         std::vector<int64_t> recv_index;
@@ -1376,6 +1571,7 @@ namespace rocalution
     }
 
     template void ParallelManager::CommunicateAsync_<int>(int*, int*) const;
+    template void ParallelManager::CommunicateAsync_<int64_t>(int64_t*, int64_t*) const;
     template void ParallelManager::CommunicateAsync_<float>(float*, float*) const;
     template void ParallelManager::CommunicateAsync_<double>(double*, double*) const;
     template void
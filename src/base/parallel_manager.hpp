@@ -29,6 +29,7 @@
 
 #include <complex>
 #include <string>
+#include <vector>
 
 namespace rocalution
 {
@@ -160,6 +161,19 @@ namespace rocalution
         ROCALUTION_EXPORT
         bool Status(void) const;
 
+        /** \brief Enable or disable persistent communication
+      * \details
+      * If enabled, the boundary exchange builds persistent send and receive requests
+      * once per pair of communication buffers and restarts them on each exchange,
+      * avoiding the per-message setup cost of non-blocking point-to-point calls. This
+      * is beneficial for decompositions with many neighbors and operators that are
+      * applied repeatedly, e.g. within iterative solvers. The requests are released
+      * when the communication pattern changes or the parallel manager is cleared.
+      * Disabled by default.
+      */
+        ROCALUTION_EXPORT
+        void SetPersistentCommunication(bool persistent);
+
         /** \brief Read file that contains all relevant parallel manager data */
         ROCALUTION_EXPORT
         void ReadFileASCII(const std::string& filename);
@@ -217,6 +231,9 @@ namespace rocalution
         // Synchronize all events within this PM
         void Synchronize_(void) const;
 
+        // Release all persistent communication requests
+        void FreePersistent_(void) const;
+
         // Communicate global row and column offsets (async)
         void CommunicateGlobalOffsetAsync_(void) const;
         // Synchronize communication
@@ -288,6 +305,27 @@ namespace rocalution
         MRequest* recv_event_;
         MRequest* send_event_;
 
+        // Persistent boundary exchange, bound to a pair of communication buffers
+        struct PersistentExchange_
+        {
+            const void* send_buffer;
+            const void* recv_buffer;
+            size_t      type;
+
+            MRequest* recv_event;
+            MRequest* send_event;
+
+            int nrecv;
+            int nsend;
+        };
+
+        // Flag whether persistent communication is enabled
+        bool persistent_;
+        // Cache of persistent boundary exchanges
+        mutable std::vector<PersistentExchange_> persistent_exchange_;
+        // Index of the ongoing persistent exchange (-1 if none)
+        mutable int persistent_active_;
+
         friend class GlobalMatrix<double>;
         friend class GlobalMatrix<float>;
         friend class GlobalMatrix<std::complex<double>>;
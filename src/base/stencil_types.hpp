@@ -30,12 +30,16 @@ namespace rocalution
 {
 
     // Stencil Names
-    const std::string _stencil_type_names[1] = {"Laplace2D"};
+    const std::string _stencil_type_names[4]
+        = {"Laplace2D", "Laplace3D", "Laplace3D27", "Diffusion3D"};
 
     // Stencil Enumeration
     enum _stencil_type
     {
-        Laplace2D = 0
+        Laplace2D   = 0,
+        Laplace3D   = 1,
+        Laplace3D27 = 2,
+        Diffusion3D = 3
     };
 
 } // namespace rocalution
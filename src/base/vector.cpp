@@ -158,6 +158,30 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void Vector<ValueType>::MultiAddScale(const LocalVector<ValueType>* const* vs,
+                                          int                                  k,
+                                          const ValueType*                     alpha)
+    {
+        LOG_INFO("Vector<ValueType>::MultiAddScale(const LocalVector<ValueType>* const* vs, int k, "
+                 "const ValueType* alpha)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::MultiAddScale(const GlobalVector<ValueType>* const* vs,
+                                          int                                   k,
+                                          const ValueType*                      alpha)
+    {
+        LOG_INFO("Vector<ValueType>::MultiAddScale(const GlobalVector<ValueType>* const* vs, int "
+                 "k, const ValueType* alpha)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     void Vector<ValueType>::ScaleAdd(ValueType alpha, const LocalVector<ValueType>& x)
     {
@@ -258,6 +282,78 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void Vector<ValueType>::DotAsync(const LocalVector<ValueType>& x, ValueType* result)
+    {
+        LOG_INFO("Vector<ValueType>::DotAsync(const LocalVector<ValueType>& x, ValueType* result)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::DotAsync(const GlobalVector<ValueType>& x, ValueType* result)
+    {
+        LOG_INFO(
+            "Vector<ValueType>::DotAsync(const GlobalVector<ValueType>& x, ValueType* result)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::DotNonConjAsync(const LocalVector<ValueType>& x, ValueType* result)
+    {
+        LOG_INFO("Vector<ValueType>::DotNonConjAsync(const LocalVector<ValueType>& x, ValueType* "
+                 "result)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::DotNonConjAsync(const GlobalVector<ValueType>& x, ValueType* result)
+    {
+        LOG_INFO("Vector<ValueType>::DotNonConjAsync(const GlobalVector<ValueType>& x, "
+                 "ValueType* result)");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::DotSync(void)
+    {
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::MultiDot(const LocalVector<ValueType>* const* vs,
+                                     int                                  k,
+                                     ValueType*                           out) const
+    {
+        LOG_INFO("Vector<ValueType>::MultiDot(const LocalVector<ValueType>* const* vs, int k, "
+                 "ValueType* out) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::MultiDot(const GlobalVector<ValueType>* const* vs,
+                                     int                                   k,
+                                     ValueType*                            out) const
+    {
+        LOG_INFO("Vector<ValueType>::MultiDot(const GlobalVector<ValueType>* const* vs, int k, "
+                 "ValueType* out) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
     template <typename ValueType>
     ValueType Vector<ValueType>::InclusiveSum(const LocalVector<ValueType>& vec)
     {
@@ -289,6 +289,26 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual void AddScale(const GlobalVector<ValueType>& x, ValueType alpha);
 
+        /** \brief Perform vector update of type this = this + sum_j alpha_j * vs_j
+      * \details
+      * Adds a linear combination of \p k vectors to this vector, reading and writing this
+      * vector only once.
+      *
+      * @param[in]
+      * vs      array of \p k vectors
+      * @param[in]
+      * k       number of vectors
+      * @param[in]
+      * alpha   array of \p k scaling factors
+      */
+        ROCALUTION_EXPORT
+        virtual void
+            MultiAddScale(const LocalVector<ValueType>* const* vs, int k, const ValueType* alpha);
+        /** \brief Perform vector update of type this = this + sum_j alpha_j * vs_j */
+        ROCALUTION_EXPORT
+        virtual void
+            MultiAddScale(const GlobalVector<ValueType>* const* vs, int k, const ValueType* alpha);
+
         /** \brief Perform vector update of type this = alpha * this + x */
         ROCALUTION_EXPORT
         virtual void ScaleAdd(ValueType alpha, const LocalVector<ValueType>& x);
@@ -354,6 +374,50 @@ namespace rocalution
         ROCALUTION_EXPORT
         virtual ValueType DotNonConj(const GlobalVector<ValueType>& x) const;
 
+        /** \brief Start the computation of the dot (scalar) product this^T x
+      * \details
+      * The local contribution is computed immediately, while the global reduction is
+      * started without blocking. \p result is not valid before DotSync() has been called.
+      * Several dot products can be pending on the same vector at a time, they are
+      * completed in the order they have been started.
+      */
+        ROCALUTION_EXPORT
+        virtual void DotAsync(const LocalVector<ValueType>& x, ValueType* result);
+        /** \brief Start the computation of the dot (scalar) product this^T x */
+        ROCALUTION_EXPORT
+        virtual void DotAsync(const GlobalVector<ValueType>& x, ValueType* result);
+
+        /** \brief Start the computation of the non-conjugate dot (scalar) product this^T x */
+        ROCALUTION_EXPORT
+        virtual void DotNonConjAsync(const LocalVector<ValueType>& x, ValueType* result);
+        /** \brief Start the computation of the non-conjugate dot (scalar) product this^T x */
+        ROCALUTION_EXPORT
+        virtual void DotNonConjAsync(const GlobalVector<ValueType>& x, ValueType* result);
+        /** \brief Wait for all dot products started with DotNonConjAsync() to complete */
+        ROCALUTION_EXPORT
+        virtual void DotSync(void);
+
+        /** \brief Compute the dot (scalar) products of \p k vectors with this vector
+      * \details
+      * Computes \f$out_{j} = vs_{j}^{H} this\f$ for \f$j = 0, \dots, k-1\f$. This vector
+      * is read only once and, for distributed vectors, all \p k results are obtained
+      * with a single global reduction.
+      *
+      * @param[in]
+      * vs      array of \p k vectors
+      * @param[in]
+      * k       number of vectors
+      * @param[out]
+      * out     array of \p k dot products
+      */
+        ROCALUTION_EXPORT
+        virtual void
+            MultiDot(const LocalVector<ValueType>* const* vs, int k, ValueType* out) const;
+        /** \brief Compute the dot (scalar) products of \p k vectors with this vector */
+        ROCALUTION_EXPORT
+        virtual void
+            MultiDot(const GlobalVector<ValueType>* const* vs, int k, ValueType* out) const;
+
         /** \brief Compute \f$L_2\f$ norm of the vector, return = srqt(this^T this) */
         virtual ValueType Norm(void) const = 0;
 
@@ -31,6 +31,8 @@
 #include "version.hpp"
 
 #include "base/backend_manager.hpp"
+#include "base/batched_matrix.hpp"
+#include "base/batched_vector.hpp"
 #include "base/parallel_manager.hpp"
 
 #include "base/operator.hpp"
@@ -46,6 +48,10 @@
 #include "base/local_stencil.hpp"
 #include "base/stencil_types.hpp"
 
+#include "solvers/batched/batched_bicgstab.hpp"
+#include "solvers/batched/batched_cg.hpp"
+#include "solvers/batched/batched_gmres.hpp"
+#include "solvers/batched/batched_solver.hpp"
 #include "solvers/chebyshev.hpp"
 #include "solvers/direct/inversion.hpp"
 #include "solvers/direct/lu.hpp"
@@ -53,16 +59,26 @@
 #include "solvers/iter_ctrl.hpp"
 #include "solvers/krylov/bicgstab.hpp"
 #include "solvers/krylov/bicgstabl.hpp"
+#include "solvers/krylov/block_cg.hpp"
+#include "solvers/krylov/block_gmres.hpp"
 #include "solvers/krylov/cg.hpp"
+#include "solvers/krylov/chronopoulos_gear_cg.hpp"
 #include "solvers/krylov/cr.hpp"
+#include "solvers/krylov/deflated_cg.hpp"
 #include "solvers/krylov/fcg.hpp"
 #include "solvers/krylov/fgmres.hpp"
+#include "solvers/krylov/gcrodr.hpp"
 #include "solvers/krylov/gmres.hpp"
 #include "solvers/krylov/idr.hpp"
+#include "solvers/krylov/merged_bicgstab.hpp"
+#include "solvers/krylov/pipelined_cg.hpp"
 #include "solvers/krylov/qmrcgstab.hpp"
+#include "solvers/krylov/sstep_cg.hpp"
+#include "solvers/krylov/sstep_gmres.hpp"
 #include "solvers/mixed_precision.hpp"
 #include "solvers/multigrid/base_amg.hpp"
 #include "solvers/multigrid/base_multigrid.hpp"
+#include "solvers/multigrid/geometric_multigrid.hpp"
 #include "solvers/multigrid/multigrid.hpp"
 #include "solvers/multigrid/pairwise_amg.hpp"
 #include "solvers/multigrid/ruge_stueben_amg.hpp"
@@ -0,0 +1,188 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "batched_bicgstab.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <complex>
+#include <math.h>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    BatchedBiCGStab<ValueType>::BatchedBiCGStab()
+    {
+        log_debug(this, "BatchedBiCGStab::BatchedBiCGStab()", "default constructor");
+    }
+
+    template <typename ValueType>
+    BatchedBiCGStab<ValueType>::~BatchedBiCGStab()
+    {
+        log_debug(this, "BatchedBiCGStab::~BatchedBiCGStab()", "destructor");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void BatchedBiCGStab<ValueType>::Print(void) const
+    {
+        LOG_INFO("BatchedBiCGStab solver");
+    }
+
+    template <typename ValueType>
+    int64_t BatchedBiCGStab<ValueType>::WorkspaceSize_(int n) const
+    {
+        // r, r0, p, v, phat, shat, t
+        return 7 * static_cast<int64_t>(n);
+    }
+
+    template <typename ValueType>
+    void BatchedBiCGStab<ValueType>::SolveSystem_(int               index,
+                                                  const ValueType*  rhs,
+                                                  ValueType*        x,
+                                                  ValueType*        work,
+                                                  IterationControl* iter_ctrl) const
+    {
+        int n = this->GetSize_(index);
+
+        ValueType* r    = work;
+        ValueType* r0   = work + n;
+        ValueType* p    = work + 2 * n;
+        ValueType* v    = work + 3 * n;
+        ValueType* phat = work + 4 * n;
+        ValueType* shat = work + 5 * n;
+        ValueType* t    = work + 6 * n;
+
+        // initial residual r = b - Ax
+        this->Apply_(index, x, r);
+
+        for(int i = 0; i < n; ++i)
+        {
+            r[i] = rhs[i] - r[i];
+        }
+
+        double res = this->Norm_(n, r);
+
+        if(iter_ctrl->InitResidual(res) == false)
+        {
+            return;
+        }
+
+        // r0 = p = r
+        copy_h2h(n, r, r0);
+        copy_h2h(n, r, p);
+
+        // rho = (r0,r)
+        ValueType rho = this->Dot_(n, r0, r);
+
+        while(true)
+        {
+            // v = A M^-1 p
+            this->Precond_(index, p, phat);
+            this->Apply_(index, phat, v);
+
+            // alpha = rho / (r0,v)
+            ValueType r0v = this->Dot_(n, r0, v);
+
+            if(r0v == static_cast<ValueType>(0))
+            {
+                break;
+            }
+
+            ValueType alpha = rho / r0v;
+
+            // s = r - alpha * v
+            this->Axpy_(n, -alpha, v, r);
+
+            res = this->Norm_(n, r);
+
+            if(iter_ctrl->CheckResidualNoCount(res))
+            {
+                // x = x + alpha * phat
+                this->Axpy_(n, alpha, phat, x);
+                iter_ctrl->CheckResidual(res);
+                break;
+            }
+
+            // t = A M^-1 s
+            this->Precond_(index, r, shat);
+            this->Apply_(index, shat, t);
+
+            // omega = (t,s) / (t,t)
+            ValueType tt = this->Dot_(n, t, t);
+
+            if(tt == static_cast<ValueType>(0))
+            {
+                break;
+            }
+
+            ValueType omega = this->Dot_(n, t, r) / tt;
+
+            // x = x + alpha * phat + omega * shat
+            // r = s - omega * t
+            for(int i = 0; i < n; ++i)
+            {
+                x[i] += alpha * phat[i] + omega * shat[i];
+                r[i] -= omega * t[i];
+            }
+
+            res = this->Norm_(n, r);
+
+            if(iter_ctrl->CheckResidual(res))
+            {
+                break;
+            }
+
+            // rho = (r0,r)
+            ValueType rho_old = rho;
+            rho               = this->Dot_(n, r0, r);
+
+            if(rho == static_cast<ValueType>(0) || omega == static_cast<ValueType>(0))
+            {
+                break;
+            }
+
+            // p = r + beta * (p - omega * v)
+            ValueType beta = (rho / rho_old) * (alpha / omega);
+
+            for(int i = 0; i < n; ++i)
+            {
+                p[i] = r[i] + beta * (p[i] - omega * v[i]);
+            }
+        }
+    }
+
+    template class BatchedBiCGStab<double>;
+    template class BatchedBiCGStab<float>;
+#ifdef SUPPORT_COMPLEX
+    template class BatchedBiCGStab<std::complex<double>>;
+    template class BatchedBiCGStab<std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "batched_cg.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <complex>
+#include <math.h>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    BatchedCG<ValueType>::BatchedCG()
+    {
+        log_debug(this, "BatchedCG::BatchedCG()", "default constructor");
+    }
+
+    template <typename ValueType>
+    BatchedCG<ValueType>::~BatchedCG()
+    {
+        log_debug(this, "BatchedCG::~BatchedCG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void BatchedCG<ValueType>::Print(void) const
+    {
+        LOG_INFO("BatchedCG solver");
+    }
+
+    template <typename ValueType>
+    int64_t BatchedCG<ValueType>::WorkspaceSize_(int n) const
+    {
+        // r, z, p, q
+        return 4 * static_cast<int64_t>(n);
+    }
+
+    template <typename ValueType>
+    void BatchedCG<ValueType>::SolveSystem_(int               index,
+                                            const ValueType*  rhs,
+                                            ValueType*        x,
+                                            ValueType*        work,
+                                            IterationControl* iter_ctrl) const
+    {
+        int n = this->GetSize_(index);
+
+        ValueType* r = work;
+        ValueType* z = work + n;
+        ValueType* p = work + 2 * n;
+        ValueType* q = work + 3 * n;
+
+        // initial residual r = b - Ax
+        this->Apply_(index, x, r);
+
+        for(int i = 0; i < n; ++i)
+        {
+            r[i] = rhs[i] - r[i];
+        }
+
+        double res = this->Norm_(n, r);
+
+        if(iter_ctrl->InitResidual(res) == false)
+        {
+            return;
+        }
+
+        // p = z = M^-1 r
+        this->Precond_(index, r, z);
+        copy_h2h(n, z, p);
+
+        // rho = (r,z)
+        ValueType rho = this->Dot_(n, r, z);
+
+        while(true)
+        {
+            // q = Ap
+            this->Apply_(index, p, q);
+
+            // alpha = rho / (p,q)
+            ValueType pq = this->Dot_(n, p, q);
+
+            if(pq == static_cast<ValueType>(0))
+            {
+                break;
+            }
+
+            ValueType alpha = rho / pq;
+
+            // x = x + alpha * p
+            // r = r - alpha * q
+            this->Axpy_(n, alpha, p, x);
+            this->Axpy_(n, -alpha, q, r);
+
+            res = this->Norm_(n, r);
+
+            if(iter_ctrl->CheckResidual(res))
+            {
+                break;
+            }
+
+            // z = M^-1 r
+            this->Precond_(index, r, z);
+
+            // rho = (r,z)
+            ValueType rho_old = rho;
+            rho               = this->Dot_(n, r, z);
+
+            // p = z + beta * p
+            ValueType beta = rho / rho_old;
+
+            for(int i = 0; i < n; ++i)
+            {
+                p[i] = z[i] + beta * p[i];
+            }
+        }
+    }
+
+    template class BatchedCG<double>;
+    template class BatchedCG<float>;
+#ifdef SUPPORT_COMPLEX
+    template class BatchedCG<std::complex<double>>;
+    template class BatchedCG<std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_BATCHED_CG_HPP_
+#define ROCALUTION_BATCHED_CG_HPP_
+
+#include "batched_solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class BatchedCG
+  * \brief Batched Conjugate Gradient Method
+  * \details
+  * Solves a batch of independent symmetric positive definite (SPD) systems with the
+  * preconditioned Conjugate Gradient method, see CG. Each system is solved by a single
+  * thread, see BatchedIterativeSolver. The preconditioner should also be SPD, i.e.
+  * BatchedILU0 is only suitable for systems with symmetric sparsity pattern and values
+  * that lead to an SPD factorization.
+  * \cite SAAD
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <typename ValueType>
+    class BatchedCG : public BatchedIterativeSolver<ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        BatchedCG();
+        ROCALUTION_EXPORT
+        virtual ~BatchedCG();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+    protected:
+        virtual int64_t WorkspaceSize_(int n) const;
+
+        virtual void SolveSystem_(int               index,
+                                  const ValueType*  rhs,
+                                  ValueType*        x,
+                                  ValueType*        work,
+                                  IterationControl* iter_ctrl) const;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_BATCHED_CG_HPP_
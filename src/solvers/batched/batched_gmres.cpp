@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "batched_gmres.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <complex>
+#include <math.h>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    BatchedGMRES<ValueType>::BatchedGMRES()
+    {
+        log_debug(this, "BatchedGMRES::BatchedGMRES()", "default constructor");
+
+        this->size_basis_ = 30;
+    }
+
+    template <typename ValueType>
+    BatchedGMRES<ValueType>::~BatchedGMRES()
+    {
+        log_debug(this, "BatchedGMRES::~BatchedGMRES()", "destructor");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void BatchedGMRES<ValueType>::Print(void) const
+    {
+        LOG_INFO("BatchedGMRES(" << this->size_basis_ << ") solver");
+    }
+
+    template <typename ValueType>
+    void BatchedGMRES<ValueType>::SetBasisSize(int size_basis)
+    {
+        log_debug(this, "BatchedGMRES::SetBasisSize()", size_basis);
+
+        assert(size_basis > 0);
+
+        this->size_basis_ = size_basis;
+    }
+
+    template <typename ValueType>
+    int64_t BatchedGMRES<ValueType>::WorkspaceSize_(int n) const
+    {
+        int64_t m = this->size_basis_;
+
+        // V, z, w, H, g, c, s
+        return (m + 3) * n + (m + 1) * m + (m + 1) + 2 * m;
+    }
+
+    template <typename ValueType>
+    void BatchedGMRES<ValueType>::SolveSystem_(int               index,
+                                               const ValueType*  rhs,
+                                               ValueType*        x,
+                                               ValueType*        work,
+                                               IterationControl* iter_ctrl) const
+    {
+        int n = this->GetSize_(index);
+        int m = this->size_basis_;
+
+        ValueType* V = work;
+        ValueType* z = V + static_cast<int64_t>(m + 1) * n;
+        ValueType* w = z + n;
+        ValueType* H = w + n;
+        ValueType* g = H + (m + 1) * m;
+        ValueType* c = g + (m + 1);
+        ValueType* s = c + m;
+
+        // initial residual V_0 = b - Ax
+        this->Apply_(index, x, V);
+
+        for(int i = 0; i < n; ++i)
+        {
+            V[i] = rhs[i] - V[i];
+        }
+
+        double res = this->Norm_(n, V);
+
+        if(iter_ctrl->InitResidual(res) == false)
+        {
+            return;
+        }
+
+        bool done = false;
+
+        while(done == false)
+        {
+            // V_0 = r / |r|, g = |r| e_1
+            ValueType beta = static_cast<ValueType>(res);
+
+            for(int i = 0; i < n; ++i)
+            {
+                V[i] /= beta;
+            }
+
+            g[0] = beta;
+
+            int k = 0;
+
+            while(k < m)
+            {
+                ValueType* v_k  = V + static_cast<int64_t>(k) * n;
+                ValueType* v_k1 = v_k + n;
+                ValueType* h    = H + (m + 1) * k;
+
+                // w = A M^-1 v_k
+                this->Precond_(index, v_k, z);
+                this->Apply_(index, z, w);
+
+                // Modified Gram-Schmidt
+                for(int i = 0; i <= k; ++i)
+                {
+                    h[i] = this->Dot_(n, V + static_cast<int64_t>(i) * n, w);
+                    this->Axpy_(n, -h[i], V + static_cast<int64_t>(i) * n, w);
+                }
+
+                double h_norm = this->Norm_(n, w);
+
+                h[k + 1] = static_cast<ValueType>(h_norm);
+
+                if(h_norm > 0.0)
+                {
+                    for(int i = 0; i < n; ++i)
+                    {
+                        v_k1[i] = w[i] / h[k + 1];
+                    }
+                }
+
+                // Apply the previous Givens rotations to the new column
+                for(int i = 0; i < k; ++i)
+                {
+                    ValueType tmp = c[i] * h[i] + s[i] * h[i + 1];
+                    h[i + 1]      = -rocalution_conj(s[i]) * h[i] + c[i] * h[i + 1];
+                    h[i]          = tmp;
+                }
+
+                // Compute the new rotation that eliminates h[k + 1]
+                double a_abs = std::abs(h[k]);
+                double nrm   = sqrt(a_abs * a_abs + h_norm * h_norm);
+
+                if(nrm == 0.0)
+                {
+                    done = true;
+                    break;
+                }
+
+                if(a_abs == 0.0)
+                {
+                    c[k] = static_cast<ValueType>(0);
+                    s[k] = static_cast<ValueType>(1);
+                }
+                else
+                {
+                    c[k] = static_cast<ValueType>(a_abs / nrm);
+                    s[k] = h[k] / static_cast<ValueType>(a_abs)
+                           * rocalution_conj(h[k + 1]) / static_cast<ValueType>(nrm);
+                }
+
+                h[k]     = c[k] * h[k] + s[k] * h[k + 1];
+                h[k + 1] = static_cast<ValueType>(0);
+
+                g[k + 1] = -rocalution_conj(s[k]) * g[k];
+                g[k]     = c[k] * g[k];
+
+                ++k;
+
+                res = std::abs(g[k]);
+
+                if(iter_ctrl->CheckResidual(res))
+                {
+                    done = true;
+                    break;
+                }
+
+                // Lucky breakdown, the solution is exact in the current subspace
+                if(h_norm == 0.0)
+                {
+                    break;
+                }
+            }
+
+            // Solve the upper triangular least squares system H y = g in place
+            for(int i = k - 1; i >= 0; --i)
+            {
+                for(int j = i + 1; j < k; ++j)
+                {
+                    g[i] -= H[i + (m + 1) * j] * g[j];
+                }
+
+                g[i] /= H[i + (m + 1) * i];
+            }
+
+            // x = x + M^-1 V y
+            if(k > 0)
+            {
+                set_to_zero_host(n, w);
+
+                for(int j = 0; j < k; ++j)
+                {
+                    this->Axpy_(n, g[j], V + static_cast<int64_t>(j) * n, w);
+                }
+
+                this->Precond_(index, w, z);
+                this->Axpy_(n, static_cast<ValueType>(1), z, x);
+            }
+
+            if(done == true)
+            {
+                break;
+            }
+
+            // Restart with the true residual V_0 = b - Ax
+            this->Apply_(index, x, V);
+
+            for(int i = 0; i < n; ++i)
+            {
+                V[i] = rhs[i] - V[i];
+            }
+
+            res = this->Norm_(n, V);
+
+            if(iter_ctrl->CheckResidualNoCount(res))
+            {
+                break;
+            }
+        }
+    }
+
+    template class BatchedGMRES<double>;
+    template class BatchedGMRES<float>;
+#ifdef SUPPORT_COMPLEX
+    template class BatchedGMRES<std::complex<double>>;
+    template class BatchedGMRES<std::complex<float>>;
+#endif
+
+} // namespace rocalution
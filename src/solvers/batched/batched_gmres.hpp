@@ -0,0 +1,77 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_BATCHED_GMRES_HPP_
+#define ROCALUTION_BATCHED_GMRES_HPP_
+
+#include "batched_solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class BatchedGMRES
+  * \brief Batched Generalized Minimum Residual Method
+  * \details
+  * Solves a batch of independent general systems with the right preconditioned and
+  * restarted GMRES method, see GMRES. Each system is solved by a single thread, see
+  * BatchedIterativeSolver. The Krylov basis is orthogonalized with the modified
+  * Gram-Schmidt method. The size of the Krylov basis can be set with SetBasisSize()
+  * and defaults to 30.
+  * \cite SAAD
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <typename ValueType>
+    class BatchedGMRES : public BatchedIterativeSolver<ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        BatchedGMRES();
+        ROCALUTION_EXPORT
+        virtual ~BatchedGMRES();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        /** \brief Set the size of the Krylov subspace basis */
+        ROCALUTION_EXPORT
+        void SetBasisSize(int size_basis);
+
+    protected:
+        virtual int64_t WorkspaceSize_(int n) const;
+
+        virtual void SolveSystem_(int               index,
+                                  const ValueType*  rhs,
+                                  ValueType*        x,
+                                  ValueType*        work,
+                                  IterationControl* iter_ctrl) const;
+
+        /** \brief Size of the Krylov subspace basis */
+        int size_basis_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_BATCHED_GMRES_HPP_
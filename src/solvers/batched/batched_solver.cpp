@@ -0,0 +1,563 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "batched_solver.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <math.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    BatchedIterativeSolver<ValueType>::BatchedIterativeSolver()
+    {
+        log_debug(this, "BatchedIterativeSolver::BatchedIterativeSolver()");
+
+        this->op_      = NULL;
+        this->precond_ = BatchedNone;
+
+        this->prec_val_  = NULL;
+        this->prec_diag_ = NULL;
+
+        this->abs_tol_  = 1e-15;
+        this->rel_tol_  = 1e-6;
+        this->div_tol_  = 1e+8;
+        this->max_iter_ = 1000000;
+
+        this->verb_  = 1;
+        this->build_ = false;
+    }
+
+    template <typename ValueType>
+    BatchedIterativeSolver<ValueType>::~BatchedIterativeSolver()
+    {
+        log_debug(this, "BatchedIterativeSolver::~BatchedIterativeSolver()");
+
+        free_host(&this->prec_val_);
+        free_host(&this->prec_diag_);
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::SetOperator(const BatchedMatrix<ValueType>& op)
+    {
+        log_debug(this, "BatchedIterativeSolver::SetOperator()", (const void*&)op);
+
+        this->op_ = &op;
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::SetPreconditioner(BatchedPrecond precond)
+    {
+        log_debug(this, "BatchedIterativeSolver::SetPreconditioner()", precond);
+
+        assert(this->build_ == false);
+        assert(precond == BatchedNone || precond == BatchedJacobi || precond == BatchedILU0);
+
+        this->precond_ = precond;
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::Init(double abs_tol,
+                                                 double rel_tol,
+                                                 double div_tol,
+                                                 int    max_iter)
+    {
+        log_debug(this, "BatchedIterativeSolver::Init()", abs_tol, rel_tol, div_tol, max_iter);
+
+        this->abs_tol_  = abs_tol;
+        this->rel_tol_  = rel_tol;
+        this->div_tol_  = div_tol;
+        this->max_iter_ = max_iter;
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::Verbose(int verb)
+    {
+        log_debug(this, "BatchedIterativeSolver::Verbose()", verb);
+
+        this->verb_ = verb;
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::Build(void)
+    {
+        log_debug(this, "BatchedIterativeSolver::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+
+        this->build_ = true;
+
+        this->iter_ctrl_.resize(this->op_->GetBatchCount());
+
+        this->ReBuildNumeric();
+
+        log_debug(this, "BatchedIterativeSolver::Build()", this->build_, " #*# end");
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "BatchedIterativeSolver::ReBuildNumeric()", this->build_);
+
+        assert(this->build_ == true);
+        assert(this->op_ != NULL);
+        assert(this->op_->GetBatchCount() == static_cast<int>(this->iter_ctrl_.size()));
+
+        free_host(&this->prec_val_);
+        free_host(&this->prec_diag_);
+
+        if(this->precond_ == BatchedJacobi)
+        {
+            allocate_host(this->op_->GetTotalM(), &this->prec_val_);
+        }
+        else if(this->precond_ == BatchedILU0)
+        {
+            allocate_host(this->op_->GetTotalNnz(), &this->prec_val_);
+            allocate_host(this->op_->GetTotalM(), &this->prec_diag_);
+
+            copy_h2h(this->op_->GetTotalNnz(), this->op_->val_, this->prec_val_);
+        }
+
+        if(this->precond_ == BatchedNone)
+        {
+            return;
+        }
+
+        int batch_count = this->op_->GetBatchCount();
+        int failed      = 0;
+
+        _set_omp_backend_threads(*_get_backend_descriptor(), this->op_->GetTotalNnz());
+
+#ifdef _OPENMP
+#pragma omp parallel reduction(+ : failed)
+#endif
+        {
+            // Scatter map of the current row, used by ILU0
+            int* map = NULL;
+
+            if(this->precond_ == BatchedILU0)
+            {
+                allocate_host(this->op_->GetMaxM(), &map);
+
+                for(int i = 0; i < this->op_->GetMaxM(); ++i)
+                {
+                    map[i] = -1;
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for(int i = 0; i < batch_count; ++i)
+            {
+                if(this->BuildPrecond_(i, map) == false)
+                {
+                    ++failed;
+                }
+            }
+
+            free_host(&map);
+        }
+
+        if(failed > 0)
+        {
+            LOG_INFO("BatchedIterativeSolver::ReBuildNumeric() "
+                     << failed << " systems with missing or zero diagonal entries");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::Clear(void)
+    {
+        log_debug(this, "BatchedIterativeSolver::Clear()", this->build_);
+
+        free_host(&this->prec_val_);
+        free_host(&this->prec_diag_);
+
+        this->iter_ctrl_.clear();
+
+        this->build_ = false;
+    }
+
+    template <typename ValueType>
+    bool BatchedIterativeSolver<ValueType>::BuildPrecond_(int index, int* map)
+    {
+        const BatchedMatrix<ValueType>* op = this->op_;
+
+        int              n   = op->GetM(index);
+        const PtrType*   ptr = op->row_offset_ + op->row_begin_[index] + index;
+        const int*       col = op->col_ + op->nnz_begin_[index];
+        const ValueType* val = op->val_ + op->nnz_begin_[index];
+
+        if(this->precond_ == BatchedJacobi)
+        {
+            ValueType* inv_diag = this->prec_val_ + op->row_begin_[index];
+
+            // Rows without diagonal entry are not scaled
+            for(int i = 0; i < n; ++i)
+            {
+                inv_diag[i] = static_cast<ValueType>(1);
+
+                for(PtrType j = ptr[i]; j < ptr[i + 1]; ++j)
+                {
+                    if(col[j] == i && val[j] != static_cast<ValueType>(0))
+                    {
+                        inv_diag[i] = static_cast<ValueType>(1) / val[j];
+                        break;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        assert(this->precond_ == BatchedILU0);
+        assert(map != NULL);
+
+        ValueType* lu   = this->prec_val_ + op->nnz_begin_[index];
+        PtrType*   diag = this->prec_diag_ + op->row_begin_[index];
+
+        for(int i = 0; i < n; ++i)
+        {
+            diag[i] = -1;
+
+            for(PtrType j = ptr[i]; j < ptr[i + 1]; ++j)
+            {
+                if(col[j] == i)
+                {
+                    diag[i] = j;
+                    break;
+                }
+            }
+
+            if(diag[i] == -1)
+            {
+                return false;
+            }
+        }
+
+        // IKJ variant of ILU0, columns are sorted within each row
+        for(int i = 0; i < n; ++i)
+        {
+            for(PtrType j = ptr[i]; j < ptr[i + 1]; ++j)
+            {
+                map[col[j]] = static_cast<int>(j);
+            }
+
+            for(PtrType j = ptr[i]; j < diag[i]; ++j)
+            {
+                int k = col[j];
+
+                lu[j] /= lu[diag[k]];
+
+                for(PtrType l = diag[k] + 1; l < ptr[k + 1]; ++l)
+                {
+                    int pos = map[col[l]];
+
+                    if(pos != -1)
+                    {
+                        lu[pos] -= lu[j] * lu[l];
+                    }
+                }
+            }
+
+            for(PtrType j = ptr[i]; j < ptr[i + 1]; ++j)
+            {
+                map[col[j]] = -1;
+            }
+
+            if(lu[diag[i]] == static_cast<ValueType>(0))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::Solve(const BatchedVector<ValueType>& rhs,
+                                                  BatchedVector<ValueType>*       x)
+    {
+        log_debug(this, "BatchedIterativeSolver::Solve()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+
+        int batch_count = this->op_->GetBatchCount();
+
+        assert(rhs.GetBatchCount() == batch_count);
+        assert(x->GetBatchCount() == batch_count);
+        assert(rhs.GetTotalSize() == this->op_->GetTotalM());
+        assert(x->GetTotalSize() == this->op_->GetTotalM());
+
+        if(this->verb_ > 0)
+        {
+            this->Print();
+            LOG_INFO("BatchedIterativeSolver batch=" << batch_count
+                                                     << "; rows=" << this->op_->GetTotalM()
+                                                     << "; nnz=" << this->op_->GetTotalNnz());
+        }
+
+        for(int i = 0; i < batch_count; ++i)
+        {
+            this->iter_ctrl_[i].Clear();
+            this->iter_ctrl_[i].Verbose(0);
+            this->iter_ctrl_[i].Init(
+                this->abs_tol_, this->rel_tol_, this->div_tol_, this->max_iter_);
+        }
+
+        int64_t work_size = this->WorkspaceSize_(this->op_->GetMaxM());
+
+        _set_omp_backend_threads(*_get_backend_descriptor(), this->op_->GetTotalNnz());
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // Each thread owns its workspace and solves one system at a time
+            ValueType* work = NULL;
+            allocate_host(work_size, &work);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for(int i = 0; i < batch_count; ++i)
+            {
+                this->SolveSystem_(i,
+                                   rhs.vec_ + rhs.offset_[i],
+                                   x->vec_ + x->offset_[i],
+                                   work,
+                                   &this->iter_ctrl_[i]);
+            }
+
+            free_host(&work);
+        }
+
+        if(this->verb_ > 0)
+        {
+            int max_iter = 0;
+
+            for(int i = 0; i < batch_count; ++i)
+            {
+                max_iter = std::max(max_iter, this->iter_ctrl_[i].GetIterationCount());
+            }
+
+            LOG_INFO("BatchedIterativeSolver converged systems = "
+                     << this->GetNumConverged() << " / " << batch_count
+                     << "; max iterations = " << max_iter);
+        }
+
+        log_debug(this, "BatchedIterativeSolver::Solve()", " #*# end");
+    }
+
+    template <typename ValueType>
+    int BatchedIterativeSolver<ValueType>::GetIterationCount(int index) const
+    {
+        assert(index >= 0 && index < static_cast<int>(this->iter_ctrl_.size()));
+
+        return this->iter_ctrl_[index].GetIterationCount();
+    }
+
+    template <typename ValueType>
+    double BatchedIterativeSolver<ValueType>::GetCurrentResidual(int index) const
+    {
+        assert(index >= 0 && index < static_cast<int>(this->iter_ctrl_.size()));
+
+        return this->iter_ctrl_[index].GetCurrentResidual();
+    }
+
+    template <typename ValueType>
+    int BatchedIterativeSolver<ValueType>::GetSolverStatus(int index) const
+    {
+        assert(index >= 0 && index < static_cast<int>(this->iter_ctrl_.size()));
+
+        return this->iter_ctrl_[index].GetSolverStatus();
+    }
+
+    template <typename ValueType>
+    int BatchedIterativeSolver<ValueType>::GetNumConverged(void) const
+    {
+        int num = 0;
+
+        for(size_t i = 0; i < this->iter_ctrl_.size(); ++i)
+        {
+            int status = this->iter_ctrl_[i].GetSolverStatus();
+
+            if(status == 1 || status == 2)
+            {
+                ++num;
+            }
+        }
+
+        return num;
+    }
+
+    template <typename ValueType>
+    int BatchedIterativeSolver<ValueType>::GetSize_(int index) const
+    {
+        return this->op_->GetM(index);
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::Apply_(int              index,
+                                                   const ValueType* in,
+                                                   ValueType*       out) const
+    {
+        const BatchedMatrix<ValueType>* op = this->op_;
+
+        int              n   = op->GetM(index);
+        const PtrType*   ptr = op->row_offset_ + op->row_begin_[index] + index;
+        const int*       col = op->col_ + op->nnz_begin_[index];
+        const ValueType* val = op->val_ + op->nnz_begin_[index];
+
+        for(int i = 0; i < n; ++i)
+        {
+            ValueType sum = static_cast<ValueType>(0);
+
+            for(PtrType j = ptr[i]; j < ptr[i + 1]; ++j)
+            {
+                sum += val[j] * in[col[j]];
+            }
+
+            out[i] = sum;
+        }
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::Precond_(int              index,
+                                                     const ValueType* in,
+                                                     ValueType*       out) const
+    {
+        const BatchedMatrix<ValueType>* op = this->op_;
+
+        int n = op->GetM(index);
+
+        if(this->precond_ == BatchedNone)
+        {
+            copy_h2h(n, in, out);
+        }
+        else if(this->precond_ == BatchedJacobi)
+        {
+            const ValueType* inv_diag = this->prec_val_ + op->row_begin_[index];
+
+            for(int i = 0; i < n; ++i)
+            {
+                out[i] = inv_diag[i] * in[i];
+            }
+        }
+        else
+        {
+            const PtrType*   ptr  = op->row_offset_ + op->row_begin_[index] + index;
+            const int*       col  = op->col_ + op->nnz_begin_[index];
+            const ValueType* lu   = this->prec_val_ + op->nnz_begin_[index];
+            const PtrType*   diag = this->prec_diag_ + op->row_begin_[index];
+
+            // Forward substitution with the unit lower triangular factor
+            for(int i = 0; i < n; ++i)
+            {
+                ValueType sum = in[i];
+
+                for(PtrType j = ptr[i]; j < diag[i]; ++j)
+                {
+                    sum -= lu[j] * out[col[j]];
+                }
+
+                out[i] = sum;
+            }
+
+            // Backward substitution with the upper triangular factor
+            for(int i = n - 1; i >= 0; --i)
+            {
+                ValueType sum = out[i];
+
+                for(PtrType j = diag[i] + 1; j < ptr[i + 1]; ++j)
+                {
+                    sum -= lu[j] * out[col[j]];
+                }
+
+                out[i] = sum / lu[diag[i]];
+            }
+        }
+    }
+
+    template <typename ValueType>
+    ValueType BatchedIterativeSolver<ValueType>::Dot_(int n, const ValueType* x, const ValueType* y)
+    {
+        ValueType sum = static_cast<ValueType>(0);
+
+        for(int i = 0; i < n; ++i)
+        {
+            sum += rocalution_conj(x[i]) * y[i];
+        }
+
+        return sum;
+    }
+
+    template <typename ValueType>
+    double BatchedIterativeSolver<ValueType>::Norm_(int n, const ValueType* x)
+    {
+        return sqrt(std::abs(Dot_(n, x, x)));
+    }
+
+    template <typename ValueType>
+    void BatchedIterativeSolver<ValueType>::Axpy_(int              n,
+                                                  ValueType        alpha,
+                                                  const ValueType* x,
+                                                  ValueType*       y)
+    {
+        for(int i = 0; i < n; ++i)
+        {
+            y[i] += alpha * x[i];
+        }
+    }
+
+    template class BatchedIterativeSolver<double>;
+    template class BatchedIterativeSolver<float>;
+#ifdef SUPPORT_COMPLEX
+    template class BatchedIterativeSolver<std::complex<double>>;
+    template class BatchedIterativeSolver<std::complex<float>>;
+#endif
+
+} // namespace rocalution
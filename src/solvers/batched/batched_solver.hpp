@@ -0,0 +1,210 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_BATCHED_SOLVER_HPP_
+#define ROCALUTION_BATCHED_SOLVER_HPP_
+
+#include "../../base/base_rocalution.hpp"
+#include "../../base/batched_matrix.hpp"
+#include "../../base/batched_vector.hpp"
+#include "../iter_ctrl.hpp"
+#include "rocalution/export.hpp"
+
+#include <vector>
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \brief Preconditioners of the batched solvers
+  * \details
+  * - BatchedNone - no preconditioning
+  * - BatchedJacobi - diagonal scaling
+  * - BatchedILU0 - incomplete LU factorization without fill-in
+  */
+    typedef enum _batched_precond
+    {
+        BatchedNone   = 0,
+        BatchedJacobi = 1,
+        BatchedILU0   = 2
+    } BatchedPrecond;
+
+    /** \ingroup solver_module
+  * \class BatchedIterativeSolver
+  * \brief Base class for all batched iterative solvers
+  * \details
+  * Batched solvers solve the independent systems \f$A_{i}x_{i} = b_{i}\f$ of a
+  * BatchedMatrix. Each system is solved by a single thread with sequential kernels,
+  * while the systems of the batch are distributed dynamically over the OpenMP threads.
+  * This avoids the per-call backend overhead and the idle cores of solving a large
+  * number of small systems one after another with the LocalMatrix solvers.
+  *
+  * Every system has its own iteration control, such that the number of iterations,
+  * the final residual and the convergence status can be queried per system after
+  * Solve(). The status follows IterationControl, i.e. 1 - absolute tolerance reached,
+  * 2 - relative tolerance reached, 3 - divergence, 4 - maximum number of iterations
+  * reached and 0 - breakdown of the method. The residual is measured in the
+  * \f$L_2\f$ norm.
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <typename ValueType>
+    class BatchedIterativeSolver : public RocalutionObj
+    {
+    public:
+        ROCALUTION_EXPORT
+        BatchedIterativeSolver();
+        ROCALUTION_EXPORT
+        virtual ~BatchedIterativeSolver();
+
+        /** \brief Set the batch of operators of the solver */
+        ROCALUTION_EXPORT
+        void SetOperator(const BatchedMatrix<ValueType>& op);
+
+        /** \brief Set the preconditioner, that is applied to every system */
+        ROCALUTION_EXPORT
+        void SetPreconditioner(BatchedPrecond precond);
+
+        /** \brief Initialize the solver with absolute/relative/divergence tolerance and
+      * maximum number of iterations, applied to every system
+      */
+        ROCALUTION_EXPORT
+        void Init(double abs_tol, double rel_tol, double div_tol, int max_iter);
+
+        /** \brief Provide verbose output of the solver
+      * \details
+      * - verb = 0 -> no output
+      * - verb = 1 -> print info about the solver (start, end);
+      */
+        ROCALUTION_EXPORT
+        void Verbose(int verb = 1);
+
+        /** \brief Print information about the solver */
+        virtual void Print(void) const = 0;
+
+        /** \brief Build the solver and the preconditioner of every system */
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+
+        /** \brief Rebuild the preconditioner numerically, after the values of the
+      * operator have changed
+      */
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+
+        /** \brief Clear (free all data) the solver */
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Solve all systems \f$A_{i}x_{i} = b_{i}\f$ of the batch, using
+      * \p x as initial guess
+      */
+        ROCALUTION_EXPORT
+        void Solve(const BatchedVector<ValueType>& rhs, BatchedVector<ValueType>* x);
+
+        /** \brief Return the number of iterations of system \p index */
+        ROCALUTION_EXPORT
+        int GetIterationCount(int index) const;
+
+        /** \brief Return the final residual of system \p index */
+        ROCALUTION_EXPORT
+        double GetCurrentResidual(int index) const;
+
+        /** \brief Return the convergence status of system \p index */
+        ROCALUTION_EXPORT
+        int GetSolverStatus(int index) const;
+
+        /** \brief Return the number of systems that reached the absolute or relative
+      * tolerance
+      */
+        ROCALUTION_EXPORT
+        int GetNumConverged(void) const;
+
+    protected:
+        /** \brief Return the workspace size (in entries) required by a single thread to
+      * solve a system of size \p n
+      */
+        virtual int64_t WorkspaceSize_(int n) const = 0;
+
+        /** \brief Solve the system \p index with the workspace \p work */
+        virtual void SolveSystem_(int               index,
+                                  const ValueType*  rhs,
+                                  ValueType*        x,
+                                  ValueType*        work,
+                                  IterationControl* iter_ctrl) const
+            = 0;
+
+        /** \brief Return the size of system \p index */
+        int GetSize_(int index) const;
+
+        /** \brief out = A_index * in */
+        void Apply_(int index, const ValueType* in, ValueType* out) const;
+
+        /** \brief out = M_index^{-1} * in */
+        void Precond_(int index, const ValueType* in, ValueType* out) const;
+
+        /** \brief Return the dot product x^H y of two vectors of size \p n */
+        static ValueType Dot_(int n, const ValueType* x, const ValueType* y);
+
+        /** \brief Return the euclidean norm of a vector of size \p n */
+        static double Norm_(int n, const ValueType* x);
+
+        /** \brief y = y + alpha * x */
+        static void Axpy_(int n, ValueType alpha, const ValueType* x, ValueType* y);
+
+        /** \brief Factorize the preconditioner of system \p index */
+        bool BuildPrecond_(int index, int* map);
+
+        /** \brief Operators */
+        const BatchedMatrix<ValueType>* op_;
+
+        /** \brief Preconditioner type */
+        BatchedPrecond precond_;
+
+        /** \brief Inverse diagonal (Jacobi) or ILU0 factors of all systems */
+        ValueType* prec_val_;
+        /** \brief Position of the diagonal entries (ILU0) */
+        PtrType* prec_diag_;
+
+        /** \brief Iteration control of every system */
+        std::vector<IterationControl> iter_ctrl_;
+
+        /** \private */
+        double abs_tol_;
+        /** \private */
+        double rel_tol_;
+        /** \private */
+        double div_tol_;
+        /** \private */
+        int max_iter_;
+
+        /** \brief Verbose flag */
+        int verb_;
+
+        /** \brief Solver built flag */
+        bool build_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_BATCHED_SOLVER_HPP_
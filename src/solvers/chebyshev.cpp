@@ -268,7 +268,7 @@ namespace rocalution
         // p = r
         p->CopyFrom(*r);
 
-        alpha = two / d;
+        alpha = static_cast<ValueType>(1) / d;
 
         // x = x + alpha*p
         x->AddScale(*p, alpha);
@@ -278,11 +278,21 @@ namespace rocalution
         r->ScaleAdd(static_cast<ValueType>(-1), rhs);
 
         res = this->Norm_(*r);
+
+        bool first = true;
+
         while(!this->iter_ctrl_.CheckResidual(std::abs(res), this->index_))
         {
+            // The first step uses beta = (c*alpha)^2 / 2, see Gutknecht and Roellin (2002)
             beta = (c * alpha / two) * (c * alpha / two);
 
-            alpha = static_cast<ValueType>(1) / (d - beta);
+            if(first == true)
+            {
+                beta *= two;
+                first = false;
+            }
+
+            alpha = static_cast<ValueType>(1) / (d - beta / alpha);
 
             // p = beta*p + r
             p->ScaleAdd(beta, *r);
@@ -342,7 +352,7 @@ namespace rocalution
         // p = z
         p->CopyFrom(*z);
 
-        alpha = two / d;
+        alpha = static_cast<ValueType>(1) / d;
 
         // x = x + alpha*p
         x->AddScale(*p, alpha);
@@ -352,14 +362,23 @@ namespace rocalution
         r->ScaleAdd(static_cast<ValueType>(-1), rhs);
         res = this->Norm_(*r);
 
+        bool first = true;
+
         while(!this->iter_ctrl_.CheckResidual(std::abs(res), this->index_))
         {
             // Solve Mz=r
             this->precond_->SolveZeroSol(*r, z);
 
+            // The first step uses beta = (c*alpha)^2 / 2, see Gutknecht and Roellin (2002)
             beta = (c * alpha / two) * (c * alpha / two);
 
-            alpha = static_cast<ValueType>(1) / (d - beta);
+            if(first == true)
+            {
+                beta *= two;
+                first = false;
+            }
+
+            alpha = static_cast<ValueType>(1) / (d - beta / alpha);
 
             // p = beta*p + z
             p->ScaleAdd(beta, *z);
@@ -0,0 +1,769 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "block_cg.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+#include "../../base/matrix_formats_ind.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <math.h>
+#include <vector>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    BlockCG<OperatorType, VectorType, ValueType>::BlockCG()
+    {
+        log_debug(this, "BlockCG::BlockCG()", "default constructor");
+
+        this->num_rhs_ = 0;
+
+        this->r_ = NULL;
+        this->z_ = NULL;
+        this->p_ = NULL;
+        this->q_ = NULL;
+        this->w_ = NULL;
+
+        this->PQ_    = NULL;
+        this->QZ_    = NULL;
+        this->alpha_ = NULL;
+        this->G_     = NULL;
+        this->T_     = NULL;
+        this->Rfac_  = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    BlockCG<OperatorType, VectorType, ValueType>::~BlockCG()
+    {
+        log_debug(this, "BlockCG::~BlockCG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockCG solver");
+        }
+        else
+        {
+            LOG_INFO("BlockCG solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockCG (non-precond) linear solver starts, number of right-hand sides = "
+                     << this->num_rhs_);
+        }
+        else
+        {
+            LOG_INFO("BlockCG solver starts, number of right-hand sides = "
+                     << this->num_rhs_ << ", with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockCG (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("BlockCG ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "BlockCG::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() > 0);
+        assert(this->op_->GetM() == this->op_->GetN());
+
+        if(this->res_norm_type_ != 2)
+        {
+            LOG_INFO("BlockCG solver supports only L2 residual norm. The solver is switching to "
+                     "L2 norm");
+            this->res_norm_type_ = 2;
+        }
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+            this->precond_->Build();
+        }
+
+        this->build_ = true;
+
+        // Workspace for a single right-hand side, it is resized by the first block solve
+        this->AllocateBlock_(1);
+
+        log_debug(this, "BlockCG::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "BlockCG::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            this->FreeBlock_();
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "BlockCG::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->num_rhs_; ++i)
+            {
+                this->r_[i]->Zeros();
+                this->p_[i]->Zeros();
+                this->q_[i]->Zeros();
+                this->w_[i]->Zeros();
+
+                if(this->precond_ != NULL)
+                {
+                    this->z_[i]->Zeros();
+                }
+            }
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "BlockCG::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->num_rhs_; ++i)
+            {
+                this->r_[i]->MoveToHost();
+                this->p_[i]->MoveToHost();
+                this->q_[i]->MoveToHost();
+                this->w_[i]->MoveToHost();
+
+                if(this->precond_ != NULL)
+                {
+                    this->z_[i]->MoveToHost();
+                }
+            }
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "BlockCG::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->num_rhs_; ++i)
+            {
+                this->r_[i]->MoveToAccelerator();
+                this->p_[i]->MoveToAccelerator();
+                this->q_[i]->MoveToAccelerator();
+                this->w_[i]->MoveToAccelerator();
+
+                if(this->precond_ != NULL)
+                {
+                    this->z_[i]->MoveToAccelerator();
+                }
+            }
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::AllocateBlock_(int num_rhs)
+    {
+        log_debug(this, "BlockCG::AllocateBlock_()", num_rhs);
+
+        assert(num_rhs > 0);
+        assert(this->build_ == true);
+
+        this->FreeBlock_();
+
+        int k = num_rhs;
+
+        this->r_ = new VectorType*[k];
+        this->p_ = new VectorType*[k];
+        this->q_ = new VectorType*[k];
+        this->w_ = new VectorType*[k];
+
+        for(int i = 0; i < k; ++i)
+        {
+            this->r_[i] = new VectorType;
+            this->p_[i] = new VectorType;
+            this->q_[i] = new VectorType;
+            this->w_[i] = new VectorType;
+
+            this->r_[i]->CloneBackend(*this->op_);
+            this->p_[i]->CloneBackend(*this->op_);
+            this->q_[i]->CloneBackend(*this->op_);
+            this->w_[i]->CloneBackend(*this->op_);
+
+            this->r_[i]->Allocate("r", this->op_->GetM());
+            this->p_[i]->Allocate("p", this->op_->GetM());
+            this->q_[i]->Allocate("q", this->op_->GetM());
+            this->w_[i]->Allocate("w", this->op_->GetM());
+        }
+
+        if(this->precond_ != NULL)
+        {
+            this->z_ = new VectorType*[k];
+
+            for(int i = 0; i < k; ++i)
+            {
+                this->z_[i] = new VectorType;
+                this->z_[i]->CloneBackend(*this->op_);
+                this->z_[i]->Allocate("z", this->op_->GetM());
+            }
+        }
+
+        allocate_host(2 * k * k, &this->PQ_);
+        allocate_host(2 * k * k, &this->QZ_);
+        allocate_host(k * k, &this->alpha_);
+        allocate_host(k * k, &this->G_);
+        allocate_host(k * k, &this->T_);
+        allocate_host(k * k, &this->Rfac_);
+
+        this->num_rhs_ = k;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::FreeBlock_(void)
+    {
+        log_debug(this, "BlockCG::FreeBlock_()", this->num_rhs_);
+
+        if(this->num_rhs_ == 0)
+        {
+            return;
+        }
+
+        for(int i = 0; i < this->num_rhs_; ++i)
+        {
+            delete this->r_[i];
+            delete this->p_[i];
+            delete this->q_[i];
+            delete this->w_[i];
+        }
+
+        delete[] this->r_;
+        delete[] this->p_;
+        delete[] this->q_;
+        delete[] this->w_;
+
+        this->r_ = NULL;
+        this->p_ = NULL;
+        this->q_ = NULL;
+        this->w_ = NULL;
+
+        if(this->z_ != NULL)
+        {
+            for(int i = 0; i < this->num_rhs_; ++i)
+            {
+                delete this->z_[i];
+            }
+
+            delete[] this->z_;
+            this->z_ = NULL;
+        }
+
+        free_host(&this->PQ_);
+        free_host(&this->QZ_);
+        free_host(&this->alpha_);
+        free_host(&this->G_);
+        free_host(&this->T_);
+        free_host(&this->Rfac_);
+
+        this->num_rhs_ = 0;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::Solve(int                      num_rhs,
+                                                             const VectorType* const* rhs,
+                                                             VectorType**             x)
+    {
+        log_debug(this, "BlockCG::Solve()", num_rhs, rhs, x);
+
+        assert(num_rhs > 0);
+        assert(rhs != NULL);
+        assert(x != NULL);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+
+        if(num_rhs != this->num_rhs_)
+        {
+            this->AllocateBlock_(num_rhs);
+        }
+
+        if(this->verb_ > 0)
+        {
+            this->PrintStart_();
+            this->iter_ctrl_.PrintInit();
+        }
+
+        this->SolveBlock_(num_rhs, rhs, x);
+
+        if(this->verb_ > 0)
+        {
+            this->iter_ctrl_.PrintStatus();
+            this->PrintEnd_();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                        VectorType*       x)
+    {
+        log_debug(this, "BlockCG::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ == NULL);
+
+        const VectorType* b = &rhs;
+
+        this->SolveBlock_(1, &b, &x);
+
+        log_debug(this, "BlockCG::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                     VectorType*       x)
+    {
+        log_debug(this, "BlockCG::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ != NULL);
+
+        const VectorType* b = &rhs;
+
+        this->SolveBlock_(1, &b, &x);
+
+        log_debug(this, "BlockCG::SolvePrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::SolveBlock_(int num_rhs,
+                                                                   const VectorType* const* rhs,
+                                                                   VectorType**             x)
+    {
+        assert(num_rhs > 0);
+        assert(rhs != NULL);
+        assert(x != NULL);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(this->res_norm_type_ == 2);
+
+        if(num_rhs != this->num_rhs_)
+        {
+            this->AllocateBlock_(num_rhs);
+        }
+
+        const OperatorType* op = this->op_;
+
+        int k = num_rhs;
+
+        VectorType** r = this->r_;
+        VectorType** z = (this->precond_ != NULL) ? this->z_ : this->r_;
+
+        ValueType* PQ    = this->PQ_;
+        ValueType* QZ    = this->QZ_;
+        ValueType* alpha = this->alpha_;
+
+        // [Q R], the block of vectors that is reduced together with P^H Q
+        std::vector<const VectorType*> qr(2 * k);
+
+        // Initial residual R = B - AX
+        op->MultiApply(k, x, r);
+
+        for(int j = 0; j < k; ++j)
+        {
+            assert(x[j] != NULL);
+            assert(rhs[j] != NULL);
+            assert(x[j] != rhs[j]);
+
+            r[j]->ScaleAdd(static_cast<ValueType>(-1), *rhs[j]);
+        }
+
+        // Initial residual norms, the convergence of each column is measured relative to
+        // its own initial residual
+        VectorType::BlockDot(k, r, k, r, this->G_);
+
+        std::vector<double> res0(k);
+        double              res0_max = 0.0;
+
+        for(int j = 0; j < k; ++j)
+        {
+            res0[j]  = std::sqrt(std::abs(rocalution_double(this->G_[DENSE_IND(j, j, k, k)])));
+            res0_max = std::max(res0_max, res0[j]);
+        }
+
+        if(this->iter_ctrl_.InitResidual(res0_max) == false)
+        {
+            log_debug(this, "BlockCG::SolveBlock_()", " #*# end");
+            return;
+        }
+
+        // Z = M^-1 R
+        if(this->precond_ != NULL)
+        {
+            for(int j = 0; j < k; ++j)
+            {
+                this->precond_->SolveZeroSol(*r[j], z[j]);
+            }
+        }
+
+        // P = orth(Z)
+        for(int j = 0; j < k; ++j)
+        {
+            this->w_[j]->CopyFrom(*z[j]);
+        }
+
+        int s = this->Orthonormalize_(k);
+
+        while(s > 0)
+        {
+            // Q = AP
+            op->MultiApply(s, this->p_, this->q_);
+
+            // [P^H Q, P^H R] with a single reduction
+            for(int i = 0; i < s; ++i)
+            {
+                qr[i] = this->q_[i];
+            }
+
+            for(int j = 0; j < k; ++j)
+            {
+                qr[s + j] = r[j];
+            }
+
+            VectorType::BlockDot(s, this->p_, s + k, qr.data(), PQ);
+
+            // alpha = (P^H Q)^-1 P^H R
+            if(this->CholeskyFactorize_(s, PQ) == false)
+            {
+                LOG_VERBOSE_INFO(2, "*** warning: BlockCG::SolveBlock_() P^H A P is not positive "
+                                    "definite, the operator is not SPD");
+                break;
+            }
+
+            copy_h2h(s * k, PQ + s * s, alpha);
+            this->CholeskySolve_(s, PQ, k, alpha);
+
+            // X = X + P alpha, R = R - Q alpha
+            for(int j = 0; j < k; ++j)
+            {
+                x[j]->MultiAddScale(this->p_, s, alpha + j * s);
+            }
+
+            for(int i = 0; i < s * k; ++i)
+            {
+                alpha[i] = -alpha[i];
+            }
+
+            for(int j = 0; j < k; ++j)
+            {
+                r[j]->MultiAddScale(this->q_, s, alpha + j * s);
+            }
+
+            // Residual norms, and Q^H Z if there is no preconditioner (Z = R)
+            ValueType* RR;
+            int        ld;
+
+            if(this->precond_ == NULL)
+            {
+                VectorType::BlockDot(s + k, qr.data(), k, r, QZ);
+
+                RR = QZ + s;
+                ld = s + k;
+            }
+            else
+            {
+                VectorType::BlockDot(k, r, k, r, this->G_);
+
+                RR = this->G_;
+                ld = k;
+            }
+
+            double res = 0.0;
+
+            for(int j = 0; j < k; ++j)
+            {
+                if(res0[j] > 0.0)
+                {
+                    double res_j = std::sqrt(std::abs(rocalution_double(RR[j + j * ld])));
+
+                    res = std::max(res, res_j * res0_max / res0[j]);
+                }
+            }
+
+            if(this->iter_ctrl_.CheckResidual(res, this->index_))
+            {
+                break;
+            }
+
+            if(this->precond_ != NULL)
+            {
+                // Z = M^-1 R
+                for(int j = 0; j < k; ++j)
+                {
+                    this->precond_->SolveZeroSol(*r[j], z[j]);
+                }
+
+                // Q^H Z
+                VectorType::BlockDot(s, this->q_, k, z, QZ);
+
+                ld = s;
+            }
+            else
+            {
+                // Q^H R is the leading block of [Q R]^H R
+                ld = s + k;
+            }
+
+            // beta = -(P^H Q)^-1 Q^H Z
+            for(int j = 0; j < k; ++j)
+            {
+                for(int i = 0; i < s; ++i)
+                {
+                    alpha[i + j * s] = -QZ[i + j * ld];
+                }
+            }
+
+            this->CholeskySolve_(s, PQ, k, alpha);
+
+            // P = orth(Z + P beta)
+            for(int j = 0; j < k; ++j)
+            {
+                this->w_[j]->CopyFrom(*z[j]);
+                this->w_[j]->MultiAddScale(this->p_, s, alpha + j * s);
+            }
+
+            s = this->Orthonormalize_(k);
+        }
+
+        log_debug(this, "BlockCG::SolveBlock_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    int BlockCG<OperatorType, VectorType, ValueType>::Orthonormalize_(int n)
+    {
+        // Two passes of Cholesky QR, the second pass restores orthogonality that is lost by
+        // the squared condition number of the Gram matrix
+        int r = n;
+
+        for(int pass = 0; pass < 2 && r > 0; ++pass)
+        {
+            VectorType::BlockDot(n, this->w_, n, this->w_, this->G_);
+
+            r = rocalution_gram_orthonormalize(n, this->G_, this->T_, this->Rfac_);
+
+            // P = W T
+            for(int j = 0; j < r; ++j)
+            {
+                this->p_[j]->Zeros();
+                this->p_[j]->MultiAddScale(this->w_, n, this->T_ + j * n);
+            }
+
+            if(pass == 0)
+            {
+                std::swap(this->p_, this->w_);
+                n = r;
+            }
+        }
+
+        return r;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    bool BlockCG<OperatorType, VectorType, ValueType>::CholeskyFactorize_(int n, ValueType* A)
+    {
+        for(int j = 0; j < n; ++j)
+        {
+            ValueType diag = A[DENSE_IND(j, j, n, n)];
+
+            for(int l = 0; l < j; ++l)
+            {
+                diag -= rocalution_conj(A[DENSE_IND(l, j, n, n)]) * A[DENSE_IND(l, j, n, n)];
+            }
+
+            if(std::real(diag) <= static_cast<decltype(std::real(diag))>(0))
+            {
+                return false;
+            }
+
+            A[DENSE_IND(j, j, n, n)] = std::sqrt(std::real(diag));
+
+            for(int i = j + 1; i < n; ++i)
+            {
+                ValueType val = A[DENSE_IND(j, i, n, n)];
+
+                for(int l = 0; l < j; ++l)
+                {
+                    val -= rocalution_conj(A[DENSE_IND(l, j, n, n)]) * A[DENSE_IND(l, i, n, n)];
+                }
+
+                A[DENSE_IND(j, i, n, n)] = val / A[DENSE_IND(j, j, n, n)];
+            }
+        }
+
+        return true;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockCG<OperatorType, VectorType, ValueType>::CholeskySolve_(int              n,
+                                                                      const ValueType* R,
+                                                                      int              nrhs,
+                                                                      ValueType*       b)
+    {
+        for(int c = 0; c < nrhs; ++c)
+        {
+            ValueType* bc = b + c * n;
+
+            // Forward substitution R^H y = b
+            for(int i = 0; i < n; ++i)
+            {
+                for(int l = 0; l < i; ++l)
+                {
+                    bc[i] -= rocalution_conj(R[DENSE_IND(l, i, n, n)]) * bc[l];
+                }
+
+                bc[i] /= R[DENSE_IND(i, i, n, n)];
+            }
+
+            // Backward substitution R x = y
+            for(int i = n - 1; i >= 0; --i)
+            {
+                for(int l = i + 1; l < n; ++l)
+                {
+                    bc[i] -= R[DENSE_IND(i, l, n, n)] * bc[l];
+                }
+
+                bc[i] /= R[DENSE_IND(i, i, n, n)];
+            }
+        }
+    }
+
+    template class BlockCG<LocalMatrix<double>, LocalVector<double>, double>;
+    template class BlockCG<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class BlockCG<LocalMatrix<std::complex<double>>,
+                           LocalVector<std::complex<double>>,
+                           std::complex<double>>;
+    template class BlockCG<LocalMatrix<std::complex<float>>,
+                           LocalVector<std::complex<float>>,
+                           std::complex<float>>;
+#endif
+
+    template class BlockCG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class BlockCG<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class BlockCG<GlobalMatrix<std::complex<double>>,
+                           GlobalVector<std::complex<double>>,
+                           std::complex<double>>;
+    template class BlockCG<GlobalMatrix<std::complex<float>>,
+                           GlobalVector<std::complex<float>>,
+                           std::complex<float>>;
+#endif
+
+    template class BlockCG<LocalStencil<double>, LocalVector<double>, double>;
+    template class BlockCG<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class BlockCG<LocalStencil<std::complex<double>>,
+                           LocalVector<std::complex<double>>,
+                           std::complex<double>>;
+    template class BlockCG<LocalStencil<std::complex<float>>,
+                           LocalVector<std::complex<float>>,
+                           std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,142 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_BLOCK_CG_HPP_
+#define ROCALUTION_KRYLOV_BLOCK_CG_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class BlockCG
+  * \brief Breakdown-free Block Conjugate Gradient Method
+  * \details
+  * The Block Conjugate Gradient method solves sparse symmetric positive definite (SPD)
+  * linear systems \f$AX=B\f$ with multiple right-hand sides \f$B = [b_{0}, \dots,
+  * b_{k-1}]\f$ simultaneously. All \f$k\f$ systems share a single block Krylov subspace,
+  * which usually reduces the number of iterations compared to \f$k\f$ independent CG
+  * solves. Each iteration applies the operator to all search directions at once
+  * (MultiApply(), a sparse matrix times dense block product) and gathers the dot
+  * products into small dense \f$k \times k\f$ blocks that require a single global
+  * reduction each (BlockDot()).
+  * \cite Ji2017
+  *
+  * The block of search directions is orthonormalized in every iteration with a rank
+  * revealing Cholesky QR. Directions that became linearly dependent, e.g. because a
+  * system has converged or right-hand sides are (nearly) identical, are removed from the
+  * block, so the method does not break down. Convergence is reached once all systems
+  * satisfy the stopping criterion, the residual reported to the iteration control is the
+  * maximum of the column residuals, scaled by their initial residuals.
+  *
+  * The block of right-hand sides is passed to Solve(int, const VectorType* const*,
+  * VectorType**). Solve() with a single right-hand side performs the same iteration
+  * with a block size of one.
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class BlockCG : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        BlockCG();
+        ROCALUTION_EXPORT
+        virtual ~BlockCG();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        using IterativeLinearSolver<OperatorType, VectorType, ValueType>::Solve;
+
+        /** \brief Solve the linear system for \p num_rhs right-hand sides at once
+      * \details
+      * Solves \f$Ax_{j} = rhs_{j}\f$ for \f$j = 0, \dots, num\_rhs-1\f$, using the vectors
+      * \p x as initial guesses.
+      *
+      * @param[in]
+      * num_rhs number of right-hand sides
+      * @param[in]
+      * rhs     array of \p num_rhs right-hand side vectors
+      * @param[inout]
+      * x       array of \p num_rhs solution vectors
+      */
+        ROCALUTION_EXPORT
+        void Solve(int num_rhs, const VectorType* const* rhs, VectorType** x);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        // Block iteration, shared by the preconditioned and non-preconditioned solver
+        void SolveBlock_(int num_rhs, const VectorType* const* rhs, VectorType** x);
+        // (Re)allocate the workspace for num_rhs right-hand sides
+        void AllocateBlock_(int num_rhs);
+        // Free the workspace
+        void FreeBlock_(void);
+        // Orthonormalize the n vectors w_ into p_, returns the rank
+        int Orthonormalize_(int n);
+
+        // Cholesky factorization A = R^H R of a Hermitian positive definite matrix
+        static bool CholeskyFactorize_(int n, ValueType* A);
+        // Solve R^H R x = b with upper triangular R for nrhs columns of b
+        static void CholeskySolve_(int n, const ValueType* R, int nrhs, ValueType* b);
+
+        // Number of right-hand sides the workspace is allocated for
+        int num_rhs_;
+
+        VectorType** r_;
+        VectorType** z_;
+        VectorType** p_;
+        VectorType** q_;
+        VectorType** w_;
+
+        ValueType* PQ_;
+        ValueType* QZ_;
+        ValueType* alpha_;
+        ValueType* G_;
+        ValueType* T_;
+        ValueType* Rfac_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_BLOCK_CG_HPP_
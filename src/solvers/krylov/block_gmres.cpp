@@ -0,0 +1,894 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "block_gmres.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+#include "../../base/matrix_formats_ind.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <math.h>
+#include <vector>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    BlockGMRES<OperatorType, VectorType, ValueType>::BlockGMRES()
+    {
+        log_debug(this, "BlockGMRES::BlockGMRES()", "default constructor");
+
+        this->size_basis_ = 30;
+
+        this->num_rhs_   = 0;
+        this->num_steps_ = 0;
+
+        this->v_ = NULL;
+        this->z_ = NULL;
+        this->w_ = NULL;
+        this->t_ = NULL;
+
+        this->H_       = NULL;
+        this->G_       = NULL;
+        this->h_       = NULL;
+        this->S_       = NULL;
+        this->S1_      = NULL;
+        this->T_       = NULL;
+        this->Gram_    = NULL;
+        this->c_rot_   = NULL;
+        this->s_rot_   = NULL;
+        this->num_rot_ = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    BlockGMRES<OperatorType, VectorType, ValueType>::~BlockGMRES()
+    {
+        log_debug(this, "BlockGMRES::~BlockGMRES()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockGMRES solver");
+        }
+        else
+        {
+            LOG_INFO("BlockGMRES solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockGMRES(" << this->size_basis_
+                                   << ") (non-precond) linear solver starts, number of "
+                                      "right-hand sides = "
+                                   << this->num_rhs_);
+        }
+        else
+        {
+            LOG_INFO("BlockGMRES(" << this->size_basis_
+                                   << ") solver starts, number of right-hand sides = "
+                                   << this->num_rhs_ << ", with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("BlockGMRES(" << this->size_basis_ << ") (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("BlockGMRES(" << this->size_basis_ << ") ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "BlockGMRES::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() > 0);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->size_basis_ > 0);
+
+        if(this->res_norm_type_ != 2)
+        {
+            LOG_INFO("BlockGMRES solver supports only L2 residual norm. The solver is switching "
+                     "to L2 norm");
+            this->res_norm_type_ = 2;
+        }
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+            this->precond_->Build();
+        }
+
+        this->build_ = true;
+
+        // Workspace for a single right-hand side, it is resized by the first block solve
+        this->AllocateBlock_(1);
+
+        log_debug(this, "BlockGMRES::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "BlockGMRES::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            this->FreeBlock_();
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "BlockGMRES::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            int k = this->num_rhs_;
+            int m = this->num_steps_;
+
+            for(int i = 0; i < (m + 1) * k; ++i)
+            {
+                this->v_[i]->Zeros();
+            }
+
+            for(int i = 0; i < k; ++i)
+            {
+                this->w_[i]->Zeros();
+                this->t_[i]->Zeros();
+            }
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < m * k; ++i)
+                {
+                    this->z_[i]->Zeros();
+                }
+
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "BlockGMRES::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            int k = this->num_rhs_;
+            int m = this->num_steps_;
+
+            for(int i = 0; i < (m + 1) * k; ++i)
+            {
+                this->v_[i]->MoveToHost();
+            }
+
+            for(int i = 0; i < k; ++i)
+            {
+                this->w_[i]->MoveToHost();
+                this->t_[i]->MoveToHost();
+            }
+
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < m * k; ++i)
+                {
+                    this->z_[i]->MoveToHost();
+                }
+
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "BlockGMRES::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            int k = this->num_rhs_;
+            int m = this->num_steps_;
+
+            for(int i = 0; i < (m + 1) * k; ++i)
+            {
+                this->v_[i]->MoveToAccelerator();
+            }
+
+            for(int i = 0; i < k; ++i)
+            {
+                this->w_[i]->MoveToAccelerator();
+                this->t_[i]->MoveToAccelerator();
+            }
+
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < m * k; ++i)
+                {
+                    this->z_[i]->MoveToAccelerator();
+                }
+
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::SetBasisSize(int size_basis)
+    {
+        log_debug(this, "BlockGMRES::SetBasisSize()", size_basis);
+
+        assert(size_basis > 0);
+        assert(this->build_ == false);
+
+        this->size_basis_ = size_basis;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::AllocateBlock_(int num_rhs)
+    {
+        log_debug(this, "BlockGMRES::AllocateBlock_()", num_rhs);
+
+        assert(num_rhs > 0);
+        assert(this->build_ == true);
+
+        this->FreeBlock_();
+
+        int k = num_rhs;
+        int m = std::max(this->size_basis_ / k, 1);
+
+        this->v_ = new VectorType*[(m + 1) * k];
+
+        for(int i = 0; i < (m + 1) * k; ++i)
+        {
+            this->v_[i] = new VectorType;
+            this->v_[i]->CloneBackend(*this->op_);
+            this->v_[i]->Allocate("v", this->op_->GetM());
+        }
+
+        this->w_ = new VectorType*[k];
+        this->t_ = new VectorType*[k];
+
+        for(int i = 0; i < k; ++i)
+        {
+            this->w_[i] = new VectorType;
+            this->t_[i] = new VectorType;
+
+            this->w_[i]->CloneBackend(*this->op_);
+            this->t_[i]->CloneBackend(*this->op_);
+
+            this->w_[i]->Allocate("w", this->op_->GetM());
+            this->t_[i]->Allocate("t", this->op_->GetM());
+        }
+
+        if(this->precond_ != NULL)
+        {
+            this->z_ = new VectorType*[m * k];
+
+            for(int i = 0; i < m * k; ++i)
+            {
+                this->z_[i] = new VectorType;
+                this->z_[i]->CloneBackend(*this->op_);
+                this->z_[i]->Allocate("z", this->op_->GetM());
+            }
+        }
+
+        int ldh = (m + 1) * k;
+
+        allocate_host(ldh * m * k, &this->H_);
+        allocate_host(ldh * k, &this->G_);
+        allocate_host(ldh * k, &this->h_);
+        allocate_host(k * k, &this->S_);
+        allocate_host(k * k, &this->S1_);
+        allocate_host(k * k, &this->T_);
+        allocate_host(k * k, &this->Gram_);
+        allocate_host(m * k * 2 * k, &this->c_rot_);
+        allocate_host(m * k * 2 * k, &this->s_rot_);
+        allocate_host(m * k, &this->num_rot_);
+
+        this->num_rhs_   = k;
+        this->num_steps_ = m;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::FreeBlock_(void)
+    {
+        log_debug(this, "BlockGMRES::FreeBlock_()", this->num_rhs_);
+
+        if(this->num_rhs_ == 0)
+        {
+            return;
+        }
+
+        int k = this->num_rhs_;
+        int m = this->num_steps_;
+
+        for(int i = 0; i < (m + 1) * k; ++i)
+        {
+            delete this->v_[i];
+        }
+
+        for(int i = 0; i < k; ++i)
+        {
+            delete this->w_[i];
+            delete this->t_[i];
+        }
+
+        delete[] this->v_;
+        delete[] this->w_;
+        delete[] this->t_;
+
+        this->v_ = NULL;
+        this->w_ = NULL;
+        this->t_ = NULL;
+
+        if(this->z_ != NULL)
+        {
+            for(int i = 0; i < m * k; ++i)
+            {
+                delete this->z_[i];
+            }
+
+            delete[] this->z_;
+            this->z_ = NULL;
+        }
+
+        free_host(&this->H_);
+        free_host(&this->G_);
+        free_host(&this->h_);
+        free_host(&this->S_);
+        free_host(&this->S1_);
+        free_host(&this->T_);
+        free_host(&this->Gram_);
+        free_host(&this->c_rot_);
+        free_host(&this->s_rot_);
+        free_host(&this->num_rot_);
+
+        this->num_rhs_   = 0;
+        this->num_steps_ = 0;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::Solve(int                      num_rhs,
+                                                                const VectorType* const* rhs,
+                                                                VectorType**             x)
+    {
+        log_debug(this, "BlockGMRES::Solve()", num_rhs, rhs, x);
+
+        assert(num_rhs > 0);
+        assert(rhs != NULL);
+        assert(x != NULL);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+
+        if(num_rhs != this->num_rhs_)
+        {
+            this->AllocateBlock_(num_rhs);
+        }
+
+        if(this->verb_ > 0)
+        {
+            this->PrintStart_();
+            this->iter_ctrl_.PrintInit();
+        }
+
+        this->SolveBlock_(num_rhs, rhs, x);
+
+        if(this->verb_ > 0)
+        {
+            this->iter_ctrl_.PrintStatus();
+            this->PrintEnd_();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                           VectorType*       x)
+    {
+        log_debug(this, "BlockGMRES::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ == NULL);
+
+        const VectorType* b = &rhs;
+
+        this->SolveBlock_(1, &b, &x);
+
+        log_debug(this, "BlockGMRES::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                        VectorType*       x)
+    {
+        log_debug(this, "BlockGMRES::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ != NULL);
+
+        const VectorType* b = &rhs;
+
+        this->SolveBlock_(1, &b, &x);
+
+        log_debug(this, "BlockGMRES::SolvePrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::SolveBlock_(
+        int num_rhs, const VectorType* const* rhs, VectorType** x)
+    {
+        assert(num_rhs > 0);
+        assert(rhs != NULL);
+        assert(x != NULL);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(this->res_norm_type_ == 2);
+
+        if(num_rhs != this->num_rhs_)
+        {
+            this->AllocateBlock_(num_rhs);
+        }
+
+        const OperatorType* op = this->op_;
+
+        int k   = num_rhs;
+        int m   = this->num_steps_;
+        int ldh = (m + 1) * k;
+        int nch = m * k;
+
+        VectorType** v     = this->v_;
+        VectorType** w     = this->w_;
+        VectorType** basis = (this->precond_ != NULL) ? this->z_ : this->v_;
+
+        ValueType* H = this->H_;
+        ValueType* G = this->G_;
+        ValueType* h = this->h_;
+        ValueType* S = this->S_;
+
+        std::vector<double> res0(k);
+        std::vector<double> diag(k);
+
+        // Initial residual R = B - AX
+        op->MultiApply(k, x, w);
+
+        for(int l = 0; l < k; ++l)
+        {
+            assert(x[l] != NULL);
+            assert(rhs[l] != NULL);
+            assert(x[l] != rhs[l]);
+
+            w[l]->ScaleAdd(static_cast<ValueType>(-1), *rhs[l]);
+        }
+
+        // R = V_0 S, the initial residual norms are obtained from the same reduction
+        int s = this->Orthonormalize_(k, w, v, S, diag.data());
+
+        // The convergence of each column is measured relative to its own initial residual
+        double res0_max = 0.0;
+
+        for(int l = 0; l < k; ++l)
+        {
+            res0[l]  = std::sqrt(diag[l]);
+            res0_max = std::max(res0_max, res0[l]);
+        }
+
+        if(this->iter_ctrl_.InitResidual(res0_max) == false)
+        {
+            log_debug(this, "BlockGMRES::SolveBlock_()", " #*# end");
+            return;
+        }
+
+        while(s > 0)
+        {
+            // G = [S; 0]
+            set_to_zero_host(ldh * k, G);
+
+            for(int l = 0; l < k; ++l)
+            {
+                for(int i = 0; i < s; ++i)
+                {
+                    G[DENSE_IND(i, l, ldh, k)] = S[DENSE_IND(i, l, s, k)];
+                }
+            }
+
+            // Number of columns of H and number of basis vectors
+            int nc = 0;
+            int nv = s;
+
+            // Width of the current block
+            int sj = s;
+
+            bool converged = false;
+
+            // Block Arnoldi iteration
+            for(int j = 0; j < m && sj > 0; ++j)
+            {
+                // Index of the first vector of block j
+                int cj = nc;
+
+                // Z_j = M^-1 V_j
+                if(this->precond_ != NULL)
+                {
+                    for(int c = 0; c < sj; ++c)
+                    {
+                        this->precond_->SolveZeroSol(*v[cj + c], basis[cj + c]);
+                    }
+                }
+
+                // W = A Z_j
+                op->MultiApply(sj, basis + cj, w);
+
+                for(int c = 0; c < sj; ++c)
+                {
+                    set_to_zero_host(ldh, H + DENSE_IND(0, cj + c, ldh, nch));
+                }
+
+                // Block classical Gram-Schmidt with reorthogonalization, H(0:nv, cj:cj+sj)
+                for(int pass = 0; pass < 2; ++pass)
+                {
+                    VectorType::BlockDot(nv, v, sj, w, h);
+
+                    for(int c = 0; c < sj; ++c)
+                    {
+                        for(int i = 0; i < nv; ++i)
+                        {
+                            H[DENSE_IND(i, cj + c, ldh, nch)] += h[DENSE_IND(i, c, nv, sj)];
+                            h[DENSE_IND(i, c, nv, sj)] = -h[DENSE_IND(i, c, nv, sj)];
+                        }
+
+                        w[c]->MultiAddScale(v, nv, h + c * nv);
+                    }
+                }
+
+                // W = V_j+1 S, H(nv:nv+snew, cj:cj+sj) = S
+                int snew = this->Orthonormalize_(sj, w, v + nv, S, NULL);
+
+                for(int c = 0; c < sj; ++c)
+                {
+                    for(int i = 0; i < snew; ++i)
+                    {
+                        H[DENSE_IND(nv + i, cj + c, ldh, nch)] = S[DENSE_IND(i, c, snew, sj)];
+                    }
+                }
+
+                int nr = nv + snew;
+
+                // Reduce the new columns to upper triangular form
+                for(int c = cj; c < cj + sj; ++c)
+                {
+                    // Apply the rotations of the previous columns
+                    for(int cp = 0; cp < c; ++cp)
+                    {
+                        for(int r = 0; r < this->num_rot_[cp]; ++r)
+                        {
+                            this->ApplyGivensRotation_(this->c_rot_[cp * 2 * k + r],
+                                                       this->s_rot_[cp * 2 * k + r],
+                                                       H[DENSE_IND(cp, c, ldh, nch)],
+                                                       H[DENSE_IND(cp + 1 + r, c, ldh, nch)]);
+                        }
+                    }
+
+                    // Eliminate H(c+1:nr, c) and apply the rotations to G
+                    this->num_rot_[c] = nr - 1 - c;
+
+                    for(int r = 0; r < this->num_rot_[c]; ++r)
+                    {
+                        ValueType& cr = this->c_rot_[c * 2 * k + r];
+                        ValueType& sr = this->s_rot_[c * 2 * k + r];
+
+                        this->GenerateGivensRotation_(H[DENSE_IND(c, c, ldh, nch)],
+                                                      H[DENSE_IND(c + 1 + r, c, ldh, nch)],
+                                                      cr,
+                                                      sr);
+
+                        this->ApplyGivensRotation_(cr,
+                                                   sr,
+                                                   H[DENSE_IND(c, c, ldh, nch)],
+                                                   H[DENSE_IND(c + 1 + r, c, ldh, nch)]);
+
+                        for(int l = 0; l < k; ++l)
+                        {
+                            this->ApplyGivensRotation_(cr,
+                                                       sr,
+                                                       G[DENSE_IND(c, l, ldh, k)],
+                                                       G[DENSE_IND(c + 1 + r, l, ldh, k)]);
+                        }
+                    }
+                }
+
+                nc = cj + sj;
+                nv = nr;
+                sj = snew;
+
+                // The residual norm of column l is the norm of G(nc:nr, l)
+                double res = 0.0;
+
+                for(int l = 0; l < k; ++l)
+                {
+                    if(res0[l] > 0.0)
+                    {
+                        double res_l = 0.0;
+
+                        for(int i = nc; i < nr; ++i)
+                        {
+                            res_l += std::norm(rocalution_double(G[DENSE_IND(i, l, ldh, k)]));
+                        }
+
+                        res = std::max(res, std::sqrt(res_l) * res0_max / res0[l]);
+                    }
+                }
+
+                if(this->iter_ctrl_.CheckResidual(res, this->index_))
+                {
+                    converged = true;
+                    break;
+                }
+            }
+
+            // Solve upper triangular system H(0:nc, 0:nc) Y = G(0:nc, :)
+            for(int l = 0; l < k; ++l)
+            {
+                ValueType* y = G + l * ldh;
+
+                for(int i = nc - 1; i >= 0; --i)
+                {
+                    y[i] /= H[DENSE_IND(i, i, ldh, nch)];
+
+                    for(int p = 0; p < i; ++p)
+                    {
+                        y[p] -= H[DENSE_IND(p, i, ldh, nch)] * y[i];
+                    }
+                }
+
+                // Update solution
+                x[l]->MultiAddScale(basis, nc, y);
+            }
+
+            if(converged == true)
+            {
+                break;
+            }
+
+            // Compute residual R = B - AX
+            op->MultiApply(k, x, w);
+
+            for(int l = 0; l < k; ++l)
+            {
+                w[l]->ScaleAdd(static_cast<ValueType>(-1), *rhs[l]);
+            }
+
+            s = this->Orthonormalize_(k, w, v, S, diag.data());
+
+            double res = 0.0;
+
+            for(int l = 0; l < k; ++l)
+            {
+                if(res0[l] > 0.0)
+                {
+                    res = std::max(res, std::sqrt(diag[l]) * res0_max / res0[l]);
+                }
+            }
+
+            // Check convergence
+            if(this->iter_ctrl_.CheckResidualNoCount(res))
+            {
+                break;
+            }
+        }
+
+        log_debug(this, "BlockGMRES::SolveBlock_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    int BlockGMRES<OperatorType, VectorType, ValueType>::Orthonormalize_(
+        int n, VectorType** w, VectorType** q, ValueType* S, double* diag)
+    {
+        // First pass of Cholesky QR, W = T_ S1
+        VectorType::BlockDot(n, w, n, w, this->Gram_);
+
+        if(diag != NULL)
+        {
+            for(int i = 0; i < n; ++i)
+            {
+                diag[i] = std::abs(rocalution_double(this->Gram_[DENSE_IND(i, i, n, n)]));
+            }
+        }
+
+        int r1 = rocalution_gram_orthonormalize(n, this->Gram_, this->T_, this->S1_);
+
+        for(int j = 0; j < r1; ++j)
+        {
+            this->t_[j]->Zeros();
+            this->t_[j]->MultiAddScale(w, n, this->T_ + j * n);
+        }
+
+        if(r1 == 0)
+        {
+            return 0;
+        }
+
+        // Second pass restores the orthogonality that is lost by the squared condition
+        // number of the Gram matrix, T_ = Q S2
+        std::vector<ValueType> S2(r1 * r1);
+
+        VectorType::BlockDot(r1, this->t_, r1, this->t_, this->Gram_);
+
+        int r2 = rocalution_gram_orthonormalize(r1, this->Gram_, this->T_, S2.data());
+
+        for(int j = 0; j < r2; ++j)
+        {
+            q[j]->Zeros();
+            q[j]->MultiAddScale(this->t_, r1, this->T_ + j * r1);
+        }
+
+        // S = S2 S1
+        for(int l = 0; l < n; ++l)
+        {
+            for(int i = 0; i < r2; ++i)
+            {
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(int p = 0; p < r1; ++p)
+                {
+                    sum += S2[DENSE_IND(i, p, r2, r1)] * this->S1_[DENSE_IND(p, l, r1, n)];
+                }
+
+                S[DENSE_IND(i, l, r2, n)] = sum;
+            }
+        }
+
+        return r2;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::GenerateGivensRotation_(ValueType  dx,
+                                                                                  ValueType  dy,
+                                                                                  ValueType& c,
+                                                                                  ValueType& s)
+    {
+        ValueType zero = static_cast<ValueType>(0);
+        ValueType one  = static_cast<ValueType>(1);
+
+        if(dy == zero)
+        {
+            c = one;
+            s = zero;
+        }
+        else if(dx == zero)
+        {
+            c = zero;
+            s = one;
+        }
+        else if(std::abs(dy) > std::abs(dx))
+        {
+            ValueType tmp = dx / dy;
+            s             = one / sqrt(one + tmp * tmp);
+            c             = tmp * s;
+        }
+        else
+        {
+            ValueType tmp = dy / dx;
+            c             = one / sqrt(one + tmp * tmp);
+            s             = tmp * c;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockGMRES<OperatorType, VectorType, ValueType>::ApplyGivensRotation_(ValueType  c,
+                                                                               ValueType  s,
+                                                                               ValueType& dx,
+                                                                               ValueType& dy)
+    {
+        ValueType temp = dx;
+        dx             = rocalution_conj(c) * dx + rocalution_conj(s) * dy;
+        dy             = -s * temp + c * dy;
+    }
+
+    template class BlockGMRES<LocalMatrix<double>, LocalVector<double>, double>;
+    template class BlockGMRES<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class BlockGMRES<LocalMatrix<std::complex<double>>,
+                              LocalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class BlockGMRES<LocalMatrix<std::complex<float>>,
+                              LocalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+    template class BlockGMRES<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class BlockGMRES<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class BlockGMRES<GlobalMatrix<std::complex<double>>,
+                              GlobalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class BlockGMRES<GlobalMatrix<std::complex<float>>,
+                              GlobalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+    template class BlockGMRES<LocalStencil<double>, LocalVector<double>, double>;
+    template class BlockGMRES<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class BlockGMRES<LocalStencil<std::complex<double>>,
+                              LocalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class BlockGMRES<LocalStencil<std::complex<float>>,
+                              LocalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+} // namespace rocalution
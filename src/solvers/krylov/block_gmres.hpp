@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_BLOCK_GMRES_HPP_
+#define ROCALUTION_KRYLOV_BLOCK_GMRES_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class BlockGMRES
+  * \brief Block Generalized Minimum Residual Method
+  * \details
+  * The Block Generalized Minimum Residual method solves sparse (non) symmetric linear
+  * systems \f$AX=B\f$ with multiple right-hand sides \f$B = [b_{0}, \dots, b_{k-1}]\f$
+  * simultaneously. A block Arnoldi process builds a single Krylov subspace from all
+  * \f$k\f$ residuals, and each solution is approximated with minimal residual in this
+  * subspace. Each block step applies the operator to all \f$k\f$ basis vectors of the
+  * current block at once (MultiApply(), a sparse matrix times dense block product) and
+  * orthogonalizes them with block classical Gram-Schmidt with reorthogonalization, where
+  * all dot products of a pass are obtained with a single reduction (BlockDot()).
+  * \cite SAAD
+  *
+  * Each new block is orthonormalized with a rank revealing Cholesky QR. Directions that
+  * became linearly dependent, e.g. because right-hand sides are (nearly) identical or
+  * part of the Krylov subspace became invariant, are removed from the block. The
+  * preconditioner is applied from the right. The size of the Krylov subspace basis,
+  * i.e. the total number of basis vectors of a restart cycle, can be set using
+  * SetBasisSize(); each cycle performs (basis size) / \f$k\f$ block steps, at least one.
+  * The default size of the Krylov subspace basis is 30. Convergence is reached once all
+  * systems satisfy the stopping criterion, the residual reported to the iteration
+  * control is the maximum of the column residuals, scaled by their initial residuals.
+  *
+  * The block of right-hand sides is passed to Solve(int, const VectorType* const*,
+  * VectorType**). Solve() with a single right-hand side performs restarted GMRES.
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class BlockGMRES : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        BlockGMRES();
+        ROCALUTION_EXPORT
+        virtual ~BlockGMRES();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Set the size of the Krylov subspace basis */
+        ROCALUTION_EXPORT
+        virtual void SetBasisSize(int size_basis);
+
+        using IterativeLinearSolver<OperatorType, VectorType, ValueType>::Solve;
+
+        /** \brief Solve the linear system for \p num_rhs right-hand sides at once
+      * \details
+      * Solves \f$Ax_{j} = rhs_{j}\f$ for \f$j = 0, \dots, num\_rhs-1\f$, using the vectors
+      * \p x as initial guesses.
+      *
+      * @param[in]
+      * num_rhs number of right-hand sides
+      * @param[in]
+      * rhs     array of \p num_rhs right-hand side vectors
+      * @param[inout]
+      * x       array of \p num_rhs solution vectors
+      */
+        ROCALUTION_EXPORT
+        void Solve(int num_rhs, const VectorType* const* rhs, VectorType** x);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+        /** \brief Generate Givens rotation */
+        static void GenerateGivensRotation_(ValueType dx, ValueType dy, ValueType& c, ValueType& s);
+        /** \brief Apply Givens rotation */
+        static void ApplyGivensRotation_(ValueType c, ValueType s, ValueType& dx, ValueType& dy);
+
+    private:
+        // Block Arnoldi restart cycles, shared by the preconditioned and non-preconditioned
+        // solver
+        void SolveBlock_(int num_rhs, const VectorType* const* rhs, VectorType** x);
+        // (Re)allocate the workspace for num_rhs right-hand sides
+        void AllocateBlock_(int num_rhs);
+        // Free the workspace
+        void FreeBlock_(void);
+        // Orthonormalize the n vectors w into q, such that W = QS, returns the rank. If
+        // diag is not NULL, it receives the squared norms of the vectors w.
+        int Orthonormalize_(int n, VectorType** w, VectorType** q, ValueType* S, double* diag);
+
+        int size_basis_;
+
+        // Number of right-hand sides the workspace is allocated for
+        int num_rhs_;
+        // Number of block steps per restart cycle
+        int num_steps_;
+
+        // Block Arnoldi basis V, preconditioned basis Z and temporary blocks
+        VectorType** v_;
+        VectorType** z_;
+        VectorType** w_;
+        VectorType** t_;
+
+        ValueType* H_;
+        ValueType* G_;
+        ValueType* h_;
+        ValueType* S_;
+        ValueType* S1_;
+        ValueType* T_;
+        ValueType* Gram_;
+        ValueType* c_rot_;
+        ValueType* s_rot_;
+
+        // Number of Givens rotations that eliminate the subdiagonal entries of a column
+        int* num_rot_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_BLOCK_GMRES_HPP_
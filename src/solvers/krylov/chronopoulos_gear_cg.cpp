@@ -0,0 +1,541 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "chronopoulos_gear_cg.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <complex>
+#include <math.h>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    ChronopoulosGearCG<OperatorType, VectorType, ValueType>::ChronopoulosGearCG()
+    {
+        log_debug(this, "ChronopoulosGearCG::ChronopoulosGearCG()", "default constructor");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    ChronopoulosGearCG<OperatorType, VectorType, ValueType>::~ChronopoulosGearCG()
+    {
+        log_debug(this, "ChronopoulosGearCG::~ChronopoulosGearCG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("ChronopoulosGearCG solver");
+        }
+        else
+        {
+            LOG_INFO("ChronopoulosGearCG solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("ChronopoulosGearCG (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("ChronopoulosGearCG solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("ChronopoulosGearCG (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("ChronopoulosGearCG ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "ChronopoulosGearCG::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+
+            this->precond_->Build();
+
+            this->u_.CloneBackend(*this->op_);
+            this->u_.Allocate("u", this->op_->GetM());
+        }
+
+        this->r_.CloneBackend(*this->op_);
+        this->r_.Allocate("r", this->op_->GetM());
+
+        this->w_.CloneBackend(*this->op_);
+        this->w_.Allocate("w", this->op_->GetM());
+
+        this->p_.CloneBackend(*this->op_);
+        this->p_.Allocate("p", this->op_->GetM());
+
+        this->s_.CloneBackend(*this->op_);
+        this->s_.Allocate("s", this->op_->GetM());
+
+        log_debug(this, "ChronopoulosGearCG::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::BuildMoveToAcceleratorAsync(void)
+    {
+        log_debug(this,
+                  "ChronopoulosGearCG::BuildMoveToAcceleratorAsync()",
+                  this->build_,
+                  " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+
+            this->precond_->BuildMoveToAcceleratorAsync();
+
+            this->u_.CloneBackend(*this->op_);
+            this->u_.Allocate("u", this->op_->GetM());
+            this->u_.MoveToAcceleratorAsync();
+        }
+
+        this->r_.CloneBackend(*this->op_);
+        this->r_.Allocate("r", this->op_->GetM());
+        this->r_.MoveToAcceleratorAsync();
+
+        this->w_.CloneBackend(*this->op_);
+        this->w_.Allocate("w", this->op_->GetM());
+        this->w_.MoveToAcceleratorAsync();
+
+        this->p_.CloneBackend(*this->op_);
+        this->p_.Allocate("p", this->op_->GetM());
+        this->p_.MoveToAcceleratorAsync();
+
+        this->s_.CloneBackend(*this->op_);
+        this->s_.Allocate("s", this->op_->GetM());
+        this->s_.MoveToAcceleratorAsync();
+
+        log_debug(this,
+                  "ChronopoulosGearCG::BuildMoveToAcceleratorAsync()",
+                  this->build_,
+                  " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::Sync(void)
+    {
+        log_debug(this, "ChronopoulosGearCG::Sync()", this->build_, " #*# begin");
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->Sync();
+            this->u_.Sync();
+        }
+
+        this->r_.Sync();
+        this->w_.Sync();
+        this->p_.Sync();
+        this->s_.Sync();
+
+        log_debug(this, "ChronopoulosGearCG::Sync()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "ChronopoulosGearCG::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            this->r_.Clear();
+            this->u_.Clear();
+            this->w_.Clear();
+            this->p_.Clear();
+            this->s_.Clear();
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "ChronopoulosGearCG::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.Zeros();
+            this->u_.Zeros();
+            this->w_.Zeros();
+            this->p_.Zeros();
+            this->s_.Zeros();
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "ChronopoulosGearCG::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToHost();
+            this->w_.MoveToHost();
+            this->p_.MoveToHost();
+            this->s_.MoveToHost();
+
+            if(this->precond_ != NULL)
+            {
+                this->u_.MoveToHost();
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "ChronopoulosGearCG::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToAccelerator();
+            this->w_.MoveToAccelerator();
+            this->p_.MoveToAccelerator();
+            this->s_.MoveToAccelerator();
+
+            if(this->precond_ != NULL)
+            {
+                this->u_.MoveToAccelerator();
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::SolveNonPrecond_(
+        const VectorType& rhs, VectorType* x)
+    {
+        log_debug(
+            this, "ChronopoulosGearCG::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ == NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r = &this->r_;
+        VectorType* w = &this->w_;
+        VectorType* p = &this->p_;
+        VectorType* s = &this->s_;
+
+        ValueType alpha, beta;
+        ValueType gamma, gamma_old;
+        ValueType delta;
+        ValueType rr;
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // Initial residual norm |b-Ax0|
+        ValueType res_norm = this->Norm_(*r);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "ChronopoulosGearCG::SolveNonPrecond_()", " #*# end");
+            return;
+        }
+
+        // w = Ar
+        op->Apply(*r, w);
+
+        // gamma = (r,r) and delta = (w,r) in a single reduction phase
+        r->DotNonConjAsync(*r, &gamma);
+        r->DotNonConjAsync(*w, &delta);
+        r->DotSync();
+
+        alpha = gamma / delta;
+
+        // p = r, s = w
+        p->CopyFrom(*r);
+        s->CopyFrom(*w);
+
+        while(true)
+        {
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
+            // r = r - alpha*s
+            r->AddScale(*s, -alpha);
+
+            // w = Ar
+            op->Apply(*r, w);
+
+            // gamma = (r,r), delta = (w,r) and, for the L2 norm, (r,r) in a single
+            // reduction phase
+            gamma_old = gamma;
+
+            r->DotNonConjAsync(*r, &gamma);
+            r->DotNonConjAsync(*w, &delta);
+
+            if(this->res_norm_type_ == 2)
+            {
+                r->DotAsync(*r, &rr);
+            }
+
+            r->DotSync();
+
+            // Check convergence
+            res_norm = (this->res_norm_type_ == 2) ? std::sqrt(rr) : this->Norm_(*r);
+
+            if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+            {
+                break;
+            }
+
+            beta  = gamma / gamma_old;
+            alpha = gamma / (delta - beta * gamma / alpha);
+
+            // p = r + beta*p
+            p->ScaleAdd(beta, *r);
+
+            // s = w + beta*s
+            s->ScaleAdd(beta, *w);
+        }
+
+        log_debug(this, "ChronopoulosGearCG::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ChronopoulosGearCG<OperatorType, VectorType, ValueType>::SolvePrecond_(
+        const VectorType& rhs, VectorType* x)
+    {
+        log_debug(this, "ChronopoulosGearCG::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ != NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r = &this->r_;
+        VectorType* u = &this->u_;
+        VectorType* w = &this->w_;
+        VectorType* p = &this->p_;
+        VectorType* s = &this->s_;
+
+        ValueType alpha, beta;
+        ValueType gamma, gamma_old;
+        ValueType delta;
+        ValueType rr;
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // Initial residual norm |b-Ax0|
+        ValueType res_norm = this->Norm_(*r);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "ChronopoulosGearCG::SolvePrecond_()", " #*# end");
+            return;
+        }
+
+        // Solve Mu=r
+        this->precond_->SolveZeroSol(*r, u);
+
+        // w = Au
+        op->Apply(*u, w);
+
+        // gamma = (r,u) and delta = (w,u) in a single reduction phase
+        u->DotNonConjAsync(*r, &gamma);
+        u->DotNonConjAsync(*w, &delta);
+        u->DotSync();
+
+        alpha = gamma / delta;
+
+        // p = u, s = w
+        p->CopyFrom(*u);
+        s->CopyFrom(*w);
+
+        while(true)
+        {
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
+            // r = r - alpha*s
+            r->AddScale(*s, -alpha);
+
+            // Solve Mu=r
+            this->precond_->SolveZeroSol(*r, u);
+
+            // w = Au
+            op->Apply(*u, w);
+
+            // gamma = (r,u), delta = (w,u) and, for the L2 norm, (r,r) in a single
+            // reduction phase
+            gamma_old = gamma;
+
+            u->DotNonConjAsync(*r, &gamma);
+            u->DotNonConjAsync(*w, &delta);
+
+            if(this->res_norm_type_ == 2)
+            {
+                u->DotAsync(*r, &rr);
+            }
+
+            u->DotSync();
+
+            // Check convergence
+            res_norm = (this->res_norm_type_ == 2) ? std::sqrt(rr) : this->Norm_(*r);
+
+            if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+            {
+                break;
+            }
+
+            beta  = gamma / gamma_old;
+            alpha = gamma / (delta - beta * gamma / alpha);
+
+            // p = u + beta*p
+            p->ScaleAdd(beta, *u);
+
+            // s = w + beta*s
+            s->ScaleAdd(beta, *w);
+        }
+
+        log_debug(this, "ChronopoulosGearCG::SolvePrecond_()", " #*# end");
+    }
+
+    template class ChronopoulosGearCG<LocalMatrix<double>, LocalVector<double>, double>;
+    template class ChronopoulosGearCG<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class ChronopoulosGearCG<LocalMatrix<std::complex<double>>,
+                                      LocalVector<std::complex<double>>,
+                                      std::complex<double>>;
+    template class ChronopoulosGearCG<LocalMatrix<std::complex<float>>,
+                                      LocalVector<std::complex<float>>,
+                                      std::complex<float>>;
+#endif
+
+    template class ChronopoulosGearCG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class ChronopoulosGearCG<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class ChronopoulosGearCG<GlobalMatrix<std::complex<double>>,
+                                      GlobalVector<std::complex<double>>,
+                                      std::complex<double>>;
+    template class ChronopoulosGearCG<GlobalMatrix<std::complex<float>>,
+                                      GlobalVector<std::complex<float>>,
+                                      std::complex<float>>;
+#endif
+
+    template class ChronopoulosGearCG<LocalStencil<double>, LocalVector<double>, double>;
+    template class ChronopoulosGearCG<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class ChronopoulosGearCG<LocalStencil<std::complex<double>>,
+                                      LocalVector<std::complex<double>>,
+                                      std::complex<double>>;
+    template class ChronopoulosGearCG<LocalStencil<std::complex<float>>,
+                                      LocalVector<std::complex<float>>,
+                                      std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_CHRONOPOULOS_GEAR_CG_HPP_
+#define ROCALUTION_KRYLOV_CHRONOPOULOS_GEAR_CG_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class ChronopoulosGearCG
+  * \brief Chronopoulos-Gear Conjugate Gradient Method
+  * \details
+  * The Chronopoulos-Gear Conjugate Gradient method is a mathematically equivalent
+  * reformulation of the (preconditioned) Conjugate Gradient method for solving sparse
+  * symmetric positive definite (SPD) linear systems \f$Ax=b\f$. By carrying the
+  * additional recurrence \f$s = Ap\f$, both dot products of an iteration (and the
+  * residual norm) are computed in a single reduction phase, which halves the number of
+  * global synchronizations per iteration compared to the classical CG method. In contrast
+  * to PipelinedCG, the reductions are not overlapped with the sparse matrix-vector
+  * product, which results in shorter recurrences, less memory and better attainable
+  * accuracy.
+  * \cite Chronopoulos1989
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class ChronopoulosGearCG : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        ChronopoulosGearCG();
+        ROCALUTION_EXPORT
+        virtual ~ChronopoulosGearCG();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+
+        ROCALUTION_EXPORT
+        virtual void BuildMoveToAcceleratorAsync(void);
+        ROCALUTION_EXPORT
+        virtual void Sync(void);
+
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        VectorType r_, u_, w_;
+        VectorType p_, s_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_CHRONOPOULOS_GEAR_CG_HPP_
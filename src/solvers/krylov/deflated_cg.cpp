@@ -0,0 +1,907 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "deflated_cg.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+#include "../../base/matrix_formats_ind.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <math.h>
+#include <vector>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    DeflatedCG<OperatorType, VectorType, ValueType>::DeflatedCG()
+    {
+        log_debug(this, "DeflatedCG::DeflatedCG()", "default constructor");
+
+        this->size_defl_    = 8;
+        this->size_harvest_ = 24;
+
+        this->num_defl_     = 0;
+        this->rebuild_defl_ = false;
+
+        this->w_      = NULL;
+        this->aw_     = NULL;
+        this->w_buf_  = NULL;
+        this->aw_buf_ = NULL;
+        this->hp_     = NULL;
+        this->hq_     = NULL;
+
+        this->E_    = NULL;
+        this->mu_   = NULL;
+        this->ritz_ = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    DeflatedCG<OperatorType, VectorType, ValueType>::~DeflatedCG()
+    {
+        log_debug(this, "DeflatedCG::~DeflatedCG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("DeflatedCG solver");
+        }
+        else
+        {
+            LOG_INFO("DeflatedCG solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("DeflatedCG (non-precond) linear solver starts, deflation subspace size = "
+                     << this->num_defl_);
+        }
+        else
+        {
+            LOG_INFO("DeflatedCG solver starts, deflation subspace size = "
+                     << this->num_defl_ << ", with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("DeflatedCG (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("DeflatedCG ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::SetDeflationSize(int size)
+    {
+        log_debug(this, "DeflatedCG::SetDeflationSize()", size);
+
+        assert(size >= 0);
+        assert(this->build_ == false);
+
+        this->size_defl_ = size;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::SetHarvestSize(int size)
+    {
+        log_debug(this, "DeflatedCG::SetHarvestSize()", size);
+
+        assert(size >= 0);
+        assert(this->build_ == false);
+
+        this->size_harvest_ = size;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    int DeflatedCG<OperatorType, VectorType, ValueType>::GetDeflationSize(void) const
+    {
+        return this->num_defl_;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::ClearDeflationSpace(void)
+    {
+        log_debug(this, "DeflatedCG::ClearDeflationSpace()");
+
+        this->num_defl_     = 0;
+        this->rebuild_defl_ = false;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "DeflatedCG::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+        assert(this->size_defl_ == 0 || this->size_harvest_ > this->size_defl_);
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+
+            this->precond_->Build();
+
+            this->z_.CloneBackend(*this->op_);
+            this->z_.Allocate("z", this->op_->GetM());
+        }
+
+        this->r_.CloneBackend(*this->op_);
+        this->r_.Allocate("r", this->op_->GetM());
+
+        this->p_.CloneBackend(*this->op_);
+        this->p_.Allocate("p", this->op_->GetM());
+
+        this->q_.CloneBackend(*this->op_);
+        this->q_.Allocate("q", this->op_->GetM());
+
+        this->w_      = new VectorType*[this->size_defl_];
+        this->aw_     = new VectorType*[this->size_defl_];
+        this->w_buf_  = new VectorType*[this->size_defl_];
+        this->aw_buf_ = new VectorType*[this->size_defl_];
+
+        for(int i = 0; i < this->size_defl_; ++i)
+        {
+            this->w_[i]      = new VectorType;
+            this->aw_[i]     = new VectorType;
+            this->w_buf_[i]  = new VectorType;
+            this->aw_buf_[i] = new VectorType;
+
+            this->w_[i]->CloneBackend(*this->op_);
+            this->aw_[i]->CloneBackend(*this->op_);
+            this->w_buf_[i]->CloneBackend(*this->op_);
+            this->aw_buf_[i]->CloneBackend(*this->op_);
+
+            this->w_[i]->Allocate("w", this->op_->GetM());
+            this->aw_[i]->Allocate("aw", this->op_->GetM());
+            this->w_buf_[i]->Allocate("w", this->op_->GetM());
+            this->aw_buf_[i]->Allocate("aw", this->op_->GetM());
+        }
+
+        this->hp_ = new VectorType*[this->size_harvest_];
+        this->hq_ = new VectorType*[this->size_harvest_];
+
+        for(int i = 0; i < this->size_harvest_; ++i)
+        {
+            this->hp_[i] = new VectorType;
+            this->hq_[i] = new VectorType;
+
+            this->hp_[i]->CloneBackend(*this->op_);
+            this->hq_[i]->CloneBackend(*this->op_);
+
+            this->hp_[i]->Allocate("hp", this->op_->GetM());
+            this->hq_[i]->Allocate("hq", this->op_->GetM());
+        }
+
+        allocate_host(this->size_defl_ * this->size_defl_, &this->E_);
+        allocate_host(2 * this->size_defl_ + 1, &this->mu_);
+        allocate_host(this->size_defl_, &this->ritz_);
+
+        this->num_defl_     = 0;
+        this->rebuild_defl_ = false;
+
+        log_debug(this, "DeflatedCG::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "DeflatedCG::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            this->r_.Clear();
+            this->z_.Clear();
+            this->p_.Clear();
+            this->q_.Clear();
+
+            for(int i = 0; i < this->size_defl_; ++i)
+            {
+                delete this->w_[i];
+                delete this->aw_[i];
+                delete this->w_buf_[i];
+                delete this->aw_buf_[i];
+            }
+
+            delete[] this->w_;
+            delete[] this->aw_;
+            delete[] this->w_buf_;
+            delete[] this->aw_buf_;
+
+            this->w_      = NULL;
+            this->aw_     = NULL;
+            this->w_buf_  = NULL;
+            this->aw_buf_ = NULL;
+
+            for(int i = 0; i < this->size_harvest_; ++i)
+            {
+                delete this->hp_[i];
+                delete this->hq_[i];
+            }
+
+            delete[] this->hp_;
+            delete[] this->hq_;
+
+            this->hp_ = NULL;
+            this->hq_ = NULL;
+
+            free_host(&this->E_);
+            free_host(&this->mu_);
+            free_host(&this->ritz_);
+
+            this->num_defl_     = 0;
+            this->rebuild_defl_ = false;
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "DeflatedCG::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.Zeros();
+            this->z_.Zeros();
+            this->p_.Zeros();
+            this->q_.Zeros();
+
+            // Keep the deflation subspace, AW and E are recomputed in the next solve
+            this->rebuild_defl_ = (this->num_defl_ > 0);
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "DeflatedCG::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToHost();
+            this->p_.MoveToHost();
+            this->q_.MoveToHost();
+
+            for(int i = 0; i < this->size_defl_; ++i)
+            {
+                this->w_[i]->MoveToHost();
+                this->aw_[i]->MoveToHost();
+                this->w_buf_[i]->MoveToHost();
+                this->aw_buf_[i]->MoveToHost();
+            }
+
+            for(int i = 0; i < this->size_harvest_; ++i)
+            {
+                this->hp_[i]->MoveToHost();
+                this->hq_[i]->MoveToHost();
+            }
+
+            if(this->precond_ != NULL)
+            {
+                this->z_.MoveToHost();
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "DeflatedCG::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToAccelerator();
+            this->p_.MoveToAccelerator();
+            this->q_.MoveToAccelerator();
+
+            for(int i = 0; i < this->size_defl_; ++i)
+            {
+                this->w_[i]->MoveToAccelerator();
+                this->aw_[i]->MoveToAccelerator();
+                this->w_buf_[i]->MoveToAccelerator();
+                this->aw_buf_[i]->MoveToAccelerator();
+            }
+
+            for(int i = 0; i < this->size_harvest_; ++i)
+            {
+                this->hp_[i]->MoveToAccelerator();
+                this->hq_[i]->MoveToAccelerator();
+            }
+
+            if(this->precond_ != NULL)
+            {
+                this->z_.MoveToAccelerator();
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::BuildDeflationOperator_(void)
+    {
+        log_debug(this, "DeflatedCG::BuildDeflationOperator_()", this->num_defl_);
+
+        int k = this->num_defl_;
+
+        ValueType* E = this->E_;
+
+        // AW = A W
+        for(int j = 0; j < k; ++j)
+        {
+            this->op_->Apply(*this->w_[j], this->aw_[j]);
+        }
+
+        // E = W^H AW
+        for(int j = 0; j < k; ++j)
+        {
+            this->aw_[j]->MultiDot(this->w_, k, &E[DENSE_IND(0, j, k, k)]);
+        }
+
+        // Cholesky factorization E = LL^H, L is stored in the lower triangular part of E
+        for(int j = 0; j < k; ++j)
+        {
+            double ljj = rocalution_double(E[DENSE_IND(j, j, k, k)]);
+
+            for(int i = 0; i < j; ++i)
+            {
+                ljj -= std::norm(E[DENSE_IND(j, i, k, k)]);
+            }
+
+            if(!(ljj > 0.0))
+            {
+                LOG_INFO("DeflatedCG deflation operator is not positive definite, discarding "
+                         "deflation subspace");
+
+                this->num_defl_ = 0;
+
+                return;
+            }
+
+            E[DENSE_IND(j, j, k, k)] = static_cast<ValueType>(sqrt(ljj));
+
+            for(int i = j + 1; i < k; ++i)
+            {
+                ValueType lij = E[DENSE_IND(i, j, k, k)];
+
+                for(int l = 0; l < j; ++l)
+                {
+                    lij -= E[DENSE_IND(i, l, k, k)] * rocalution_conj(E[DENSE_IND(j, l, k, k)]);
+                }
+
+                E[DENSE_IND(i, j, k, k)] = lij / E[DENSE_IND(j, j, k, k)];
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::SolveDeflationOperator_(
+        ValueType* mu) const
+    {
+        int k = this->num_defl_;
+
+        const ValueType* L = this->E_;
+
+        // Solve Ly = mu
+        for(int i = 0; i < k; ++i)
+        {
+            for(int j = 0; j < i; ++j)
+            {
+                mu[i] -= L[DENSE_IND(i, j, k, k)] * mu[j];
+            }
+
+            mu[i] /= L[DENSE_IND(i, i, k, k)];
+        }
+
+        // Solve L^H mu = y
+        for(int i = k - 1; i >= 0; --i)
+        {
+            for(int j = i + 1; j < k; ++j)
+            {
+                mu[i] -= rocalution_conj(L[DENSE_IND(j, i, k, k)]) * mu[j];
+            }
+
+            mu[i] /= L[DENSE_IND(i, i, k, k)];
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    int DeflatedCG<OperatorType, VectorType, ValueType>::RayleighRitz_(int          n,
+                                                                      int          num_known,
+                                                                      VectorType** z,
+                                                                      VectorType** az,
+                                                                      VectorType** ritz,
+                                                                      VectorType** aritz,
+                                                                      ValueType*   lambda)
+    {
+        log_debug(this, "DeflatedCG::RayleighRitz_()", n, num_known);
+
+        std::vector<const VectorType*> zaz(2 * n);
+
+        for(int j = 0; j < n; ++j)
+        {
+            zaz[j]     = z[j];
+            zaz[n + j] = az[j];
+        }
+
+        ValueType* G  = NULL;
+        ValueType* F  = NULL;
+        ValueType* Y  = NULL;
+        ValueType* wk = NULL;
+
+        allocate_host(n * n, &G);
+        allocate_host(n * n, &F);
+        allocate_host(n * n, &Y);
+        allocate_host(2 * n, &wk);
+
+        // The leading Ritz vectors satisfy Z^H Z = I and Z^H AZ = diag(lambda)
+        for(int j = 0; j < num_known; ++j)
+        {
+            for(int i = 0; i < num_known; ++i)
+            {
+                F[DENSE_IND(i, j, n, n)] = static_cast<ValueType>(i == j ? 1 : 0);
+                G[DENSE_IND(i, j, n, n)] = (i == j) ? lambda[j] : static_cast<ValueType>(0);
+            }
+        }
+
+        // F = Z^H Z, G = Z^H AZ, a single reduction per column, [Z AZ]^H z_j
+        for(int j = num_known; j < n; ++j)
+        {
+            z[j]->MultiDot(zaz.data(), 2 * n, wk);
+
+            for(int i = 0; i < n; ++i)
+            {
+                F[DENSE_IND(i, j, n, n)] = wk[i];
+                G[DENSE_IND(i, j, n, n)] = rocalution_conj(wk[n + i]);
+            }
+
+            for(int i = 0; i < num_known; ++i)
+            {
+                F[DENSE_IND(j, i, n, n)] = rocalution_conj(wk[i]);
+                G[DENSE_IND(j, i, n, n)] = wk[n + i];
+            }
+        }
+
+        int num_ritz = -1;
+
+        // G y = lambda F y
+        if(rocalution_hermitian_eigen(n, G, F, wk, Y) == true)
+        {
+            // Keep the Ritz vectors of the smallest (positive) Ritz values
+            num_ritz = 0;
+
+            while(num_ritz < std::min(this->size_defl_, n)
+                  && rocalution_double(wk[num_ritz]) > 0.0)
+            {
+                lambda[num_ritz] = wk[num_ritz];
+                ++num_ritz;
+            }
+
+            // Ritz vectors ZY and AZY
+            for(int j = 0; j < num_ritz; ++j)
+            {
+                ritz[j]->Zeros();
+                ritz[j]->MultiAddScale(z, n, &Y[DENSE_IND(0, j, n, n)]);
+
+                aritz[j]->Zeros();
+                aritz[j]->MultiAddScale(az, n, &Y[DENSE_IND(0, j, n, n)]);
+            }
+        }
+
+        free_host(&G);
+        free_host(&F);
+        free_host(&Y);
+        free_host(&wk);
+
+        return num_ritz;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::UpdateDeflationSpace_(int num_harvest)
+    {
+        log_debug(this, "DeflatedCG::UpdateDeflationSpace_()", this->num_defl_, num_harvest);
+
+        int k = this->num_defl_;
+        int n = k + num_harvest;
+
+        if(num_harvest == 0 || this->size_defl_ == 0)
+        {
+            return;
+        }
+
+        // Z = [W P], AZ = [AW AP], where P holds the Ritz vectors and search directions
+        // collected during the solve
+        std::vector<VectorType*> Z(n);
+        std::vector<VectorType*> AZ(n);
+        std::vector<ValueType>   lambda(this->size_defl_);
+
+        for(int j = 0; j < k; ++j)
+        {
+            Z[j]  = this->w_[j];
+            AZ[j] = this->aw_[j];
+        }
+
+        for(int j = 0; j < num_harvest; ++j)
+        {
+            Z[k + j]  = this->hp_[j];
+            AZ[k + j] = this->hq_[j];
+        }
+
+        int num_defl = this->RayleighRitz_(n, 0, Z.data(), AZ.data(), this->w_buf_, this->aw_buf_,
+                                           lambda.data());
+
+        if(num_defl < 0)
+        {
+            LOG_VERBOSE_INFO(2,
+                             "DeflatedCG: Rayleigh-Ritz procedure failed, keeping the current "
+                             "deflation subspace");
+
+            return;
+        }
+
+        std::swap(this->w_, this->w_buf_);
+        std::swap(this->aw_, this->aw_buf_);
+
+        // The Ritz vectors are orthonormal, hence E = W^H AW = diag(lambda)
+        set_to_zero_host(num_defl * num_defl, this->E_);
+
+        for(int j = 0; j < num_defl; ++j)
+        {
+            this->E_[DENSE_IND(j, j, num_defl, num_defl)]
+                = static_cast<ValueType>(sqrt(rocalution_double(lambda[j])));
+        }
+
+        this->num_defl_ = num_defl;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    ValueType DeflatedCG<OperatorType, VectorType, ValueType>::DeflationCorrection_(
+        const VectorType& r, const VectorType& z, const VectorType* const* rz, int num_dots)
+    {
+        int k = this->num_defl_;
+
+        ValueType* mu = this->mu_ + 1;
+        ValueType* nu = this->mu_ + k + 1;
+
+        // rho = <r,z>, mu = AW^H z
+        z.MultiDot(rz, num_dots, this->mu_);
+
+        if(k > 0)
+        {
+            // nu = W^H r, vanishes in exact arithmetic. Keeping it removes the components of r
+            // in W that build up by round-off and could otherwise not be reduced by CG
+            if(num_dots == k + 1)
+            {
+                r.MultiDot(this->w_, k, nu);
+            }
+
+            // mu = E^-1 (W^H r - AW^H z)
+            for(int j = 0; j < k; ++j)
+            {
+                mu[j] = nu[j] - mu[j];
+            }
+
+            this->SolveDeflationOperator_(mu);
+        }
+
+        return this->mu_[0];
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                           VectorType*       x)
+    {
+        log_debug(this, "DeflatedCG::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ == NULL);
+
+        this->SolveDeflated_(rhs, x);
+
+        log_debug(this, "DeflatedCG::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                        VectorType*       x)
+    {
+        log_debug(this, "DeflatedCG::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ != NULL);
+
+        this->SolveDeflated_(rhs, x);
+
+        log_debug(this, "DeflatedCG::SolvePrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void DeflatedCG<OperatorType, VectorType, ValueType>::SolveDeflated_(const VectorType& rhs,
+                                                                         VectorType*       x)
+    {
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r = &this->r_;
+        VectorType* z = (this->precond_ != NULL) ? &this->z_ : &this->r_;
+        VectorType* p = &this->p_;
+        VectorType* q = &this->q_;
+
+        ValueType* mu = this->mu_ + 1;
+
+        ValueType alpha, beta;
+        ValueType rho, rho_old;
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // Initial residual norm |b-Ax0|
+        ValueType res_norm = this->Norm_(*r);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            return;
+        }
+
+        // The operator has changed, recompute AW and E
+        if(this->rebuild_defl_ == true)
+        {
+            this->BuildDeflationOperator_();
+            this->rebuild_defl_ = false;
+        }
+
+        int k = this->num_defl_;
+
+        if(k > 0)
+        {
+            // Galerkin projection of the initial guess, mu = E^-1 W^H r
+            r->MultiDot(this->w_, k, mu);
+            this->SolveDeflationOperator_(mu);
+
+            // x = x + W mu, r = r - AW mu
+            x->MultiAddScale(this->w_, k, mu);
+
+            for(int j = 0; j < k; ++j)
+            {
+                mu[j] = -mu[j];
+            }
+
+            r->MultiAddScale(this->aw_, k, mu);
+
+            res_norm = this->Norm_(*r);
+
+            if(this->iter_ctrl_.CheckResidualNoCount(std::abs(res_norm)))
+            {
+                return;
+            }
+        }
+
+        // <r,z>, AW^H z and, without preconditioner, W^H r are computed in a single reduction
+        int num_dots = (this->precond_ != NULL) ? k + 1 : 2 * k + 1;
+
+        std::vector<const VectorType*> rz(num_dots);
+
+        rz[0] = r;
+
+        for(int j = 0; j < num_dots - 1; ++j)
+        {
+            rz[j + 1] = (j < k) ? this->aw_[j] : this->w_[j - k];
+        }
+
+        // Solve Mz = r
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SolveZeroSol(*r, z);
+        }
+
+        // rho = <r,z>, mu = E^-1 (W^H r - AW^H z)
+        rho = this->DeflationCorrection_(*r, *z, rz.data(), num_dots);
+
+        // p = z + W mu
+        p->CopyFrom(*z);
+
+        if(k > 0)
+        {
+            p->MultiAddScale(this->w_, k, mu);
+        }
+
+        // Search space for the eigenvector approximation, the leading num_ritz vectors are
+        // Ritz vectors of previous windows, followed by the latest search directions
+        int num_harvest = 0;
+        int num_ritz    = 0;
+
+        while(true)
+        {
+            // Collect the search direction p and q = Ap
+            if(this->size_defl_ > 0)
+            {
+                this->hp_[num_harvest]->CopyFrom(*p);
+                q = this->hq_[num_harvest];
+
+                ++num_harvest;
+            }
+
+            // q = Ap
+            op->Apply(*p, q);
+
+            // alpha = rho / <p,q>
+            alpha = rho / p->Dot(*q);
+
+            // x = x + alpha * p
+            x->AddScale(*p, alpha);
+
+            // r = r - alpha * q
+            r->AddScale(*q, -alpha);
+
+            // Compress a full search space to its smallest Ritz pairs (thick restart), such
+            // that the eigenvector approximation improves over the entire solve
+            if(num_harvest == this->size_harvest_)
+            {
+                num_ritz = this->RayleighRitz_(num_harvest,
+                                               num_ritz,
+                                               this->hp_,
+                                               this->hq_,
+                                               this->w_buf_,
+                                               this->aw_buf_,
+                                               this->ritz_);
+
+                num_ritz = std::max(num_ritz, 0);
+
+                for(int j = 0; j < num_ritz; ++j)
+                {
+                    std::swap(this->hp_[j], this->w_buf_[j]);
+                    std::swap(this->hq_[j], this->aw_buf_[j]);
+                }
+
+                num_harvest = num_ritz;
+            }
+            // Check convergence
+            res_norm = this->Norm_(*r);
+
+            if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+            {
+                break;
+            }
+
+            // Solve Mz = r
+            if(this->precond_ != NULL)
+            {
+                this->precond_->SolveZeroSol(*r, z);
+            }
+
+            // rho = <r,z>, mu = E^-1 (W^H r - AW^H z)
+            rho_old = rho;
+            rho     = this->DeflationCorrection_(*r, *z, rz.data(), num_dots);
+
+            beta = rho / rho_old;
+
+            // p = z + beta * p + W mu
+            p->ScaleAdd(beta, *z);
+
+            if(k > 0)
+            {
+                p->MultiAddScale(this->w_, k, mu);
+            }
+        }
+
+        // Refine the deflation subspace for the next solve
+        this->UpdateDeflationSpace_(num_harvest);
+    }
+
+    template class DeflatedCG<LocalMatrix<double>, LocalVector<double>, double>;
+    template class DeflatedCG<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class DeflatedCG<LocalMatrix<std::complex<double>>,
+                              LocalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class DeflatedCG<LocalMatrix<std::complex<float>>,
+                              LocalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+    template class DeflatedCG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class DeflatedCG<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class DeflatedCG<GlobalMatrix<std::complex<double>>,
+                              GlobalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class DeflatedCG<GlobalMatrix<std::complex<float>>,
+                              GlobalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+    template class DeflatedCG<LocalStencil<double>, LocalVector<double>, double>;
+    template class DeflatedCG<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class DeflatedCG<LocalStencil<std::complex<double>>,
+                              LocalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class DeflatedCG<LocalStencil<std::complex<float>>,
+                              LocalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_DEFLATED_CG_HPP_
+#define ROCALUTION_KRYLOV_DEFLATED_CG_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class DeflatedCG
+  * \brief Deflated Conjugate Gradient Method
+  * \details
+  * The deflated Conjugate Gradient method is a variant of the (preconditioned) CG method
+  * for solving sequences of sparse symmetric (Hermitian) positive definite linear systems
+  * \f$Ax=b\f$. A small subspace \f$\mathcal{W}\f$, spanned by approximate eigenvectors of
+  * \f$A\f$ that belong to its smallest eigenvalues, is kept inside the solver object
+  * between successive calls to Solve(). The initial guess is corrected by a Galerkin
+  * projection onto \f$\mathcal{W}\f$ and the search directions are kept \f$A\f$-orthogonal
+  * to \f$\mathcal{W}\f$, which removes the corresponding eigenvalues from the spectrum seen
+  * by CG. During the solve, the search directions are collected in a small search space
+  * that is compressed to its smallest Ritz pairs whenever it is full. After each solve,
+  * \f$\mathcal{W}\f$ is refined by a Rayleigh-Ritz procedure on \f$\mathcal{W}\f$ and
+  * this search space.
+  * \cite Saad2000
+  *
+  * The maximum dimension of the deflation subspace can be set using SetDeflationSize()
+  * and the dimension of the search space using SetHarvestSize(), which has to be larger
+  * than the deflation subspace. The defaults are 8 and 24. The subspace is kept, when the
+  * operator values change and ReBuildNumeric() is called, and is discarded by Clear() or
+  * ClearDeflationSpace().
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class DeflatedCG : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        DeflatedCG();
+        ROCALUTION_EXPORT
+        virtual ~DeflatedCG();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Set the maximum dimension of the deflation subspace */
+        ROCALUTION_EXPORT
+        void SetDeflationSize(int size);
+        /** \brief Set the dimension of the search space for the eigenvector approximation */
+        ROCALUTION_EXPORT
+        void SetHarvestSize(int size);
+        /** \brief Return the current dimension of the deflation subspace */
+        ROCALUTION_EXPORT
+        int GetDeflationSize(void) const;
+        /** \brief Discard the deflation subspace */
+        ROCALUTION_EXPORT
+        void ClearDeflationSpace(void);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        /** \brief Deflated (preconditioned) CG iteration */
+        void SolveDeflated_(const VectorType& rhs, VectorType* x);
+        /** \brief Compute AW and the Cholesky factor of E = W^H AW */
+        void BuildDeflationOperator_(void);
+        /** \brief Rayleigh-Ritz procedure on Z, returns the number of Ritz pairs or -1 */
+        int RayleighRitz_(int          n,
+                          int          num_known,
+                          VectorType** z,
+                          VectorType** az,
+                          VectorType** ritz,
+                          VectorType** aritz,
+                          ValueType*   lambda);
+        /** \brief Rayleigh-Ritz update of the deflation subspace */
+        void UpdateDeflationSpace_(int num_harvest);
+        /** \brief Compute <r,z> and the deflation coefficients E^-1 (W^H r - AW^H z) */
+        ValueType DeflationCorrection_(const VectorType&        r,
+                                       const VectorType&        z,
+                                       const VectorType* const* rz,
+                                       int                      num_dots);
+        /** \brief Solve E mu = mu using the Cholesky factor of E */
+        void SolveDeflationOperator_(ValueType* mu) const;
+
+        int size_defl_;
+        int size_harvest_;
+
+        // Current dimension of the deflation subspace
+        int num_defl_;
+
+        // AW and E have to be recomputed, e.g. after the operator has changed
+        bool rebuild_defl_;
+
+        VectorType r_, z_;
+        VectorType p_, q_;
+
+        // Deflation subspace W, AW and buffers for the subspace update
+        VectorType** w_;
+        VectorType** aw_;
+        VectorType** w_buf_;
+        VectorType** aw_buf_;
+
+        // Search space of Ritz vectors and search directions P and AP
+        VectorType** hp_;
+        VectorType** hq_;
+
+        // Cholesky factor of E = W^H AW
+        ValueType* E_;
+        ValueType* mu_;
+
+        // Ritz values of the leading vectors in the search space
+        ValueType* ritz_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_DEFLATED_CG_HPP_
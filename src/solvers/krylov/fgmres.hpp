@@ -90,6 +90,9 @@ namespace rocalution
         static void ApplyGivensRotation_(ValueType c, ValueType s, ValueType& dx, ValueType& dy);
 
     private:
+        /** \brief Orthogonalize v_i+1 against v_0, ..., v_i, store coefficients in H */
+        void Orthogonalize_(int i);
+
         VectorType** v_;
         VectorType** z_;
 
@@ -97,6 +100,7 @@ namespace rocalution
         ValueType* s_;
         ValueType* r_;
         ValueType* H_;
+        ValueType* w_;
 
         int size_basis_;
     };
@@ -0,0 +1,1062 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gcrodr.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+#include "../../base/matrix_formats_ind.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <math.h>
+#include <vector>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    GCRODR<OperatorType, VectorType, ValueType>::GCRODR()
+    {
+        log_debug(this, "GCRODR::GCRODR()", "default constructor");
+
+        this->size_basis_   = 30;
+        this->size_recycle_ = 10;
+
+        this->num_recycle_     = 0;
+        this->rebuild_recycle_ = false;
+
+        this->v_     = NULL;
+        this->z_     = NULL;
+        this->u_     = NULL;
+        this->c_     = NULL;
+        this->u_buf_ = NULL;
+        this->c_buf_ = NULL;
+        this->q_     = NULL;
+
+        this->c_rot_ = NULL;
+        this->s_rot_ = NULL;
+        this->g_     = NULL;
+        this->H_     = NULL;
+        this->R_     = NULL;
+        this->B_     = NULL;
+        this->w_     = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    GCRODR<OperatorType, VectorType, ValueType>::~GCRODR()
+    {
+        log_debug(this, "GCRODR::~GCRODR()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("GCRODR solver");
+        }
+        else
+        {
+            LOG_INFO("GCRODR solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("GCRODR(" << this->size_basis_ << "," << this->size_recycle_
+                               << ") (non-precond) linear solver starts, recycle subspace size = "
+                               << this->num_recycle_);
+        }
+        else
+        {
+            LOG_INFO("GCRODR(" << this->size_basis_ << "," << this->size_recycle_
+                               << ") solver starts, recycle subspace size = "
+                               << this->num_recycle_ << ", with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("GCRODR(" << this->size_basis_ << "," << this->size_recycle_
+                               << ") (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("GCRODR(" << this->size_basis_ << "," << this->size_recycle_ << ") ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "GCRODR::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() > 0);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->size_basis_ > 0);
+        assert(this->size_recycle_ >= 0);
+        assert(this->size_recycle_ < this->size_basis_);
+
+        if(this->res_norm_type_ != 2)
+        {
+            LOG_INFO(
+                "GCRODR solver supports only L2 residual norm. The solver is switching to L2 norm");
+            this->res_norm_type_ = 2;
+        }
+
+        int m = this->size_basis_;
+        int k = this->size_recycle_;
+
+        allocate_host(m, &this->c_rot_);
+        allocate_host(m, &this->s_rot_);
+        allocate_host(m + 1, &this->g_);
+        allocate_host((m + 1) * m, &this->H_);
+        allocate_host((m + 1) * m, &this->R_);
+        allocate_host(std::max(k * m, 1), &this->B_);
+        allocate_host(k + m + 1, &this->w_);
+
+        this->v_ = new VectorType*[m + 1];
+
+        for(int i = 0; i < m + 1; ++i)
+        {
+            this->v_[i] = new VectorType;
+            this->v_[i]->CloneBackend(*this->op_);
+            this->v_[i]->Allocate("v", this->op_->GetM());
+        }
+
+        this->u_     = new VectorType*[k];
+        this->c_     = new VectorType*[k];
+        this->u_buf_ = new VectorType*[k];
+        this->c_buf_ = new VectorType*[k];
+
+        for(int i = 0; i < k; ++i)
+        {
+            this->u_[i]     = new VectorType;
+            this->c_[i]     = new VectorType;
+            this->u_buf_[i] = new VectorType;
+            this->c_buf_[i] = new VectorType;
+
+            this->u_[i]->CloneBackend(*this->op_);
+            this->c_[i]->CloneBackend(*this->op_);
+            this->u_buf_[i]->CloneBackend(*this->op_);
+            this->c_buf_[i]->CloneBackend(*this->op_);
+
+            this->u_[i]->Allocate("u", this->op_->GetM());
+            this->c_[i]->Allocate("c", this->op_->GetM());
+            this->u_buf_[i]->Allocate("u", this->op_->GetM());
+            this->c_buf_[i]->Allocate("c", this->op_->GetM());
+        }
+
+        this->q_ = new VectorType*[k + m + 1];
+
+        if(this->precond_ != NULL)
+        {
+            this->z_ = new VectorType*[m];
+
+            for(int i = 0; i < m; ++i)
+            {
+                this->z_[i] = new VectorType;
+                this->z_[i]->CloneBackend(*this->op_);
+                this->z_[i]->Allocate("z", this->op_->GetM());
+            }
+
+            this->precond_->SetOperator(*this->op_);
+            this->precond_->Build();
+        }
+
+        this->num_recycle_     = 0;
+        this->rebuild_recycle_ = false;
+
+        this->build_ = true;
+
+        log_debug(this, "GCRODR::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "GCRODR::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < this->size_basis_; ++i)
+                {
+                    delete this->z_[i];
+                }
+
+                delete[] this->z_;
+                this->z_ = NULL;
+
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            free_host(&this->c_rot_);
+            free_host(&this->s_rot_);
+            free_host(&this->g_);
+            free_host(&this->H_);
+            free_host(&this->R_);
+            free_host(&this->B_);
+            free_host(&this->w_);
+
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                delete this->v_[i];
+            }
+
+            delete[] this->v_;
+            this->v_ = NULL;
+
+            for(int i = 0; i < this->size_recycle_; ++i)
+            {
+                delete this->u_[i];
+                delete this->c_[i];
+                delete this->u_buf_[i];
+                delete this->c_buf_[i];
+            }
+
+            delete[] this->u_;
+            delete[] this->c_;
+            delete[] this->u_buf_;
+            delete[] this->c_buf_;
+            delete[] this->q_;
+
+            this->u_     = NULL;
+            this->c_     = NULL;
+            this->u_buf_ = NULL;
+            this->c_buf_ = NULL;
+            this->q_     = NULL;
+
+            this->num_recycle_     = 0;
+            this->rebuild_recycle_ = false;
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "GCRODR::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->Zeros();
+            }
+
+            // Keep the recycle subspace, C is recomputed in the next solve
+            this->rebuild_recycle_ = (this->num_recycle_ > 0);
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < this->size_basis_; ++i)
+                {
+                    this->z_[i]->Zeros();
+                }
+
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "GCRODR::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->MoveToHost();
+            }
+
+            for(int i = 0; i < this->size_recycle_; ++i)
+            {
+                this->u_[i]->MoveToHost();
+                this->c_[i]->MoveToHost();
+                this->u_buf_[i]->MoveToHost();
+                this->c_buf_[i]->MoveToHost();
+            }
+
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < this->size_basis_; ++i)
+                {
+                    this->z_[i]->MoveToHost();
+                }
+
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "GCRODR::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->MoveToAccelerator();
+            }
+
+            for(int i = 0; i < this->size_recycle_; ++i)
+            {
+                this->u_[i]->MoveToAccelerator();
+                this->c_[i]->MoveToAccelerator();
+                this->u_buf_[i]->MoveToAccelerator();
+                this->c_buf_[i]->MoveToAccelerator();
+            }
+
+            if(this->precond_ != NULL)
+            {
+                for(int i = 0; i < this->size_basis_; ++i)
+                {
+                    this->z_[i]->MoveToAccelerator();
+                }
+
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::SetBasisSize(int size_basis)
+    {
+        log_debug(this, "GCRODR::SetBasisSize()", size_basis);
+
+        assert(size_basis > 0);
+        assert(this->build_ == false);
+
+        this->size_basis_ = size_basis;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::SetRecycleSize(int size)
+    {
+        log_debug(this, "GCRODR::SetRecycleSize()", size);
+
+        assert(size >= 0);
+        assert(this->build_ == false);
+
+        this->size_recycle_ = size;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    int GCRODR<OperatorType, VectorType, ValueType>::GetRecycleSize(void) const
+    {
+        return this->num_recycle_;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::ClearRecycleSpace(void)
+    {
+        log_debug(this, "GCRODR::ClearRecycleSpace()");
+
+        this->num_recycle_     = 0;
+        this->rebuild_recycle_ = false;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                       VectorType*       x)
+    {
+        log_debug(this, "GCRODR::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ == NULL);
+
+        this->SolveRecycle_(rhs, x);
+
+        log_debug(this, "GCRODR::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                    VectorType*       x)
+    {
+        log_debug(this, "GCRODR::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->precond_ != NULL);
+
+        this->SolveRecycle_(rhs, x);
+
+        log_debug(this, "GCRODR::SolvePrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::SolveRecycle_(const VectorType& rhs,
+                                                                    VectorType*       x)
+    {
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->build_ == true);
+        assert(this->res_norm_type_ == 2);
+
+        const OperatorType* op = this->op_;
+
+        VectorType** v = this->v_;
+
+        // Search directions, Z = M^-1 V or V
+        VectorType** z = (this->precond_ != NULL) ? this->z_ : this->v_;
+
+        ValueType* c = this->c_rot_;
+        ValueType* s = this->s_rot_;
+        ValueType* g = this->g_;
+        ValueType* H = this->H_;
+        ValueType* R = this->R_;
+        ValueType* B = this->B_;
+        ValueType* w = this->w_;
+
+        ValueType one = static_cast<ValueType>(1);
+
+        int m  = this->size_basis_;
+        int ld = m + 1;
+
+        // Initial residual v_0 = b - Ax
+        op->Apply(*x, v[0]);
+        v[0]->ScaleAdd(-one, rhs);
+
+        ValueType res_norm = this->Norm_(*v[0]);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            return;
+        }
+
+        // The operator has changed, recompute C = AU
+        if(this->rebuild_recycle_ == true)
+        {
+            this->BuildRecycleSpace_();
+            this->rebuild_recycle_ = false;
+        }
+
+        while(true)
+        {
+            int k = this->num_recycle_;
+
+            if(k > 0)
+            {
+                // Project the residual onto the complement of C
+                // w = C^H r, x = x + U w, r = r - C w
+                v[0]->MultiDot(this->c_, k, w);
+                x->MultiAddScale(this->u_, k, w);
+
+                for(int j = 0; j < k; ++j)
+                {
+                    w[j] = -w[j];
+                }
+
+                v[0]->MultiAddScale(this->c_, k, w);
+
+                res_norm = this->Norm_(*v[0]);
+
+                if(this->iter_ctrl_.CheckResidualNoCount(std::abs(res_norm)))
+                {
+                    break;
+                }
+            }
+
+            // Orthogonalization basis [C V]
+            for(int j = 0; j < k; ++j)
+            {
+                this->q_[j] = this->c_[j];
+            }
+
+            for(int j = 0; j < m + 1; ++j)
+            {
+                this->q_[k + j] = v[j];
+            }
+
+            // g = ||r|| e_0
+            set_to_zero_host(m + 1, g);
+            g[0] = res_norm;
+
+            // Normalize v_0
+            v[0]->Scale(one / res_norm);
+
+            // Arnoldi iteration of size m - k
+            int size = m - k;
+            int i    = 0;
+
+            while(i < size)
+            {
+                // Solve Mz_i = v_i
+                if(this->precond_ != NULL)
+                {
+                    this->precond_->SolveZeroSol(*v[i], z[i]);
+                }
+
+                // v_i+1 = Az_i
+                op->Apply(*z[i], v[i + 1]);
+
+                // Orthogonalize against C and V, build B and Hessenberg matrix H
+                this->Orthogonalize_(i);
+
+                // H_i+1i = ||v_i+1||
+                H[DENSE_IND(i + 1, i, ld, m)] = this->Norm_(*v[i + 1]);
+
+                // v_i+1 /= H_i+1i
+                v[i + 1]->Scale(one / H[DENSE_IND(i + 1, i, ld, m)]);
+
+                // R keeps the rotated Hessenberg matrix, H is required for the recycle subspace
+                for(int j = 0; j <= i + 1; ++j)
+                {
+                    R[DENSE_IND(j, i, ld, m)] = H[DENSE_IND(j, i, ld, m)];
+                }
+
+                // Apply Givens rotation J(0),...,J(j-1) on (R(0,i),...,R(i,i))
+                for(int j = 0; j < i; ++j)
+                {
+                    this->ApplyGivensRotation_(
+                        c[j], s[j], R[DENSE_IND(j, i, ld, m)], R[DENSE_IND(j + 1, i, ld, m)]);
+                }
+
+                // Construct J(i)
+                this->GenerateGivensRotation_(
+                    R[DENSE_IND(i, i, ld, m)], R[DENSE_IND(i + 1, i, ld, m)], c[i], s[i]);
+
+                // Apply J(i) to R(i,i) and R(i,i+1) such that R(i,i+1) = 0
+                this->ApplyGivensRotation_(
+                    c[i], s[i], R[DENSE_IND(i, i, ld, m)], R[DENSE_IND(i + 1, i, ld, m)]);
+
+                // Apply J(i) to the norm of the residual g[i]
+                this->ApplyGivensRotation_(c[i], s[i], g[i], g[i + 1]);
+
+                // Check convergence
+                if(this->iter_ctrl_.CheckResidual(std::abs(g[++i])))
+                {
+                    break;
+                }
+            }
+
+            // Solve upper triangular system R y = g
+            for(int j = i - 1; j >= 0; --j)
+            {
+                g[j] /= R[DENSE_IND(j, j, ld, m)];
+
+                for(int l = 0; l < j; ++l)
+                {
+                    g[l] -= R[DENSE_IND(l, j, ld, m)] * g[j];
+                }
+            }
+
+            // Update solution x = x + Z y - U B y
+            x->MultiAddScale(z, i, g);
+
+            if(k > 0)
+            {
+                for(int l = 0; l < k; ++l)
+                {
+                    w[l] = static_cast<ValueType>(0);
+
+                    for(int j = 0; j < i; ++j)
+                    {
+                        w[l] -= B[DENSE_IND(l, j, k, m)] * g[j];
+                    }
+                }
+
+                x->MultiAddScale(this->u_, k, w);
+            }
+
+            // Compute the recycle subspace for the following cycles and solves
+            this->UpdateRecycleSpace_(i);
+
+            // Compute residual v_0 = b - Ax
+            op->Apply(*x, v[0]);
+            v[0]->ScaleAdd(-one, rhs);
+
+            res_norm = this->Norm_(*v[0]);
+
+            // Check convergence
+            if(this->iter_ctrl_.CheckResidualNoCount(std::abs(res_norm)))
+            {
+                break;
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::Orthogonalize_(int i)
+    {
+        int k = this->num_recycle_;
+        int m = this->size_basis_;
+        int n = k + i + 1;
+
+        VectorType** q = this->q_;
+        VectorType*  v = this->v_[i + 1];
+        ValueType*   w = this->w_;
+
+        ValueType* b = &this->B_[DENSE_IND(0, i, k, m)];
+        ValueType* h = &this->H_[DENSE_IND(0, i, m + 1, m)];
+
+        // Classical Gram-Schmidt with reorthogonalization (CGS2) against [C V], each pass
+        // needs a single sweep over the basis and a single global reduction
+        for(int pass = 0; pass < 2; ++pass)
+        {
+            // w = [C V]^H v, v = v - [C V] w
+            v->MultiDot(q, n, w);
+
+            for(int j = 0; j < k; ++j)
+            {
+                b[j] = (pass == 0) ? w[j] : b[j] + w[j];
+            }
+
+            for(int j = 0; j <= i; ++j)
+            {
+                h[j] = (pass == 0) ? w[k + j] : h[j] + w[k + j];
+            }
+
+            for(int j = 0; j < n; ++j)
+            {
+                w[j] = -w[j];
+            }
+
+            v->MultiAddScale(q, n, w);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::BuildRecycleSpace_(void)
+    {
+        log_debug(this, "GCRODR::BuildRecycleSpace_()", this->num_recycle_);
+
+        typedef decltype(std::abs(ValueType(0))) RealType;
+
+        const RealType tol = std::sqrt(std::numeric_limits<RealType>::epsilon());
+
+        int k = this->num_recycle_;
+
+        VectorType** u = this->u_;
+        VectorType** c = this->c_;
+        ValueType*   w = this->w_;
+
+        // C = AU
+        for(int j = 0; j < k; ++j)
+        {
+            this->op_->Apply(*u[j], c[j]);
+        }
+
+        // Orthonormalize C by CGS2 and apply the same transformation to U, such that
+        // C = AU holds
+        for(int j = 0; j < k; ++j)
+        {
+            RealType nrm0 = std::abs(this->Norm_(*c[j]));
+
+            for(int pass = 0; pass < 2 && j > 0; ++pass)
+            {
+                c[j]->MultiDot(c, j, w);
+
+                for(int l = 0; l < j; ++l)
+                {
+                    w[l] = -w[l];
+                }
+
+                c[j]->MultiAddScale(c, j, w);
+                u[j]->MultiAddScale(u, j, w);
+            }
+
+            RealType nrm = std::abs(this->Norm_(*c[j]));
+
+            if(!(nrm > tol * nrm0))
+            {
+                LOG_VERBOSE_INFO(2, "GCRODR: recycle subspace is rank deficient, reducing size");
+
+                this->num_recycle_ = j;
+
+                return;
+            }
+
+            c[j]->Scale(static_cast<ValueType>(1) / nrm);
+            u[j]->Scale(static_cast<ValueType>(1) / nrm);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::UpdateRecycleSpace_(int i)
+    {
+        log_debug(this, "GCRODR::UpdateRecycleSpace_()", this->num_recycle_, i);
+
+        typedef decltype(std::abs(ValueType(0))) RealType;
+
+        const RealType tol = std::sqrt(std::numeric_limits<RealType>::epsilon());
+
+        int k  = this->num_recycle_;
+        int m  = this->size_basis_;
+        int nw = k + i;
+        int ng = k + i + 1;
+
+        if(this->size_recycle_ == 0 || i == 0)
+        {
+            return;
+        }
+
+        // W = [U Z], AW = [C V] G with orthonormal [C V]
+        std::vector<const VectorType*> W(nw);
+        std::vector<const VectorType*> Q(ng);
+
+        for(int j = 0; j < k; ++j)
+        {
+            W[j] = this->u_[j];
+            Q[j] = this->c_[j];
+        }
+
+        for(int j = 0; j < i; ++j)
+        {
+            W[k + j] = (this->precond_ != NULL) ? this->z_[j] : this->v_[j];
+        }
+
+        for(int j = 0; j <= i; ++j)
+        {
+            Q[k + j] = this->v_[j];
+        }
+
+        ValueType* G      = NULL;
+        ValueType* GG     = NULL;
+        ValueType* F      = NULL;
+        ValueType* Y      = NULL;
+        ValueType* T      = NULL;
+        ValueType* RR     = NULL;
+        ValueType* lambda = NULL;
+
+        allocate_host(ng * nw, &G);
+        allocate_host(nw * nw, &GG);
+        allocate_host(nw * nw, &F);
+        allocate_host(nw * nw, &Y);
+        allocate_host(ng * nw, &T);
+        allocate_host(nw * nw, &RR);
+        allocate_host(nw, &lambda);
+
+        // G = [I B; 0 H]
+        set_to_zero_host(ng * nw, G);
+
+        for(int j = 0; j < k; ++j)
+        {
+            G[DENSE_IND(j, j, ng, nw)] = static_cast<ValueType>(1);
+        }
+
+        for(int j = 0; j < i; ++j)
+        {
+            for(int l = 0; l < k; ++l)
+            {
+                G[DENSE_IND(l, k + j, ng, nw)] = this->B_[DENSE_IND(l, j, k, m)];
+            }
+
+            for(int l = 0; l <= j + 1; ++l)
+            {
+                G[DENSE_IND(k + l, k + j, ng, nw)] = this->H_[DENSE_IND(l, j, m + 1, m)];
+            }
+        }
+
+        // GG = G^H G
+        for(int b = 0; b < nw; ++b)
+        {
+            for(int a = 0; a < nw; ++a)
+            {
+                ValueType sum = static_cast<ValueType>(0);
+
+                for(int l = 0; l < ng; ++l)
+                {
+                    sum += rocalution_conj(G[DENSE_IND(l, a, ng, nw)]) * G[DENSE_IND(l, b, ng, nw)];
+                }
+
+                GG[DENSE_IND(a, b, nw, nw)] = sum;
+            }
+        }
+
+        // F = W^H W, the Arnoldi vectors are orthonormal without preconditioner
+        for(int j = 0; j < k; ++j)
+        {
+            W[j]->MultiDot(W.data(), nw, &F[DENSE_IND(0, j, nw, nw)]);
+        }
+
+        for(int j = k; j < nw; ++j)
+        {
+            if(this->precond_ != NULL)
+            {
+                W[j]->MultiDot(W.data(), nw, &F[DENSE_IND(0, j, nw, nw)]);
+            }
+            else
+            {
+                for(int l = 0; l < k; ++l)
+                {
+                    F[DENSE_IND(l, j, nw, nw)] = rocalution_conj(F[DENSE_IND(j, l, nw, nw)]);
+                }
+
+                for(int l = k; l < nw; ++l)
+                {
+                    F[DENSE_IND(l, j, nw, nw)] = static_cast<ValueType>(l == j ? 1 : 0);
+                }
+            }
+        }
+
+        // Approximate right singular vectors of the smallest singular values,
+        // G^H G y = lambda W^H W y
+        if(rocalution_hermitian_eigen(nw, GG, F, lambda, Y) == false)
+        {
+            LOG_VERBOSE_INFO(2, "GCRODR: eigenvalue problem failed, keeping the recycle subspace");
+        }
+        else
+        {
+            // The recycle subspace must leave room for at least one Arnoldi vector
+            int num_recycle = std::min(std::min(this->size_recycle_, nw), m - 1);
+
+            // T = G Y
+            for(int j = 0; j < num_recycle; ++j)
+            {
+                for(int a = 0; a < ng; ++a)
+                {
+                    ValueType sum = static_cast<ValueType>(0);
+
+                    for(int l = 0; l < nw; ++l)
+                    {
+                        sum += G[DENSE_IND(a, l, ng, nw)] * Y[DENSE_IND(l, j, nw, nw)];
+                    }
+
+                    T[DENSE_IND(a, j, ng, nw)] = sum;
+                }
+            }
+
+            // QR factorization T = QR by MGS with reorthogonalization
+            set_to_zero_host(nw * nw, RR);
+
+            for(int j = 0; j < num_recycle; ++j)
+            {
+                ValueType* tj   = &T[DENSE_IND(0, j, ng, nw)];
+                RealType   nrm0 = static_cast<RealType>(0);
+
+                for(int a = 0; a < ng; ++a)
+                {
+                    nrm0 += std::norm(tj[a]);
+                }
+
+                for(int pass = 0; pass < 2; ++pass)
+                {
+                    for(int l = 0; l < j; ++l)
+                    {
+                        ValueType* tl  = &T[DENSE_IND(0, l, ng, nw)];
+                        ValueType  dot = static_cast<ValueType>(0);
+
+                        for(int a = 0; a < ng; ++a)
+                        {
+                            dot += rocalution_conj(tl[a]) * tj[a];
+                        }
+
+                        for(int a = 0; a < ng; ++a)
+                        {
+                            tj[a] -= dot * tl[a];
+                        }
+
+                        RR[DENSE_IND(l, j, nw, nw)] += dot;
+                    }
+                }
+
+                RealType nrm = static_cast<RealType>(0);
+
+                for(int a = 0; a < ng; ++a)
+                {
+                    nrm += std::norm(tj[a]);
+                }
+
+                nrm  = std::sqrt(nrm);
+                nrm0 = std::sqrt(nrm0);
+
+                if(!(nrm > tol * nrm0))
+                {
+                    num_recycle = j;
+                    break;
+                }
+
+                RR[DENSE_IND(j, j, nw, nw)] = static_cast<ValueType>(nrm);
+
+                for(int a = 0; a < ng; ++a)
+                {
+                    tj[a] /= nrm;
+                }
+            }
+
+            // Y = Y R^-1
+            for(int j = 0; j < num_recycle; ++j)
+            {
+                for(int l = 0; l < j; ++l)
+                {
+                    for(int a = 0; a < nw; ++a)
+                    {
+                        Y[DENSE_IND(a, j, nw, nw)]
+                            -= RR[DENSE_IND(l, j, nw, nw)] * Y[DENSE_IND(a, l, nw, nw)];
+                    }
+                }
+
+                for(int a = 0; a < nw; ++a)
+                {
+                    Y[DENSE_IND(a, j, nw, nw)] /= RR[DENSE_IND(j, j, nw, nw)];
+                }
+            }
+
+            // C = [C V] Q, U = W Y R^-1
+            for(int j = 0; j < num_recycle; ++j)
+            {
+                this->c_buf_[j]->Zeros();
+                this->c_buf_[j]->MultiAddScale(Q.data(), ng, &T[DENSE_IND(0, j, ng, nw)]);
+
+                this->u_buf_[j]->Zeros();
+                this->u_buf_[j]->MultiAddScale(W.data(), nw, &Y[DENSE_IND(0, j, nw, nw)]);
+            }
+
+            std::swap(this->u_, this->u_buf_);
+            std::swap(this->c_, this->c_buf_);
+
+            this->num_recycle_ = num_recycle;
+        }
+
+        free_host(&G);
+        free_host(&GG);
+        free_host(&F);
+        free_host(&Y);
+        free_host(&T);
+        free_host(&RR);
+        free_host(&lambda);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::GenerateGivensRotation_(ValueType  dx,
+                                                                              ValueType  dy,
+                                                                              ValueType& c,
+                                                                              ValueType& s)
+    {
+        ValueType zero = static_cast<ValueType>(0);
+        ValueType one  = static_cast<ValueType>(1);
+
+        if(dy == zero)
+        {
+            c = one;
+            s = zero;
+        }
+        else if(dx == zero)
+        {
+            c = zero;
+            s = one;
+        }
+        else if(std::abs(dy) > std::abs(dx))
+        {
+            ValueType tmp = dx / dy;
+            s             = one / sqrt(one + tmp * tmp);
+            c             = tmp * s;
+        }
+        else
+        {
+            ValueType tmp = dy / dx;
+            c             = one / sqrt(one + tmp * tmp);
+            s             = tmp * c;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GCRODR<OperatorType, VectorType, ValueType>::ApplyGivensRotation_(ValueType  c,
+                                                                           ValueType  s,
+                                                                           ValueType& dx,
+                                                                           ValueType& dy)
+    {
+        ValueType temp = dx;
+        dx             = rocalution_conj(c) * dx + rocalution_conj(s) * dy;
+        dy             = -s * temp + c * dy;
+    }
+
+    template class GCRODR<LocalMatrix<double>, LocalVector<double>, double>;
+    template class GCRODR<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class GCRODR<LocalMatrix<std::complex<double>>,
+                          LocalVector<std::complex<double>>,
+                          std::complex<double>>;
+    template class GCRODR<LocalMatrix<std::complex<float>>,
+                          LocalVector<std::complex<float>>,
+                          std::complex<float>>;
+#endif
+
+    template class GCRODR<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class GCRODR<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class GCRODR<GlobalMatrix<std::complex<double>>,
+                          GlobalVector<std::complex<double>>,
+                          std::complex<double>>;
+    template class GCRODR<GlobalMatrix<std::complex<float>>,
+                          GlobalVector<std::complex<float>>,
+                          std::complex<float>>;
+#endif
+
+    template class GCRODR<LocalStencil<double>, LocalVector<double>, double>;
+    template class GCRODR<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class GCRODR<LocalStencil<std::complex<double>>,
+                          LocalVector<std::complex<double>>,
+                          std::complex<double>>;
+    template class GCRODR<LocalStencil<std::complex<float>>,
+                          LocalVector<std::complex<float>>,
+                          std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_GCRODR_HPP_
+#define ROCALUTION_KRYLOV_GCRODR_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class GCRODR
+  * \brief Generalized Conjugate Residual Method with inner Orthogonalization and Deflated
+  * Restarting
+  * \details
+  * The GCRO-DR method is a recycling Krylov subspace method for solving sequences of
+  * sparse (non) symmetric linear systems \f$Ax=b\f$. Similar to GMRES, the solution is
+  * approximated with minimal residual in a Krylov subspace, which is additionally
+  * augmented by a small recycle subspace \f$\mathcal{U}\f$ with
+  * \f$\mathcal{C}=A\mathcal{U}\f$ and \f$C^{H}C = I\f$. \f$\mathcal{U}\f$ is kept inside the
+  * solver object between restarts and between successive calls to Solve(). After each
+  * restart cycle, \f$\mathcal{U}\f$ is set to the approximate right singular vectors that
+  * belong to the smallest singular values of \f$A\f$, computed from the augmented Arnoldi
+  * relation, which removes the slowly converging components from subsequent cycles and
+  * solves.
+  * \cite Parks2006
+  *
+  * Preconditioning is applied from the right in flexible form, such that the recycle
+  * subspace remains valid for a varying preconditioner. The Krylov subspace basis size
+  * (including the recycle subspace) can be set using SetBasisSize() and the dimension of
+  * the recycle subspace using SetRecycleSize(). The defaults are 30 and 10. The recycle
+  * subspace is kept, when the operator values change and ReBuildNumeric() is called,
+  * and is discarded by Clear() or ClearRecycleSpace().
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class GCRODR : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        GCRODR();
+        ROCALUTION_EXPORT
+        virtual ~GCRODR();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Set the size of the Krylov subspace basis */
+        ROCALUTION_EXPORT
+        virtual void SetBasisSize(int size_basis);
+        /** \brief Set the maximum dimension of the recycle subspace */
+        ROCALUTION_EXPORT
+        void SetRecycleSize(int size);
+        /** \brief Return the current dimension of the recycle subspace */
+        ROCALUTION_EXPORT
+        int GetRecycleSize(void) const;
+        /** \brief Discard the recycle subspace */
+        ROCALUTION_EXPORT
+        void ClearRecycleSpace(void);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+        /** \brief Generate Givens rotation */
+        static void GenerateGivensRotation_(ValueType dx, ValueType dy, ValueType& c, ValueType& s);
+        /** \brief Apply Givens rotation */
+        static void ApplyGivensRotation_(ValueType c, ValueType s, ValueType& dx, ValueType& dy);
+
+    private:
+        /** \brief GCRO-DR restart cycles */
+        void SolveRecycle_(const VectorType& rhs, VectorType* x);
+        /** \brief Orthogonalize v_i+1 against C and v_0, ..., v_i, store coefficients in B
+          * and H */
+        void Orthogonalize_(int i);
+        /** \brief Recompute C = AU with orthonormal C, e.g. after the operator has changed */
+        void BuildRecycleSpace_(void);
+        /** \brief Compute the recycle subspace from the last restart cycle of size i */
+        void UpdateRecycleSpace_(int i);
+
+        int size_basis_;
+        int size_recycle_;
+
+        // Current dimension of the recycle subspace
+        int num_recycle_;
+
+        // C has to be recomputed, e.g. after the operator has changed
+        bool rebuild_recycle_;
+
+        // Arnoldi basis V and preconditioned basis Z
+        VectorType** v_;
+        VectorType** z_;
+
+        // Recycle subspace U, C = AU and buffers for the subspace update
+        VectorType** u_;
+        VectorType** c_;
+        VectorType** u_buf_;
+        VectorType** c_buf_;
+
+        // Orthogonalization basis [C V]
+        VectorType** q_;
+
+        ValueType* c_rot_;
+        ValueType* s_rot_;
+        ValueType* g_;
+        ValueType* H_;
+        ValueType* R_;
+        ValueType* B_;
+        ValueType* w_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_GCRODR_HPP_
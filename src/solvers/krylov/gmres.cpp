@@ -54,6 +54,7 @@ namespace rocalution
         this->s_ = NULL;
         this->r_ = NULL;
         this->H_ = NULL;
+        this->w_ = NULL;
         this->v_ = NULL;
     }
 
@@ -133,6 +134,7 @@ namespace rocalution
         allocate_host(this->size_basis_, &this->s_);
         allocate_host(this->size_basis_ + 1, &this->r_);
         allocate_host((this->size_basis_ + 1) * this->size_basis_, &this->H_);
+        allocate_host(this->size_basis_ + 1, &this->w_);
 
         this->v_ = new VectorType*[this->size_basis_ + 1];
 
@@ -175,6 +177,7 @@ namespace rocalution
             free_host(&this->s_);
             free_host(&this->r_);
             free_host(&this->H_);
+            free_host(&this->w_);
 
             for(int i = 0; i < this->size_basis_ + 1; ++i)
             {
@@ -327,14 +330,7 @@ namespace rocalution
                 op->Apply(*v[i], v[i + 1]);
 
                 // Build Hessenberg matrix H
-                for(int k = 0; k <= i; ++k)
-                {
-                    int idx = DENSE_IND(k, i, size + 1, size);
-                    // H_ki = <v_k,v_i+1>
-                    H[idx] = v[k]->Dot(*v[i + 1]);
-                    // v_i+1 -= H_ki * v_k
-                    v[i + 1]->AddScale(*v[k], -H[idx]);
-                }
+                this->Orthogonalize_(i);
 
                 // Precompute some indices
                 int ii   = DENSE_IND(i, i, size + 1, size);
@@ -382,12 +378,7 @@ namespace rocalution
             }
 
             // Update solution
-            x->AddScale(*v[0], r[0]);
-
-            for(int j = 1; j < i; ++j)
-            {
-                x->AddScale(*v[j], r[j]);
-            }
+            x->MultiAddScale(v, i, r);
 
             // Compute residual v_0 = b - Ax
             op->Apply(*x, v[0]);
@@ -476,14 +467,7 @@ namespace rocalution
                 this->precond_->SolveZeroSol(*z, v[i + 1]);
 
                 // Build Hessenberg matrix H
-                for(int k = 0; k <= i; ++k)
-                {
-                    int idx = DENSE_IND(k, i, size + 1, size);
-                    // H_ki = <v_k,v_i+1>
-                    H[idx] = v[k]->Dot(*v[i + 1]);
-                    // v_i+1 -= H_ki * v_k
-                    v[i + 1]->AddScale(*v[k], -H[idx]);
-                }
+                this->Orthogonalize_(i);
 
                 // Precompute some indices
                 int ii   = DENSE_IND(i, i, size + 1, size);
@@ -531,12 +515,7 @@ namespace rocalution
             }
 
             // Update solution
-            x->AddScale(*v[0], r[0]);
-
-            for(int j = 1; j < i; ++j)
-            {
-                x->AddScale(*v[j], r[j]);
-            }
+            x->MultiAddScale(v, i, r);
 
             // Compute residual z = b - Ax
             op->Apply(*x, z);
@@ -561,6 +540,40 @@ namespace rocalution
         log_debug(this, "GMRES::SolvePrecond_()", " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GMRES<OperatorType, VectorType, ValueType>::Orthogonalize_(int i)
+    {
+        VectorType** v = this->v_;
+        ValueType*   w = this->w_;
+
+        // Column i of the Hessenberg matrix
+        ValueType* h = &this->H_[DENSE_IND(0, i, this->size_basis_ + 1, this->size_basis_)];
+
+        // Classical Gram-Schmidt with reorthogonalization (CGS2), each pass needs a single
+        // sweep over the basis and a single global reduction
+
+        // h = V^H v_i+1, v_i+1 -= V h
+        v[i + 1]->MultiDot(v, i + 1, h);
+
+        for(int k = 0; k <= i; ++k)
+        {
+            w[k] = -h[k];
+        }
+
+        v[i + 1]->MultiAddScale(v, i + 1, w);
+
+        // w = V^H v_i+1, v_i+1 -= V w, h += w
+        v[i + 1]->MultiDot(v, i + 1, w);
+
+        for(int k = 0; k <= i; ++k)
+        {
+            h[k] += w[k];
+            w[k] = -w[k];
+        }
+
+        v[i + 1]->MultiAddScale(v, i + 1, w);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void GMRES<OperatorType, VectorType, ValueType>::GenerateGivensRotation_(ValueType  dx,
                                                                              ValueType  dy,
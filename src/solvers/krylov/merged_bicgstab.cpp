@@ -0,0 +1,597 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "merged_bicgstab.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <complex>
+#include <limits>
+#include <math.h>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    MergedBiCGStab<OperatorType, VectorType, ValueType>::MergedBiCGStab()
+    {
+        log_debug(this, "MergedBiCGStab::MergedBiCGStab()", "default constructor");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    MergedBiCGStab<OperatorType, VectorType, ValueType>::~MergedBiCGStab()
+    {
+        log_debug(this, "MergedBiCGStab::~MergedBiCGStab()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MergedBiCGStab<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("MergedBiCGStab solver");
+        }
+        else
+        {
+            LOG_INFO("MergedBiCGStab solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MergedBiCGStab<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("MergedBiCGStab (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("MergedBiCGStab solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MergedBiCGStab<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("MergedBiCGStab (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("MergedBiCGStab ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MergedBiCGStab<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "MergedBiCGStab::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->op_->GetM() > 0);
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+            this->precond_->Build();
+
+            this->v_.CloneBackend(*this->op_);
+            this->z_.CloneBackend(*this->op_);
+
+            this->v_.Allocate("v", this->op_->GetM());
+            this->z_.Allocate("z", this->op_->GetM());
+        }
+
+        this->r_.CloneBackend(*this->op_);
+        this->r0_.CloneBackend(*this->op_);
+        this->p_.CloneBackend(*this->op_);
+        this->q_.CloneBackend(*this->op_);
+        this->t_.CloneBackend(*this->op_);
+
+        this->r_.Allocate("r", this->op_->GetM());
+        this->r0_.Allocate("r0", this->op_->GetM());
+        this->p_.Allocate("p", this->op_->GetM());
+        this->q_.Allocate("q", this->op_->GetM());
+        this->t_.Allocate("t", this->op_->GetM());
+
+        this->build_ = true;
+
+        log_debug(this, "MergedBiCGStab::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MergedBiCGStab<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "MergedBiCGStab::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.Clear();
+            this->r0_.Clear();
+            this->p_.Clear();
+            this->q_.Clear();
+            this->t_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+
+                this->v_.Clear();
+                this->z_.Clear();
+            }
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MergedBiCGStab<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "MergedBiCGStab::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.Zeros();
+            this->r0_.Zeros();
+            this->p_.Zeros();
+            this->q_.Zeros();
+            this->t_.Zeros();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->ReBuildNumeric();
+
+                this->v_.Zeros();
+                this->z_.Zeros();
+            }
+
+            this->iter_ctrl_.Clear();
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MergedBiCGStab<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "MergedBiCGStab::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToHost();
+            this->r0_.MoveToHost();
+            this->p_.MoveToHost();
+            this->q_.MoveToHost();
+            this->t_.MoveToHost();
+
+            if(this->precond_ != NULL)
+            {
+                this->v_.MoveToHost();
+                this->z_.MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MergedBiCGStab<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "MergedBiCGStab::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->r_.MoveToAccelerator();
+            this->r0_.MoveToAccelerator();
+            this->p_.MoveToAccelerator();
+            this->q_.MoveToAccelerator();
+            this->t_.MoveToAccelerator();
+
+            if(this->precond_ != NULL)
+            {
+                this->v_.MoveToAccelerator();
+                this->z_.MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MergedBiCGStab<OperatorType, VectorType, ValueType>::SolveNonPrecond_(
+        const VectorType& rhs, VectorType* x)
+    {
+        log_debug(this, "MergedBiCGStab::SolveNonPrecond_()", " #*# begin");
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ == NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r  = &this->r_;
+        VectorType* r0 = &this->r0_;
+        VectorType* p  = &this->p_;
+        VectorType* q  = &this->q_;
+        VectorType* t  = &this->t_;
+
+        ValueType alpha;
+        ValueType beta;
+        ValueType omega;
+        ValueType rho;
+        ValueType rho_old;
+        ValueType sigma;
+        ValueType tr, tt;
+        ValueType r0t, r0r;
+        ValueType rr;
+
+        // Inital residual r0 = b - Ax
+        op->Apply(*x, r0);
+        r0->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // Initial residual norm for |b-Ax0|
+        ValueType res_norm = this->Norm_(*r0);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "MergedBiCGStab::SolveNonPrecond_()", " #*# end");
+            return;
+        }
+
+        // r = r0
+        r->CopyFrom(*r0);
+
+        // rho = <r,r>
+        rho = r->Dot(*r);
+
+        // p = r
+        p->CopyFrom(*r);
+
+        // The residual of the previous iteration is checked in the first reduction phase
+        bool check = false;
+
+        while(true)
+        {
+            // q = Ap
+            op->Apply(*p, q);
+
+            // sigma = <r0,q> and, for the L2 norm, <r,r> in a single reduction phase
+            r0->DotAsync(*q, &sigma);
+
+            if(check == true && this->res_norm_type_ == 2)
+            {
+                r->DotAsync(*r, &rr);
+            }
+
+            r0->DotSync();
+            r->DotSync();
+
+            // Check convergence
+            if(check == true)
+            {
+                res_norm = (this->res_norm_type_ == 2) ? std::sqrt(rr) : this->Norm_(*r);
+
+                if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+                {
+                    break;
+                }
+            }
+
+            check = true;
+
+            // alpha = rho / <r0,q>
+            alpha = rho / sigma;
+
+            // r = r - alpha * q
+            r->AddScale(*q, -alpha);
+
+            // t = Ar
+            op->Apply(*r, t);
+
+            // <t,r>, <t,t>, <r0,t> and <r0,r> in a single reduction phase
+            t->DotAsync(*r, &tr);
+            t->DotAsync(*t, &tt);
+            r0->DotAsync(*t, &r0t);
+            r0->DotAsync(*r, &r0r);
+
+            t->DotSync();
+            r0->DotSync();
+
+            // omega = <t,r> / <t,t>
+            omega = tr / tt;
+
+            if((std::abs(omega) == std::numeric_limits<ValueType>::infinity()) || (omega != omega)
+               || (omega == static_cast<ValueType>(0)))
+            {
+                LOG_INFO("MergedBiCGStab omega == 0 || Nan || Inf !!! Updated solution only in "
+                         "p-direction");
+
+                // Update only for p
+                // x = x + alpha*p
+                x->AddScale(*p, alpha);
+
+                op->Apply(*x, p);
+                p->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+                res_norm = this->Norm_(*p);
+
+                this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_);
+
+                break;
+            }
+
+            // x = x + alpha * p + omega * r
+            x->ScaleAdd2(static_cast<ValueType>(1), *p, alpha, *r, omega);
+
+            // r = r - omega * t
+            r->AddScale(*t, -omega);
+
+            // rho = <r0,r> = <r0,r_old> - omega * <r0,t>
+            rho_old = rho;
+            rho     = r0r - omega * r0t;
+
+            // Check rho for zero
+            if(rho == static_cast<ValueType>(0))
+            {
+                LOG_INFO("MergedBiCGStab rho == 0 !!!");
+
+                res_norm = this->Norm_(*r);
+                this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_);
+
+                break;
+            }
+
+            // beta = (rho / rho_old) * (alpha / omega)
+            beta = (rho / rho_old) * (alpha / omega);
+
+            // p = beta * p - beta * omega * q + r
+            p->ScaleAdd2(beta, *q, -beta * omega, *r, static_cast<ValueType>(1));
+        }
+
+        log_debug(this, "MergedBiCGStab::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MergedBiCGStab<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                            VectorType*       x)
+    {
+        log_debug(this, "MergedBiCGStab::SolvePrecond_()", " #*# begin");
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ != NULL);
+        assert(this->build_ == true);
+
+        const OperatorType* op = this->op_;
+
+        VectorType* r  = &this->r_;
+        VectorType* r0 = &this->r0_;
+        VectorType* p  = &this->p_;
+        VectorType* q  = &this->q_;
+        VectorType* t  = &this->t_;
+        VectorType* v  = &this->v_;
+        VectorType* z  = &this->z_;
+
+        ValueType alpha;
+        ValueType beta;
+        ValueType omega;
+        ValueType rho;
+        ValueType rho_old;
+        ValueType sigma;
+        ValueType tr, tt;
+        ValueType r0t, r0r;
+        ValueType rr;
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r0);
+        r0->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+        // Initial residual norm for |b-Ax0|
+        ValueType res_norm = this->Norm_(*r0);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            log_debug(this, "MergedBiCGStab::SolvePrecond_()", " #*# end");
+            return;
+        }
+
+        // p = r = r0
+        r->CopyFrom(*r0);
+        p->CopyFrom(*r);
+
+        // rho = <r,r>
+        rho = r->Dot(*r);
+
+        // Mz = r
+        this->precond_->SolveZeroSol(*r, z);
+
+        // The residual of the previous iteration is checked in the first reduction phase
+        bool check = false;
+
+        while(true)
+        {
+            // q = Az
+            op->Apply(*z, q);
+
+            // sigma = <r0,q> and, for the L2 norm, <r,r> in a single reduction phase
+            r0->DotAsync(*q, &sigma);
+
+            if(check == true && this->res_norm_type_ == 2)
+            {
+                r->DotAsync(*r, &rr);
+            }
+
+            r0->DotSync();
+            r->DotSync();
+
+            // Check convergence
+            if(check == true)
+            {
+                res_norm = (this->res_norm_type_ == 2) ? std::sqrt(rr) : this->Norm_(*r);
+
+                if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+                {
+                    break;
+                }
+            }
+
+            check = true;
+
+            // alpha = rho / <r0,q>
+            alpha = rho / sigma;
+
+            // r = r - alpha * q
+            r->AddScale(*q, -alpha);
+
+            // Mv = r
+            this->precond_->SolveZeroSol(*r, v);
+
+            // t = Av
+            op->Apply(*v, t);
+
+            // <t,r>, <t,t>, <r0,t> and <r0,r> in a single reduction phase
+            t->DotAsync(*r, &tr);
+            t->DotAsync(*t, &tt);
+            r0->DotAsync(*t, &r0t);
+            r0->DotAsync(*r, &r0r);
+
+            t->DotSync();
+            r0->DotSync();
+
+            // omega = <t,r> / <t,t>
+            omega = tr / tt;
+
+            if((std::abs(omega) == std::numeric_limits<ValueType>::infinity()) || (omega != omega)
+               || (omega == static_cast<ValueType>(0)))
+            {
+                LOG_INFO("MergedBiCGStab omega == 0 || Nan || Inf !!! Updated solution only in "
+                         "p-direction");
+
+                // Update only for p
+                // x = x + alpha * z
+                x->AddScale(*z, alpha);
+
+                op->Apply(*x, p);
+                p->ScaleAdd(static_cast<ValueType>(-1), rhs);
+
+                res_norm = this->Norm_(*p);
+                this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_);
+
+                break;
+            }
+
+            // x = x + alpha * z + omega * v
+            x->ScaleAdd2(static_cast<ValueType>(1), *z, alpha, *v, omega);
+
+            // r = r - omega * t
+            r->AddScale(*t, -omega);
+
+            // rho = <r0,r> = <r0,r_old> - omega * <r0,t>
+            rho_old = rho;
+            rho     = r0r - omega * r0t;
+
+            // Check rho for zero
+            if(rho == static_cast<ValueType>(0))
+            {
+                LOG_INFO("MergedBiCGStab rho == 0 !!!");
+
+                res_norm = this->Norm_(*r);
+                this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_);
+
+                break;
+            }
+
+            // beta = (rho / rho_old) * (alpha / omega)
+            beta = (rho / rho_old) * (alpha / omega);
+
+            // p = beta * p - beta * omega * q + r
+            p->ScaleAdd2(beta, *q, -beta * omega, *r, static_cast<ValueType>(1));
+
+            // Mz = p
+            this->precond_->SolveZeroSol(*p, z);
+        }
+
+        log_debug(this, "MergedBiCGStab::SolvePrecond_()", " #*# end");
+    }
+
+    template class MergedBiCGStab<LocalMatrix<double>, LocalVector<double>, double>;
+    template class MergedBiCGStab<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class MergedBiCGStab<LocalMatrix<std::complex<double>>,
+                                  LocalVector<std::complex<double>>,
+                                  std::complex<double>>;
+    template class MergedBiCGStab<LocalMatrix<std::complex<float>>,
+                                  LocalVector<std::complex<float>>,
+                                  std::complex<float>>;
+#endif
+
+    template class MergedBiCGStab<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class MergedBiCGStab<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class MergedBiCGStab<GlobalMatrix<std::complex<double>>,
+                                  GlobalVector<std::complex<double>>,
+                                  std::complex<double>>;
+    template class MergedBiCGStab<GlobalMatrix<std::complex<float>>,
+                                  GlobalVector<std::complex<float>>,
+                                  std::complex<float>>;
+#endif
+
+    template class MergedBiCGStab<LocalStencil<double>, LocalVector<double>, double>;
+    template class MergedBiCGStab<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class MergedBiCGStab<LocalStencil<std::complex<double>>,
+                                  LocalVector<std::complex<double>>,
+                                  std::complex<double>>;
+    template class MergedBiCGStab<LocalStencil<std::complex<float>>,
+                                  LocalVector<std::complex<float>>,
+                                  std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,110 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_PIPELINED_CG_HPP_
+#define ROCALUTION_KRYLOV_PIPELINED_CG_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+#include <vector>
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class PipelinedCG
+  * \brief Pipelined Conjugate Gradient Method
+  * \details
+  * The pipelined Conjugate Gradient method is a mathematically equivalent reformulation
+  * of the (preconditioned) Conjugate Gradient method for solving sparse symmetric
+  * positive definite (SPD) linear systems \f$Ax=b\f$. By introducing auxiliary vectors,
+  * all dot products of an iteration are gathered into a single phase, whose global
+  * reductions are started without blocking and overlapped with the application of the
+  * preconditioner and the sparse matrix-vector product. This hides the latency of the
+  * global reductions on distributed systems, at the cost of additional vector updates
+  * and memory. Due to the longer recurrences, the attainable accuracy can be slightly
+  * lower compared to the classical CG method.
+  * \cite Ghysels2014
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class PipelinedCG : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        PipelinedCG();
+        ROCALUTION_EXPORT
+        virtual ~PipelinedCG();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        /** \brief Set the residual replacement period
+      * \details
+      * In finite precision, the recurrences of the pipelined method let the recursively
+      * updated residual deviate from the true residual. Every \p period iterations, the
+      * residual and the auxiliary vectors are therefore recomputed explicitly, at the
+      * cost of three additional operator and two additional preconditioner applications.
+      * Residual replacement is disabled, if \p period is set to 0. Default is 50.
+      */
+        ROCALUTION_EXPORT
+        void SetResidualReplacement(int period);
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+
+        ROCALUTION_EXPORT
+        virtual void BuildMoveToAcceleratorAsync(void);
+        ROCALUTION_EXPORT
+        virtual void Sync(void);
+
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        int replace_period_;
+
+        VectorType r_, u_, w_;
+        VectorType m_, n_;
+        VectorType p_, s_, q_, z_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_PIPELINED_CG_HPP_
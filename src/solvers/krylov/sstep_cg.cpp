@@ -0,0 +1,759 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "sstep_cg.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+#include "../../base/matrix_formats_ind.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <math.h>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SStepCG<OperatorType, VectorType, ValueType>::SStepCG()
+    {
+        log_debug(this, "SStepCG::SStepCG()", "default constructor");
+
+        this->step_size_ = 4;
+
+        this->V_  = NULL;
+        this->AV_ = NULL;
+        this->P_  = NULL;
+        this->AP_ = NULL;
+
+        this->W_  = NULL;
+        this->E_  = NULL;
+        this->C_  = NULL;
+        this->R_  = NULL;
+        this->Rp_ = NULL;
+        this->g_  = NULL;
+        this->h_  = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SStepCG<OperatorType, VectorType, ValueType>::~SStepCG()
+    {
+        log_debug(this, "SStepCG::~SStepCG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("SStepCG solver");
+        }
+        else
+        {
+            LOG_INFO("SStepCG solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("SStepCG(" << this->step_size_ << ") (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("SStepCG(" << this->step_size_ << ") solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("SStepCG(" << this->step_size_ << ") (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("SStepCG(" << this->step_size_ << ") ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "SStepCG::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() > 0);
+        assert(this->op_->GetM() == this->op_->GetN());
+
+        int s = this->step_size_;
+
+        allocate_host(s * s, &this->W_);
+        allocate_host(s * s, &this->E_);
+        allocate_host(s * s, &this->C_);
+        allocate_host(s * s, &this->R_);
+        allocate_host(s * s, &this->Rp_);
+        allocate_host(s, &this->g_);
+        allocate_host(s, &this->h_);
+
+        this->V_  = new VectorType*[s];
+        this->AV_ = new VectorType*[s];
+        this->P_  = new VectorType*[s];
+        this->AP_ = new VectorType*[s];
+
+        for(int i = 0; i < s; ++i)
+        {
+            this->V_[i]  = new VectorType;
+            this->AV_[i] = new VectorType;
+            this->P_[i]  = new VectorType;
+            this->AP_[i] = new VectorType;
+
+            this->V_[i]->CloneBackend(*this->op_);
+            this->AV_[i]->CloneBackend(*this->op_);
+            this->P_[i]->CloneBackend(*this->op_);
+            this->AP_[i]->CloneBackend(*this->op_);
+
+            this->V_[i]->Allocate("V", this->op_->GetM());
+            this->AV_[i]->Allocate("AV", this->op_->GetM());
+            this->P_[i]->Allocate("P", this->op_->GetM());
+            this->AP_[i]->Allocate("AP", this->op_->GetM());
+        }
+
+        this->r_.CloneBackend(*this->op_);
+        this->r_.Allocate("r", this->op_->GetM());
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+            this->precond_->Build();
+        }
+
+        this->build_ = true;
+
+        log_debug(this, "SStepCG::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "SStepCG::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            free_host(&this->W_);
+            free_host(&this->E_);
+            free_host(&this->C_);
+            free_host(&this->R_);
+            free_host(&this->Rp_);
+            free_host(&this->g_);
+            free_host(&this->h_);
+
+            for(int i = 0; i < this->step_size_; ++i)
+            {
+                delete this->V_[i];
+                delete this->AV_[i];
+                delete this->P_[i];
+                delete this->AP_[i];
+            }
+
+            delete[] this->V_;
+            delete[] this->AV_;
+            delete[] this->P_;
+            delete[] this->AP_;
+
+            this->V_  = NULL;
+            this->AV_ = NULL;
+            this->P_  = NULL;
+            this->AP_ = NULL;
+
+            this->r_.Clear();
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "SStepCG::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->step_size_; ++i)
+            {
+                this->V_[i]->Zeros();
+                this->AV_[i]->Zeros();
+                this->P_[i]->Zeros();
+                this->AP_[i]->Zeros();
+            }
+
+            this->r_.Zeros();
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "SStepCG::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->step_size_; ++i)
+            {
+                this->V_[i]->MoveToHost();
+                this->AV_[i]->MoveToHost();
+                this->P_[i]->MoveToHost();
+                this->AP_[i]->MoveToHost();
+            }
+
+            this->r_.MoveToHost();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "SStepCG::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->step_size_; ++i)
+            {
+                this->V_[i]->MoveToAccelerator();
+                this->AV_[i]->MoveToAccelerator();
+                this->P_[i]->MoveToAccelerator();
+                this->AP_[i]->MoveToAccelerator();
+            }
+
+            this->r_.MoveToAccelerator();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::SetStepSize(int s)
+    {
+        log_debug(this, "SStepCG::SetStepSize()", s);
+
+        assert(s > 0);
+        assert(s <= 10);
+        assert(this->build_ == false);
+
+        this->step_size_ = s;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                        VectorType*       x)
+    {
+        log_debug(this, "SStepCG::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ == NULL);
+        assert(this->build_ == true);
+
+        this->SolveSStep_(rhs, x);
+
+        log_debug(this, "SStepCG::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                     VectorType*       x)
+    {
+        log_debug(this, "SStepCG::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ != NULL);
+        assert(this->build_ == true);
+
+        this->SolveSStep_(rhs, x);
+
+        log_debug(this, "SStepCG::SolvePrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::ApplyPrecond_(const VectorType& in,
+                                                                     VectorType*       out)
+    {
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SolveZeroSol(in, out);
+        }
+        else
+        {
+            out->CopyFrom(in);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::SolveSStep_(const VectorType& rhs,
+                                                                   VectorType*       x)
+    {
+        const OperatorType* op = this->op_;
+
+        VectorType* r = &this->r_;
+
+        ValueType* W  = this->W_;
+        ValueType* E  = this->E_;
+        ValueType* C  = this->C_;
+        ValueType* R  = this->R_;
+        ValueType* Rp = this->Rp_;
+        ValueType* g  = this->g_;
+        ValueType* h  = this->h_;
+
+        int s = this->step_size_;
+
+        ValueType one = static_cast<ValueType>(1);
+        ValueType two = static_cast<ValueType>(2);
+
+        // Initial residual = b - Ax
+        op->Apply(*x, r);
+        r->ScaleAdd(-one, rhs);
+
+        // Initial residual norm |b-Ax0|
+        ValueType res_norm = this->Norm_(*r);
+
+        if(this->iter_ctrl_.InitResidual(std::abs(res_norm)) == false)
+        {
+            return;
+        }
+
+        // Estimate the spectral interval for the Chebyshev basis from s classical CG
+        // iterations, using Gershgorin's theorem on the Lanczos tridiagonal matrix
+        double lambda_min = 0.0;
+        double lambda_max = 0.0;
+
+        {
+            VectorType* z = this->V_[0];
+            VectorType* p = this->P_[0];
+            VectorType* q = this->AP_[0];
+
+            ValueType alpha, alpha_old = one;
+            ValueType beta, beta_old = static_cast<ValueType>(0);
+            ValueType rho, rho_old;
+            ValueType off_old = static_cast<ValueType>(0);
+
+            this->ApplyPrecond_(*r, z);
+            p->CopyFrom(*z);
+            rho = r->DotNonConj(*z);
+
+            for(int k = 0; k < s; ++k)
+            {
+                // q = Ap, alpha = rho / (p,q)
+                op->Apply(*p, q);
+                alpha = rho / p->DotNonConj(*q);
+
+                // x = x + alpha*p, r = r - alpha*q
+                x->AddScale(*p, alpha);
+                r->AddScale(*q, -alpha);
+
+                // Check convergence
+                res_norm = this->Norm_(*r);
+                if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+                {
+                    return;
+                }
+
+                this->ApplyPrecond_(*r, z);
+
+                rho_old = rho;
+                rho     = r->DotNonConj(*z);
+                beta    = rho / rho_old;
+
+                // Gershgorin disc of the k-th row of the Lanczos matrix
+                ValueType diag = one / alpha + beta_old / alpha_old;
+                ValueType off  = std::sqrt(beta) / alpha;
+
+                double radius = std::abs(off_old) + (k < s - 1 ? std::abs(off) : 0.0);
+
+                lambda_min = (k == 0) ? rocalution_double(diag) - radius
+                                      : std::min(lambda_min, rocalution_double(diag) - radius);
+                lambda_max = (k == 0) ? rocalution_double(diag) + radius
+                                      : std::max(lambda_max, rocalution_double(diag) + radius);
+
+                // p = z + beta*p
+                p->ScaleAdd(beta, *z);
+
+                alpha_old = alpha;
+                beta_old  = beta;
+                off_old   = off;
+            }
+        }
+
+        // Chebyshev basis on [lambda_min, lambda_max]
+        ValueType c = static_cast<ValueType>(0.5 * (lambda_max + lambda_min));
+        ValueType d = static_cast<ValueType>(0.5 * (lambda_max - lambda_min));
+
+        if(std::abs(d) <= rocalution_double(rocalution_eps<ValueType>()) * std::abs(c))
+        {
+            d = (std::abs(c) > 0.0) ? c : one;
+        }
+
+        // Number of search directions of the previous block
+        int np = 0;
+
+        // The residual of the first block has already been checked in the estimation phase
+        bool check = false;
+
+        ValueType rr;
+
+        while(true)
+        {
+            VectorType** V  = this->V_;
+            VectorType** AV = this->AV_;
+            VectorType** P  = this->P_;
+            VectorType** AP = this->AP_;
+
+            // Matrix powers kernel, V = [T_0(B)z, ..., T_s-1(B)z] with B = M^-1 A,
+            // z = M^-1 r and T_k the Chebyshev polynomials scaled to the interval
+            this->ApplyPrecond_(*r, V[0]);
+
+            for(int k = 0; k < s; ++k)
+            {
+                op->Apply(*V[k], AV[k]);
+
+                if(k < s - 1)
+                {
+                    this->ApplyPrecond_(*AV[k], V[k + 1]);
+
+                    if(k == 0)
+                    {
+                        // V_1 = (B - c) V_0 / d
+                        V[1]->ScaleAddScale(one / d, *V[0], -c / d);
+                    }
+                    else
+                    {
+                        // V_k+1 = 2 (B - c) V_k / d - V_k-1
+                        V[k + 1]->ScaleAdd2(two / d, *V[k], -two * c / d, *V[k - 1], -one);
+                    }
+                }
+            }
+
+            // Block reduction, all dot products are started at once and completed
+            // with a single synchronization
+            for(int j = 0; j < s; ++j)
+            {
+                // W = V^T AV (upper triangular part)
+                for(int i = 0; i <= j; ++i)
+                {
+                    V[i]->DotNonConjAsync(*AV[j], &W[DENSE_IND(i, j, s, s)]);
+                }
+
+                // E = AP^T V
+                for(int i = 0; i < np; ++i)
+                {
+                    AP[i]->DotNonConjAsync(*V[j], &E[DENSE_IND(i, j, s, s)]);
+                }
+
+                // g = V^T r
+                V[j]->DotNonConjAsync(*r, &g[j]);
+            }
+
+            // h = P^T r
+            for(int i = 0; i < np; ++i)
+            {
+                P[i]->DotNonConjAsync(*r, &h[i]);
+            }
+
+            // Residual norm
+            if(this->res_norm_type_ == 2)
+            {
+                r->DotAsync(*r, &rr);
+            }
+
+            for(int i = 0; i < s; ++i)
+            {
+                V[i]->DotSync();
+            }
+
+            for(int i = 0; i < np; ++i)
+            {
+                AP[i]->DotSync();
+                P[i]->DotSync();
+            }
+
+            r->DotSync();
+
+            // Check convergence
+            if(check == true)
+            {
+                res_norm = (this->res_norm_type_ == 2) ? std::sqrt(rr) : this->Norm_(*r);
+
+                if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
+                {
+                    break;
+                }
+            }
+
+            check = true;
+
+            // Gram matrix G = V^T A V, stored in R
+            for(int j = 0; j < s; ++j)
+            {
+                for(int i = 0; i <= j; ++i)
+                {
+                    R[DENSE_IND(i, j, s, s)] = W[DENSE_IND(i, j, s, s)];
+                }
+            }
+
+            // A-orthogonalize against the previous directions, C = (P^T A P)^-1 E,
+            // G = G - E^T C and g = g - C^T h
+            if(np > 0)
+            {
+                for(int j = 0; j < s; ++j)
+                {
+                    for(int i = 0; i < np; ++i)
+                    {
+                        C[DENSE_IND(i, j, s, s)] = E[DENSE_IND(i, j, s, s)];
+                    }
+
+                    this->CholeskySolve_(np, s, Rp, &C[DENSE_IND(0, j, s, s)]);
+
+                    for(int i = 0; i <= j; ++i)
+                    {
+                        for(int l = 0; l < np; ++l)
+                        {
+                            R[DENSE_IND(i, j, s, s)]
+                                -= E[DENSE_IND(l, i, s, s)] * C[DENSE_IND(l, j, s, s)];
+                        }
+                    }
+
+                    for(int l = 0; l < np; ++l)
+                    {
+                        g[j] -= C[DENSE_IND(l, j, s, s)] * h[l];
+                    }
+                }
+            }
+
+            // Factorize G = R^T R, basis vectors that are numerically dependent on the
+            // previous ones are dropped
+            int k = this->CholeskyFactorize_(s, s, R);
+
+            if(k == 0)
+            {
+                if(np == 0)
+                {
+                    LOG_INFO("SStepCG: breakdown of the Krylov basis");
+                    break;
+                }
+
+                // The recursively updated residual has lost its accuracy, restart from
+                // the true residual r = b - Ax
+                op->Apply(*x, r);
+                r->ScaleAdd(-one, rhs);
+
+                np = 0;
+
+                continue;
+            }
+
+            // Step length a = G^-1 g, stored in g
+            this->CholeskySolve_(k, s, R, g);
+
+            // New directions P = V - P_old C and AP = AV - AP_old C
+            for(int j = 0; j < k; ++j)
+            {
+                for(int i = 0; i < np; ++i)
+                {
+                    V[j]->AddScale(*P[i], -C[DENSE_IND(i, j, s, s)]);
+                    AV[j]->AddScale(*AP[i], -C[DENSE_IND(i, j, s, s)]);
+                }
+            }
+
+            std::swap(this->V_, this->P_);
+            std::swap(this->AV_, this->AP_);
+
+            std::swap(this->R_, this->Rp_);
+            R  = this->R_;
+            Rp = this->Rp_;
+
+            np = k;
+
+            // x = x + P a, r = r - AP a
+            for(int j = 0; j < k; ++j)
+            {
+                x->AddScale(*this->P_[j], g[j]);
+                r->AddScale(*this->AP_[j], -g[j]);
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    int SStepCG<OperatorType, VectorType, ValueType>::CholeskyFactorize_(int        n,
+                                                                         int        ld,
+                                                                         ValueType* A)
+    {
+        for(int j = 0; j < n; ++j)
+        {
+            ValueType diag = A[DENSE_IND(j, j, ld, ld)];
+
+            for(int l = 0; l < j; ++l)
+            {
+                diag -= A[DENSE_IND(l, j, ld, ld)] * A[DENSE_IND(l, j, ld, ld)];
+            }
+
+            // Stop at the first numerically non-positive pivot
+            if(rocalution_double(diag)
+               <= 10.0 * rocalution_double(rocalution_eps<ValueType>())
+                      * std::abs(A[DENSE_IND(j, j, ld, ld)]))
+            {
+                return j;
+            }
+
+            A[DENSE_IND(j, j, ld, ld)] = std::sqrt(diag);
+
+            for(int i = j + 1; i < n; ++i)
+            {
+                ValueType val = A[DENSE_IND(j, i, ld, ld)];
+
+                for(int l = 0; l < j; ++l)
+                {
+                    val -= A[DENSE_IND(l, j, ld, ld)] * A[DENSE_IND(l, i, ld, ld)];
+                }
+
+                A[DENSE_IND(j, i, ld, ld)] = val / A[DENSE_IND(j, j, ld, ld)];
+            }
+        }
+
+        return n;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepCG<OperatorType, VectorType, ValueType>::CholeskySolve_(int              n,
+                                                                      int              ld,
+                                                                      const ValueType* R,
+                                                                      ValueType*       b)
+    {
+        // Forward substitution R^T y = b
+        for(int i = 0; i < n; ++i)
+        {
+            for(int l = 0; l < i; ++l)
+            {
+                b[i] -= R[DENSE_IND(l, i, ld, ld)] * b[l];
+            }
+
+            b[i] /= R[DENSE_IND(i, i, ld, ld)];
+        }
+
+        // Backward substitution R x = y
+        for(int i = n - 1; i >= 0; --i)
+        {
+            for(int l = i + 1; l < n; ++l)
+            {
+                b[i] -= R[DENSE_IND(i, l, ld, ld)] * b[l];
+            }
+
+            b[i] /= R[DENSE_IND(i, i, ld, ld)];
+        }
+    }
+
+    template class SStepCG<LocalMatrix<double>, LocalVector<double>, double>;
+    template class SStepCG<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepCG<LocalMatrix<std::complex<double>>,
+                           LocalVector<std::complex<double>>,
+                           std::complex<double>>;
+    template class SStepCG<LocalMatrix<std::complex<float>>,
+                           LocalVector<std::complex<float>>,
+                           std::complex<float>>;
+#endif
+
+    template class SStepCG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class SStepCG<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepCG<GlobalMatrix<std::complex<double>>,
+                           GlobalVector<std::complex<double>>,
+                           std::complex<double>>;
+    template class SStepCG<GlobalMatrix<std::complex<float>>,
+                           GlobalVector<std::complex<float>>,
+                           std::complex<float>>;
+#endif
+
+    template class SStepCG<LocalStencil<double>, LocalVector<double>, double>;
+    template class SStepCG<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepCG<LocalStencil<std::complex<double>>,
+                           LocalVector<std::complex<double>>,
+                           std::complex<double>>;
+    template class SStepCG<LocalStencil<std::complex<float>>,
+                           LocalVector<std::complex<float>>,
+                           std::complex<float>>;
+#endif
+
+} // namespace rocalution
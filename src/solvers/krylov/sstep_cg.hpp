@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_SSTEP_CG_HPP_
+#define ROCALUTION_KRYLOV_SSTEP_CG_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+#include <vector>
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class SStepCG
+  * \brief Communication-avoiding s-step Conjugate Gradient Method
+  * \details
+  * The s-step Conjugate Gradient method is a block reformulation of the (preconditioned)
+  * Conjugate Gradient method for solving sparse symmetric positive definite (SPD) linear
+  * systems \f$Ax=b\f$. Each iteration generates \f$s\f$ Krylov basis vectors with a
+  * matrix powers kernel, using a Chebyshev polynomial basis for numerical stability.
+  * The basis is then made \f$A\f$-orthogonal to the previous search directions and
+  * the approximation is updated with a single block step. All dot products of the
+  * \f$s\f$ steps are gathered into one block reduction, which reduces the number of
+  * global synchronizations by a factor of \f$s\f$.
+  * \cite Chronopoulos1989
+  *
+  * The interval of the Chebyshev basis is estimated from \f$s\f$ classical CG
+  * iterations at the beginning of each solve. Afterwards, each iteration of the solver
+  * performs \f$s\f$ steps. Convergence is checked once per iteration, on the residual
+  * that is available at the block reduction. If the basis becomes numerically
+  * dependent, the solver restarts from the true residual. The step size can be set
+  * using SetStepSize(). The default step size is 4.
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class SStepCG : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        SStepCG();
+        ROCALUTION_EXPORT
+        virtual ~SStepCG();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Set the number of steps per iteration (between 1 and 10) */
+        ROCALUTION_EXPORT
+        void SetStepSize(int s);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        // s-step iteration, shared by the preconditioned and non-preconditioned solver
+        void SolveSStep_(const VectorType& rhs, VectorType* x);
+        // Apply the preconditioner, or copy if there is none
+        void ApplyPrecond_(const VectorType& in, VectorType* out);
+
+        // Cholesky factorization of the leading block of a symmetric matrix, returns the
+        // number of columns that could be factorized
+        static int CholeskyFactorize_(int n, int ld, ValueType* A);
+        // Solve R^T R x = b with upper triangular R
+        static void CholeskySolve_(int n, int ld, const ValueType* R, ValueType* b);
+
+        int step_size_;
+
+        VectorType r_;
+
+        VectorType** V_;
+        VectorType** AV_;
+        VectorType** P_;
+        VectorType** AP_;
+
+        ValueType* W_;
+        ValueType* E_;
+        ValueType* C_;
+        ValueType* R_;
+        ValueType* Rp_;
+        ValueType* g_;
+        ValueType* h_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_SSTEP_CG_HPP_
@@ -0,0 +1,898 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "sstep_gmres.hpp"
+#include "../../utils/def.hpp"
+#include "../iter_ctrl.hpp"
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+#include "../../base/matrix_formats_ind.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+
+#include "../../utils/allocate_free.hpp"
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <math.h>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SStepGMRES<OperatorType, VectorType, ValueType>::SStepGMRES()
+    {
+        log_debug(this, "SStepGMRES::SStepGMRES()", "default constructor");
+
+        this->size_basis_ = 30;
+        this->step_size_  = 4;
+
+        this->cheb_c_ = static_cast<ValueType>(0);
+        this->cheb_d_ = static_cast<ValueType>(1);
+
+        this->v_ = NULL;
+
+        this->c_  = NULL;
+        this->s_  = NULL;
+        this->r_  = NULL;
+        this->H_  = NULL;
+        this->HR_ = NULL;
+
+        this->X_  = NULL;
+        this->Xp_ = NULL;
+        this->G_  = NULL;
+        this->RB_ = NULL;
+        this->HB_ = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SStepGMRES<OperatorType, VectorType, ValueType>::~SStepGMRES()
+    {
+        log_debug(this, "SStepGMRES::~SStepGMRES()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("SStepGMRES solver");
+        }
+        else
+        {
+            LOG_INFO("SStepGMRES solver, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("SStepGMRES(" << this->size_basis_ << "," << this->step_size_
+                                   << ") (non-precond) linear solver starts");
+        }
+        else
+        {
+            LOG_INFO("SStepGMRES(" << this->size_basis_ << "," << this->step_size_
+                                   << ") solver starts, with preconditioner:");
+            this->precond_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        if(this->precond_ == NULL)
+        {
+            LOG_INFO("SStepGMRES(" << this->size_basis_ << "," << this->step_size_
+                                   << ") (non-precond) ends");
+        }
+        else
+        {
+            LOG_INFO("SStepGMRES(" << this->size_basis_ << "," << this->step_size_ << ") ends");
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "SStepGMRES::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() > 0);
+        assert(this->op_->GetM() == this->op_->GetN());
+        assert(this->size_basis_ > 0);
+
+        if(this->res_norm_type_ != 2)
+        {
+            LOG_INFO("SStepGMRES solver supports only L2 residual norm. The solver is switching "
+                     "to L2 norm");
+            this->res_norm_type_ = 2;
+        }
+
+        int m = this->size_basis_;
+        int s = this->step_size_;
+
+        allocate_host(m, &this->c_);
+        allocate_host(m, &this->s_);
+        allocate_host(m + 1, &this->r_);
+        allocate_host((m + 1) * m, &this->H_);
+        allocate_host((m + 1) * m, &this->HR_);
+
+        allocate_host((m + 1) * s, &this->X_);
+        allocate_host((m + 1) * s, &this->Xp_);
+        allocate_host(s * s, &this->G_);
+        allocate_host((m + 1) * (s + 1), &this->RB_);
+        allocate_host((m + 1) * s, &this->HB_);
+
+        this->v_ = new VectorType*[m + 1];
+
+        for(int i = 0; i < m + 1; ++i)
+        {
+            this->v_[i] = new VectorType;
+            this->v_[i]->CloneBackend(*this->op_);
+            this->v_[i]->Allocate("v", this->op_->GetM());
+        }
+
+        this->z_.CloneBackend(*this->op_);
+        this->z_.Allocate("z", this->op_->GetM());
+
+        if(this->precond_ != NULL)
+        {
+            this->precond_->SetOperator(*this->op_);
+            this->precond_->Build();
+        }
+
+        this->build_ = true;
+
+        log_debug(this, "SStepGMRES::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "SStepGMRES::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->precond_ != NULL)
+            {
+                this->precond_->Clear();
+                this->precond_ = NULL;
+            }
+
+            free_host(&this->c_);
+            free_host(&this->s_);
+            free_host(&this->r_);
+            free_host(&this->H_);
+            free_host(&this->HR_);
+
+            free_host(&this->X_);
+            free_host(&this->Xp_);
+            free_host(&this->G_);
+            free_host(&this->RB_);
+            free_host(&this->HB_);
+
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->Clear();
+                delete this->v_[i];
+            }
+            delete[] this->v_;
+            this->v_ = NULL;
+
+            this->z_.Clear();
+
+            this->iter_ctrl_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "SStepGMRES::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->Zeros();
+            }
+
+            this->z_.Zeros();
+
+            this->iter_ctrl_.Clear();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->ReBuildNumeric();
+            }
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "SStepGMRES::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->MoveToHost();
+            }
+
+            this->z_.MoveToHost();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->MoveToHost();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "SStepGMRES::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->size_basis_ + 1; ++i)
+            {
+                this->v_[i]->MoveToAccelerator();
+            }
+
+            this->z_.MoveToAccelerator();
+
+            if(this->precond_ != NULL)
+            {
+                this->precond_->MoveToAccelerator();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::SetBasisSize(int size_basis)
+    {
+        log_debug(this, "SStepGMRES::SetBasisSize()", size_basis);
+
+        assert(size_basis > 0);
+        assert(this->build_ == false);
+
+        this->size_basis_ = size_basis;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::SetStepSize(int s)
+    {
+        log_debug(this, "SStepGMRES::SetStepSize()", s);
+
+        assert(s > 0);
+        assert(s <= 10);
+        assert(this->build_ == false);
+
+        this->step_size_ = s;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::SolveNonPrecond_(const VectorType& rhs,
+                                                                           VectorType*       x)
+    {
+        log_debug(this, "SStepGMRES::SolveNonPrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ == NULL);
+        assert(this->build_ == true);
+        assert(this->res_norm_type_ == 2);
+
+        this->SolveSStep_(rhs, x);
+
+        log_debug(this, "SStepGMRES::SolveNonPrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::SolvePrecond_(const VectorType& rhs,
+                                                                        VectorType*       x)
+    {
+        log_debug(this, "SStepGMRES::SolvePrecond_()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->op_ != NULL);
+        assert(this->precond_ != NULL);
+        assert(this->build_ == true);
+        assert(this->res_norm_type_ == 2);
+
+        this->SolveSStep_(rhs, x);
+
+        log_debug(this, "SStepGMRES::SolvePrecond_()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::ApplyOperator_(const VectorType& in,
+                                                                         VectorType*       out)
+    {
+        if(this->precond_ != NULL)
+        {
+            this->op_->Apply(in, &this->z_);
+            this->precond_->SolveZeroSol(this->z_, out);
+        }
+        else
+        {
+            this->op_->Apply(in, out);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::ArnoldiStep_(int j)
+    {
+        VectorType** v = this->v_;
+        ValueType*   H = this->H_;
+
+        int ld = this->size_basis_ + 1;
+
+        // v_j+1 = M^-1 A v_j
+        this->ApplyOperator_(*v[j], v[j + 1]);
+
+        // Modified Gram-Schmidt
+        for(int k = 0; k <= j; ++k)
+        {
+            H[DENSE_IND(k, j, ld, ld)] = v[k]->Dot(*v[j + 1]);
+            v[j + 1]->AddScale(*v[k], -H[DENSE_IND(k, j, ld, ld)]);
+        }
+
+        H[DENSE_IND(j + 1, j, ld, ld)] = v[j + 1]->Norm();
+        v[j + 1]->Scale(static_cast<ValueType>(1) / H[DENSE_IND(j + 1, j, ld, ld)]);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    bool SStepGMRES<OperatorType, VectorType, ValueType>::BlockStep_(int j, int sb)
+    {
+        VectorType** v = this->v_;
+
+        ValueType* H  = this->H_;
+        ValueType* X  = this->X_;
+        ValueType* Xp = this->Xp_;
+        ValueType* G  = this->G_;
+        ValueType* RB = this->RB_;
+        ValueType* HB = this->HB_;
+
+        ValueType zero = static_cast<ValueType>(0);
+        ValueType one  = static_cast<ValueType>(1);
+        ValueType two  = static_cast<ValueType>(2);
+
+        ValueType c = this->cheb_c_;
+        ValueType d = this->cheb_d_;
+
+        int ld = this->size_basis_ + 1;
+        int s  = this->step_size_;
+
+        // Matrix powers kernel, p_k = T_k(B) v_j with B = M^-1 A and T_k the Chebyshev
+        // polynomials scaled to [c - d, c + d], stored in v_j+1, ..., v_j+sb
+        for(int k = 0; k < sb; ++k)
+        {
+            this->ApplyOperator_(*v[j + k], v[j + k + 1]);
+
+            if(k == 0)
+            {
+                v[j + 1]->ScaleAddScale(one / d, *v[j], -c / d);
+            }
+            else
+            {
+                v[j + k + 1]->ScaleAdd2(two / d, *v[j + k], -two * c / d, *v[j + k - 1], -one);
+            }
+        }
+
+        set_to_zero_host(ld * s, X);
+
+        // Block classical Gram-Schmidt with Pythagorean Cholesky QR, which needs a single
+        // block reduction. A second pass is performed if the Gram matrix turns out to be
+        // numerically indefinite.
+        bool success = false;
+
+        for(int pass = 0; pass < 2 && success == false; ++pass)
+        {
+            // Xp = V^H P and G = P^H P, all started at once
+            for(int i = 0; i < sb; ++i)
+            {
+                for(int l = 0; l <= j; ++l)
+                {
+                    v[l]->DotAsync(*v[j + 1 + i], &Xp[DENSE_IND(l, i, ld, s)]);
+                }
+
+                for(int k = i; k < sb; ++k)
+                {
+                    v[j + 1 + i]->DotAsync(*v[j + 1 + k], &G[DENSE_IND(i, k, s, s)]);
+                }
+            }
+
+            for(int l = 0; l <= j + sb; ++l)
+            {
+                v[l]->DotSync();
+            }
+
+            // P = P - V Xp, X = X + Xp and G = G - Xp^H Xp
+            for(int i = 0; i < sb; ++i)
+            {
+                for(int l = 0; l <= j; ++l)
+                {
+                    v[j + 1 + i]->AddScale(*v[l], -Xp[DENSE_IND(l, i, ld, s)]);
+                    X[DENSE_IND(l, i, ld, s)] += Xp[DENSE_IND(l, i, ld, s)];
+                }
+
+                for(int k = i; k < sb; ++k)
+                {
+                    for(int l = 0; l <= j; ++l)
+                    {
+                        G[DENSE_IND(i, k, s, s)] -= rocalution_conj(Xp[DENSE_IND(l, i, ld, s)])
+                                                    * Xp[DENSE_IND(l, k, ld, s)];
+                    }
+                }
+            }
+
+            // Cholesky factorization G = R^H R, R is stored in the upper part of G
+            success = true;
+
+            for(int k = 0; k < sb && success == true; ++k)
+            {
+                ValueType diag = G[DENSE_IND(k, k, s, s)];
+
+                for(int l = 0; l < k; ++l)
+                {
+                    diag -= rocalution_conj(G[DENSE_IND(l, k, s, s)]) * G[DENSE_IND(l, k, s, s)];
+                }
+
+                if(rocalution_double(diag) <= 10.0 * rocalution_double(rocalution_eps<ValueType>())
+                                                  * std::abs(G[DENSE_IND(k, k, s, s)]))
+                {
+                    success = false;
+                    break;
+                }
+
+                G[DENSE_IND(k, k, s, s)] = std::sqrt(diag);
+
+                for(int i = k + 1; i < sb; ++i)
+                {
+                    ValueType val = G[DENSE_IND(k, i, s, s)];
+
+                    for(int l = 0; l < k; ++l)
+                    {
+                        val -= rocalution_conj(G[DENSE_IND(l, k, s, s)]) * G[DENSE_IND(l, i, s, s)];
+                    }
+
+                    G[DENSE_IND(k, i, s, s)] = val / G[DENSE_IND(k, k, s, s)];
+                }
+            }
+        }
+
+        if(success == false)
+        {
+            return false;
+        }
+
+        // Orthonormal block P = P R^-1
+        for(int i = 0; i < sb; ++i)
+        {
+            for(int k = 0; k < i; ++k)
+            {
+                v[j + 1 + i]->AddScale(*v[j + 1 + k], -G[DENSE_IND(k, i, s, s)]);
+            }
+
+            v[j + 1 + i]->Scale(one / G[DENSE_IND(i, i, s, s)]);
+        }
+
+        // Change of basis [p_0, ..., p_sb] = V_j+sb RB, where p_0 = v_j
+        set_to_zero_host(ld * (s + 1), RB);
+
+        RB[DENSE_IND(j, 0, ld, s + 1)] = one;
+
+        for(int i = 1; i <= sb; ++i)
+        {
+            for(int l = 0; l <= j; ++l)
+            {
+                RB[DENSE_IND(l, i, ld, s + 1)] = X[DENSE_IND(l, i - 1, ld, s)];
+            }
+
+            for(int k = 1; k <= i; ++k)
+            {
+                RB[DENSE_IND(j + k, i, ld, s + 1)] = G[DENSE_IND(k - 1, i - 1, s, s)];
+            }
+        }
+
+        // With the Chebyshev recurrence B [p_0, ..., p_sb-1] = [p_0, ..., p_sb] T, the new
+        // columns of H are given by H = (RB T - H_old RB_old) T_1^-1, where RB_old are the
+        // first j rows and T_1 are the rows j, ..., j+sb-1 of the first sb columns of RB
+        for(int k = 0; k < sb; ++k)
+        {
+            for(int row = 0; row <= j + sb; ++row)
+            {
+                ValueType val = c * RB[DENSE_IND(row, k, ld, s + 1)];
+
+                if(k == 0)
+                {
+                    val += d * RB[DENSE_IND(row, 1, ld, s + 1)];
+                }
+                else
+                {
+                    val += d / two
+                           * (RB[DENSE_IND(row, k - 1, ld, s + 1)]
+                              + RB[DENSE_IND(row, k + 1, ld, s + 1)]);
+                }
+
+                HB[DENSE_IND(row, k, ld, s)] = val;
+            }
+
+            for(int row = 0; row <= j; ++row)
+            {
+                for(int l = std::max(row - 1, 0); l < j; ++l)
+                {
+                    HB[DENSE_IND(row, k, ld, s)]
+                        -= H[DENSE_IND(row, l, ld, ld)] * RB[DENSE_IND(l, k, ld, s + 1)];
+                }
+            }
+        }
+
+        for(int k = 0; k < sb; ++k)
+        {
+            for(int i = 0; i < k; ++i)
+            {
+                for(int row = 0; row <= j + sb; ++row)
+                {
+                    HB[DENSE_IND(row, k, ld, s)]
+                        -= HB[DENSE_IND(row, i, ld, s)] * RB[DENSE_IND(j + i, k, ld, s + 1)];
+                }
+            }
+
+            // Store column j+k of H, which is upper Hessenberg
+            for(int row = 0; row <= j + k + 1; ++row)
+            {
+                H[DENSE_IND(row, j + k, ld, ld)]
+                    = HB[DENSE_IND(row, k, ld, s)] / RB[DENSE_IND(j + k, k, ld, s + 1)];
+            }
+
+            for(int row = j + k + 2; row < ld; ++row)
+            {
+                H[DENSE_IND(row, j + k, ld, ld)] = zero;
+            }
+
+            for(int row = 0; row <= j + sb; ++row)
+            {
+                HB[DENSE_IND(row, k, ld, s)] = H[DENSE_IND(row, j + k, ld, ld)];
+            }
+        }
+
+        return true;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    bool SStepGMRES<OperatorType, VectorType, ValueType>::UpdateResidual_(int j)
+    {
+        ValueType* c  = this->c_;
+        ValueType* s  = this->s_;
+        ValueType* r  = this->r_;
+        ValueType* H  = this->H_;
+        ValueType* HR = this->HR_;
+
+        int ld = this->size_basis_ + 1;
+
+        // Copy column j of H, the block step requires the original Hessenberg matrix
+        for(int k = 0; k <= j + 1; ++k)
+        {
+            HR[DENSE_IND(k, j, ld, ld)] = H[DENSE_IND(k, j, ld, ld)];
+        }
+
+        // Apply Givens rotation J(0),...,J(j-1) on (H(0,j),...,H(j,j))
+        for(int k = 0; k < j; ++k)
+        {
+            this->ApplyGivensRotation_(
+                c[k], s[k], HR[DENSE_IND(k, j, ld, ld)], HR[DENSE_IND(k + 1, j, ld, ld)]);
+        }
+
+        // Construct J(j) and apply it such that H(j+1,j) = 0
+        this->GenerateGivensRotation_(
+            HR[DENSE_IND(j, j, ld, ld)], HR[DENSE_IND(j + 1, j, ld, ld)], c[j], s[j]);
+        this->ApplyGivensRotation_(
+            c[j], s[j], HR[DENSE_IND(j, j, ld, ld)], HR[DENSE_IND(j + 1, j, ld, ld)]);
+
+        // Apply J(j) to the norm of the residual
+        this->ApplyGivensRotation_(c[j], s[j], r[j], r[j + 1]);
+
+        // Check convergence
+        return this->iter_ctrl_.CheckResidual(std::abs(r[j + 1]));
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::SolveSStep_(const VectorType& rhs,
+                                                                      VectorType*       x)
+    {
+        const OperatorType* op = this->op_;
+
+        VectorType*  z = &this->z_;
+        VectorType** v = this->v_;
+
+        ValueType* r  = this->r_;
+        ValueType* H  = this->H_;
+        ValueType* HR = this->HR_;
+
+        ValueType one = static_cast<ValueType>(1);
+
+        int size = this->size_basis_;
+        int ld   = size + 1;
+        int s    = this->step_size_;
+
+        // The Chebyshev interval is estimated from the first s Arnoldi steps
+        bool estimated = false;
+
+        // Initial residual
+        op->Apply(*x, z);
+        z->ScaleAdd(-one, rhs);
+
+        if(this->precond_ != NULL)
+        {
+            // Solve Mv_0 = z
+            this->precond_->SolveZeroSol(*z, v[0]);
+        }
+        else
+        {
+            v[0]->CopyFrom(*z);
+        }
+
+        // r = 0
+        set_to_zero_host(size + 1, r);
+
+        // r_0 = ||v_0||
+        r[0] = this->Norm_(*v[0]);
+
+        // Initial residual
+        if(this->iter_ctrl_.InitResidual(std::abs(r[0])) == false)
+        {
+            return;
+        }
+
+        while(true)
+        {
+            // Normalize v_0
+            v[0]->Scale(one / r[0]);
+
+            bool converged = false;
+            bool arnoldi   = false;
+
+            int i = 0;
+            while(i < size && converged == false)
+            {
+                if(estimated == false || arnoldi == true)
+                {
+                    this->ArnoldiStep_(i);
+
+                    converged = this->UpdateResidual_(i++);
+                    arnoldi   = false;
+
+                    if(estimated == false && i == s)
+                    {
+                        // Gershgorin discs of the Hermitian part of the Hessenberg matrix
+                        double lambda_min = 0.0;
+                        double lambda_max = 0.0;
+
+                        for(int k = 0; k < s; ++k)
+                        {
+                            double radius = 0.0;
+
+                            for(int l = 0; l < s; ++l)
+                            {
+                                if(l != k)
+                                {
+                                    // Only the Hessenberg part of H is set
+                                    ValueType hkl = (k <= l + 1) ? H[DENSE_IND(k, l, ld, ld)]
+                                                                 : static_cast<ValueType>(0);
+                                    ValueType hlk = (l <= k + 1) ? H[DENSE_IND(l, k, ld, ld)]
+                                                                 : static_cast<ValueType>(0);
+
+                                    radius += 0.5 * std::abs(hkl + rocalution_conj(hlk));
+                                }
+                            }
+
+                            double center = rocalution_double(H[DENSE_IND(k, k, ld, ld)]);
+
+                            lambda_min = (k == 0) ? center - radius
+                                                  : std::min(lambda_min, center - radius);
+                            lambda_max = (k == 0) ? center + radius
+                                                  : std::max(lambda_max, center + radius);
+                        }
+
+                        this->cheb_c_ = static_cast<ValueType>(0.5 * (lambda_max + lambda_min));
+                        this->cheb_d_ = static_cast<ValueType>(0.5 * (lambda_max - lambda_min));
+
+                        if(std::abs(this->cheb_d_) <= rocalution_double(rocalution_eps<ValueType>())
+                                                          * std::abs(this->cheb_c_))
+                        {
+                            this->cheb_d_ = (std::abs(this->cheb_c_) > 0.0) ? this->cheb_c_ : one;
+                        }
+
+                        estimated = true;
+                    }
+                }
+                else
+                {
+                    int sb = std::min(s, size - i);
+
+                    if(this->BlockStep_(i, sb) == false)
+                    {
+                        // Fall back to a classical Arnoldi step
+                        arnoldi = true;
+                        continue;
+                    }
+
+                    for(int k = 0; k < sb && converged == false; ++k)
+                    {
+                        converged = this->UpdateResidual_(i++);
+                    }
+                }
+            }
+
+            // Solve upper triangular system
+            for(int j = i - 1; j >= 0; --j)
+            {
+                r[j] /= HR[DENSE_IND(j, j, ld, ld)];
+
+                for(int k = 0; k < j; ++k)
+                {
+                    r[k] -= HR[DENSE_IND(k, j, ld, ld)] * r[j];
+                }
+            }
+
+            // Update solution
+            for(int j = 0; j < i; ++j)
+            {
+                x->AddScale(*v[j], r[j]);
+            }
+
+            // Compute residual z = b - Ax
+            op->Apply(*x, z);
+            z->ScaleAdd(-one, rhs);
+
+            if(this->precond_ != NULL)
+            {
+                // Solve Mv_0 = z
+                this->precond_->SolveZeroSol(*z, v[0]);
+            }
+            else
+            {
+                v[0]->CopyFrom(*z);
+            }
+
+            // r = 0
+            set_to_zero_host(size + 1, r);
+
+            // r_0 = ||v_0||
+            r[0] = this->Norm_(*v[0]);
+
+            // Check convergence
+            if(this->iter_ctrl_.CheckResidualNoCount(std::abs(r[0])))
+            {
+                break;
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::GenerateGivensRotation_(ValueType  dx,
+                                                                                  ValueType  dy,
+                                                                                  ValueType& c,
+                                                                                  ValueType& s)
+    {
+        ValueType zero = static_cast<ValueType>(0);
+        ValueType one  = static_cast<ValueType>(1);
+
+        if(dy == zero)
+        {
+            c = one;
+            s = zero;
+        }
+        else if(dx == zero)
+        {
+            c = zero;
+            s = one;
+        }
+        else if(std::abs(dy) > std::abs(dx))
+        {
+            ValueType tmp = dx / dy;
+            s             = one / sqrt(one + tmp * tmp);
+            c             = tmp * s;
+        }
+        else
+        {
+            ValueType tmp = dy / dx;
+            c             = one / sqrt(one + tmp * tmp);
+            s             = tmp * c;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SStepGMRES<OperatorType, VectorType, ValueType>::ApplyGivensRotation_(ValueType  c,
+                                                                               ValueType  s,
+                                                                               ValueType& dx,
+                                                                               ValueType& dy)
+    {
+        ValueType temp = dx;
+        dx             = rocalution_conj(c) * dx + rocalution_conj(s) * dy;
+        dy             = -s * temp + c * dy;
+    }
+
+    template class SStepGMRES<LocalMatrix<double>, LocalVector<double>, double>;
+    template class SStepGMRES<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepGMRES<LocalMatrix<std::complex<double>>,
+                              LocalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class SStepGMRES<LocalMatrix<std::complex<float>>,
+                              LocalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+    template class SStepGMRES<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class SStepGMRES<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepGMRES<GlobalMatrix<std::complex<double>>,
+                              GlobalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class SStepGMRES<GlobalMatrix<std::complex<float>>,
+                              GlobalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+    template class SStepGMRES<LocalStencil<double>, LocalVector<double>, double>;
+    template class SStepGMRES<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SStepGMRES<LocalStencil<std::complex<double>>,
+                              LocalVector<std::complex<double>>,
+                              std::complex<double>>;
+    template class SStepGMRES<LocalStencil<std::complex<float>>,
+                              LocalVector<std::complex<float>>,
+                              std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_KRYLOV_SSTEP_GMRES_HPP_
+#define ROCALUTION_KRYLOV_SSTEP_GMRES_HPP_
+
+#include "../solver.hpp"
+#include "rocalution/export.hpp"
+
+#include <vector>
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class SStepGMRES
+  * \brief Communication-avoiding s-step Generalized Minimum Residual Method
+  * \details
+  * The s-step GMRES method is a reformulation of the restarted GMRES method for solving
+  * sparse (non) symmetric linear systems \f$Ax=b\f$. Instead of orthogonalizing each
+  * new Krylov vector individually, \f$s\f$ basis vectors are generated at once with a
+  * matrix powers kernel, using a Chebyshev polynomial basis for numerical stability.
+  * The block is then orthogonalized against the previous basis and within itself by
+  * block classical Gram-Schmidt and a Cholesky QR factorization, requiring a single
+  * block reduction. The Hessenberg matrix is recovered from the change of basis, such
+  * that the residual norm is still available after each step. This reduces the number
+  * of global synchronizations by a factor of \f$s\f$.
+  * \cite Hoemmen2010
+  *
+  * The interval of the Chebyshev basis is estimated from \f$s\f$ classical Arnoldi steps
+  * at the beginning of each solve. If the block orthogonalization breaks down, a
+  * classical Arnoldi step is performed instead. The Krylov subspace basis size can be
+  * set using SetBasisSize() and the step size using SetStepSize(). The default sizes
+  * are 30 and 4, respectively.
+  *
+  * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
+  * \tparam VectorType - can be LocalVector or GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class SStepGMRES : public IterativeLinearSolver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        SStepGMRES();
+        ROCALUTION_EXPORT
+        virtual ~SStepGMRES();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Set the size of the Krylov subspace basis */
+        ROCALUTION_EXPORT
+        void SetBasisSize(int size_basis);
+        /** \brief Set the number of basis vectors per block (between 1 and 10) */
+        ROCALUTION_EXPORT
+        void SetStepSize(int s);
+
+    protected:
+        virtual void SolveNonPrecond_(const VectorType& rhs, VectorType* x);
+        virtual void SolvePrecond_(const VectorType& rhs, VectorType* x);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+        /** \brief Generate Givens rotation */
+        static void GenerateGivensRotation_(ValueType dx, ValueType dy, ValueType& c, ValueType& s);
+        /** \brief Apply Givens rotation */
+        static void ApplyGivensRotation_(ValueType c, ValueType s, ValueType& dx, ValueType& dy);
+
+    private:
+        // s-step iteration, shared by the preconditioned and non-preconditioned solver
+        void SolveSStep_(const VectorType& rhs, VectorType* x);
+        // Apply the (preconditioned) operator, out = M^-1 A in
+        void ApplyOperator_(const VectorType& in, VectorType* out);
+
+        // Classical Arnoldi step, computes basis vector j+1 and column j of H
+        void ArnoldiStep_(int j);
+        // Block step, computes basis vectors j+1,...,j+sb and columns j,...,j+sb-1 of H.
+        // Returns false, if the block orthogonalization broke down
+        bool BlockStep_(int j, int sb);
+        // Apply Givens rotations to column j of H and check convergence
+        bool UpdateResidual_(int j);
+
+        int size_basis_;
+        int step_size_;
+
+        // Chebyshev basis parameters
+        ValueType cheb_c_;
+        ValueType cheb_d_;
+
+        VectorType** v_;
+        VectorType   z_;
+
+        ValueType* c_;
+        ValueType* s_;
+        ValueType* r_;
+        ValueType* H_;
+        ValueType* HR_;
+
+        ValueType* X_;
+        ValueType* Xp_;
+        ValueType* G_;
+        ValueType* RB_;
+        ValueType* HB_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_KRYLOV_SSTEP_GMRES_HPP_
@@ -35,10 +35,29 @@
 
 #include "../../utils/log.hpp"
 
+#include <algorithm>
 #include <list>
 
 namespace rocalution
 {
+    // Local operators are not distributed
+    template <typename ValueType>
+    static bool agglomerate_level(int64_t                 min_rows,
+                                  LocalMatrix<ValueType>* pro,
+                                  LocalMatrix<ValueType>* res,
+                                  LocalMatrix<ValueType>* coarse)
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    static bool agglomerate_level(int64_t                  min_rows,
+                                  GlobalMatrix<ValueType>* pro,
+                                  GlobalMatrix<ValueType>* res,
+                                  GlobalMatrix<ValueType>* coarse)
+    {
+        return coarse->Agglomerate(min_rows, res, pro);
+    }
 
     template <class OperatorType, class VectorType, typename ValueType>
     BaseAMG<OperatorType, VectorType, ValueType>::BaseAMG()
@@ -47,6 +66,9 @@ namespace rocalution
 
         this->coarse_size_ = 300;
 
+        // no coarse grid agglomeration
+        this->agglomeration_size_ = 0;
+
         // manual smoothers and coarse solver
         this->set_sm_ = false;
         this->set_s_  = false;
@@ -85,6 +107,18 @@ namespace rocalution
         this->coarse_size_ = coarse_size;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::SetAgglomeration(int min_rows)
+    {
+        log_debug(this, "BaseAMG::SetAgglomeration()", min_rows);
+
+        assert(this->build_ == false);
+        assert(this->hierarchy_ == false);
+        assert(min_rows >= 0);
+
+        this->agglomeration_size_ = min_rows;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseAMG<OperatorType, VectorType, ValueType>::SetManualSmoothers(bool sm_manual)
     {
@@ -237,6 +271,8 @@ namespace rocalution
             // The very first level is not allowed to fail
             assert(success == true);
 
+            this->Agglomerate_(prolong_list_.back(), restrict_list_.back(), op_list_.back());
+
             ++this->levels_;
 
             while(op_list_.back()->GetM() > static_cast<int64_t>(this->coarse_size_))
@@ -281,6 +317,8 @@ namespace rocalution
                     break;
                 }
 
+                this->Agglomerate_(prolong_list_.back(), restrict_list_.back(), op_list_.back());
+
                 ++this->levels_;
 
                 if(this->levels_ > 19)
@@ -399,6 +437,33 @@ namespace rocalution
         }
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::Agglomerate_(OperatorType* pro,
+                                                                    OperatorType* res,
+                                                                    OperatorType* coarse) const
+    {
+        log_debug(this, "BaseAMG::Agglomerate_()", pro, res, coarse);
+
+        assert(coarse != NULL);
+
+        if(this->agglomeration_size_ <= 0)
+        {
+            return;
+        }
+
+        // The coarsest level is gathered on a single process
+        int64_t min_rows = (coarse->GetM() <= static_cast<int64_t>(this->coarse_size_))
+                               ? std::max(coarse->GetM(), static_cast<int64_t>(1))
+                               : this->agglomeration_size_;
+
+        if(agglomerate_level(min_rows, pro, res, coarse) == true)
+        {
+            LOG_VERBOSE_INFO(2,
+                             "BaseAMG::Build() Agglomerated coarse level of size "
+                                 << coarse->GetM());
+        }
+    }
+
     // do nothing
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseAMG<OperatorType, VectorType, ValueType>::ClearLocal(void)
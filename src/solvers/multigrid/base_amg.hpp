@@ -91,6 +91,18 @@ namespace rocalution
         ROCALUTION_EXPORT
         void SetCoarsestLevel(int coarse_size);
 
+        /** \brief Set the minimal number of rows per process for coarse grid agglomeration
+      * \details
+      * If the processes that hold rows of a coarse level own less than \p min_rows rows
+      * on average, the level is redistributed onto fewer processes such that each of
+      * them holds at least \p min_rows rows, see GlobalMatrix::Agglomerate(). The
+      * restriction and prolongation operators are redistributed accordingly. The
+      * coarsest level is gathered on a single process. A value of 0 disables the
+      * agglomeration, which is the default. Has no effect for local operators.
+      */
+        ROCALUTION_EXPORT
+        void SetAgglomeration(int min_rows);
+
         /** \brief Set flag to pass smoothers manually for each level */
         ROCALUTION_EXPORT
         void SetManualSmoothers(bool sm_manual);
@@ -125,9 +137,17 @@ namespace rocalution
                                 LocalVector<int>*   trans)
             = 0;
 
+        /** \brief Redistributes the coarse operator and the transfer operators onto fewer
+      * processes, if agglomeration is enabled
+      */
+        void Agglomerate_(OperatorType* pro, OperatorType* res, OperatorType* coarse) const;
+
         /** \brief Maximal coarse grid size */
         int coarse_size_;
 
+        /** \brief Minimal number of rows per process for coarse grid agglomeration */
+        int agglomeration_size_;
+
         /** \brief Smoother is set manually or not */
         bool set_sm_;
         /** \brief Smoother hierarchy */
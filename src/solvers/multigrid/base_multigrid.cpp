@@ -26,6 +26,7 @@
 #include "../iter_ctrl.hpp"
 
 #include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
 #include "../../base/local_vector.hpp"
 
 #include "../../base/global_matrix.hpp"
@@ -58,6 +59,8 @@ namespace rocalution
         this->restrict_op_level_ = NULL;
         this->prolong_op_level_  = NULL;
 
+        this->trans_level_ = NULL;
+
         this->d_level_ = NULL;
         this->r_level_ = NULL;
         this->t_level_ = NULL;
@@ -364,12 +367,16 @@ namespace rocalution
         if(this->build_ == true)
         {
             // Clear transfer mapping
-            for(int i = 0; i < this->levels_ - 1; ++i)
+            if(this->trans_level_ != NULL)
             {
-                delete this->trans_level_[i];
-            }
+                for(int i = 0; i < this->levels_ - 1; ++i)
+                {
+                    delete this->trans_level_[i];
+                }
 
-            delete[] this->trans_level_;
+                delete[] this->trans_level_;
+                this->trans_level_ = NULL;
+            }
 
             // Clear temporary VectorTypes
             for(int i = 0; i < this->levels_; ++i)
@@ -1053,4 +1060,15 @@ namespace rocalution
                                  std::complex<float>>;
 #endif
 
+    template class BaseMultiGrid<LocalStencil<double>, LocalVector<double>, double>;
+    template class BaseMultiGrid<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class BaseMultiGrid<LocalStencil<std::complex<double>>,
+                                 LocalVector<std::complex<double>>,
+                                 std::complex<double>>;
+    template class BaseMultiGrid<LocalStencil<std::complex<float>>,
+                                 LocalVector<std::complex<float>>,
+                                 std::complex<float>>;
+#endif
+
 } // namespace rocalution
@@ -117,10 +117,10 @@ namespace rocalution
 
     protected:
         /** \brief Restricts a given fine vector to a coarse vector */
-        void Restrict_(const VectorType& fine, VectorType* coarse);
+        virtual void Restrict_(const VectorType& fine, VectorType* coarse);
 
         /** \brief Prolongs a given coarse vector to a fine vector */
-        void Prolong_(const VectorType& coarse, VectorType* fine);
+        virtual void Prolong_(const VectorType& coarse, VectorType* fine);
 
         /** \brief V-cycle */
         void Vcycle_(const VectorType& rhs, VectorType* x);
@@ -0,0 +1,424 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "geometric_multigrid.hpp"
+#include "../../utils/def.hpp"
+
+#include "../../base/local_stencil.hpp"
+#include "../../base/local_vector.hpp"
+
+#include "../chebyshev.hpp"
+#include "../krylov/cg.hpp"
+#include "../preconditioners/preconditioner.hpp"
+
+#include "../../utils/log.hpp"
+
+#include <complex>
+#include <list>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    GeometricMultiGrid<OperatorType, VectorType, ValueType>::GeometricMultiGrid()
+    {
+        log_debug(this, "GeometricMultiGrid::GeometricMultiGrid()", "default constructor");
+
+        this->coarse_size_ = 300;
+
+        // manual smoothers and coarse solver
+        this->set_sm_ = false;
+        this->set_s_  = false;
+
+        // default smoother type
+        this->sm_type_ = JacobiSmoother;
+
+        // since hierarchy has not been built yet
+        this->hierarchy_ = false;
+
+        // initialize temp default smoother pointer
+        this->sm_default_ = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    GeometricMultiGrid<OperatorType, VectorType, ValueType>::~GeometricMultiGrid()
+    {
+        log_debug(this, "GeometricMultiGrid::~GeometricMultiGrid()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("GMG solver");
+        LOG_INFO("GMG number of levels " << this->levels_);
+        LOG_INFO("GMG coarsest operator size = " << this->op_level_[this->levels_ - 2]->GetM());
+        LOG_INFO("GMG with smoother:");
+        this->smoother_level_[0]->Print();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        assert(this->levels_ > 0);
+
+        LOG_INFO("GMG solver starts");
+        LOG_INFO("GMG number of levels " << this->levels_);
+        LOG_INFO("GMG coarsest operator size = " << this->op_level_[this->levels_ - 2]->GetM());
+        LOG_INFO("GMG with smoother:");
+        this->smoother_level_[0]->Print();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        LOG_INFO("GMG ends");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::SetCoarsestLevel(int coarse_size)
+    {
+        log_debug(this, "GeometricMultiGrid::SetCoarsestLevel()", coarse_size);
+
+        assert(this->build_ == false);
+        assert(this->hierarchy_ == false);
+        assert(coarse_size > 0);
+
+        this->coarse_size_ = coarse_size;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::SetManualSmoothers(bool sm_manual)
+    {
+        log_debug(this, "GeometricMultiGrid::SetManualSmoothers()", sm_manual);
+
+        assert(this->build_ == false);
+
+        this->set_sm_ = sm_manual;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::SetManualSolver(bool s_manual)
+    {
+        log_debug(this, "GeometricMultiGrid::SetManualSolver()", s_manual);
+
+        assert(this->build_ == false);
+
+        this->set_s_ = s_manual;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::SetSmootherType(
+        unsigned int smoother_type)
+    {
+        log_debug(this, "GeometricMultiGrid::SetSmootherType()", smoother_type);
+
+        assert(this->build_ == false);
+        assert(smoother_type == JacobiSmoother || smoother_type == ChebyshevSmoother);
+
+        this->sm_type_ = smoother_type;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    int GeometricMultiGrid<OperatorType, VectorType, ValueType>::GetNumLevels(void)
+    {
+        assert(this->hierarchy_ != false);
+
+        return this->levels_;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "GeometricMultiGrid::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+
+        // Build hierarchy
+        this->BuildHierarchy();
+
+        // Build smoothers, if not passed by the user
+        if(this->set_sm_ == false)
+        {
+            this->BuildSmoothers();
+        }
+
+        // Build coarse grid solver, if not passed by the user
+        if(this->set_s_ == false)
+        {
+            // Coarse Grid Solver
+            CG<OperatorType, VectorType, ValueType>* cgs
+                = new CG<OperatorType, VectorType, ValueType>;
+
+            // Set absolute tolerance to 0 to avoid issues with very small numbers
+            cgs->Init(0.0, 1e-6, 1e+8, 1000);
+
+            // No verbose output
+            cgs->Verbose(0);
+
+            this->solver_coarse_ = cgs;
+        }
+
+        // Initialize multigrid structures
+        this->Initialize();
+
+        this->build_ = true;
+
+        log_debug(this, "GeometricMultiGrid::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::BuildHierarchy(void)
+    {
+        log_debug(this, "GeometricMultiGrid::BuildHierarchy()", " #*# begin");
+
+        if(this->hierarchy_ == false)
+        {
+            assert(this->build_ == false);
+            this->hierarchy_ = true;
+
+            assert(this->op_ != NULL);
+            assert(this->coarse_size_ > 0);
+
+            if(this->op_->GetM() <= static_cast<int64_t>(this->coarse_size_)
+               || this->op_->GetGrid() < 3)
+            {
+                LOG_INFO("Problem size too small for GMG, use Krylov solver instead");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            // Coarsen the stencil until the requested coarse grid size is reached
+            std::list<OperatorType*> op_list_;
+
+            const OperatorType* prev_op_ = this->op_;
+
+            this->levels_ = 1;
+
+            while(prev_op_->GetM() > static_cast<int64_t>(this->coarse_size_)
+                  && prev_op_->GetGrid() >= 3)
+            {
+                op_list_.push_back(new OperatorType(prev_op_->GetStencilId()));
+                prev_op_->Coarsen(op_list_.back());
+
+                prev_op_ = op_list_.back();
+
+                ++this->levels_;
+
+                if(this->levels_ > 19)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: GeometricMultiGrid::Build() Current number of "
+                                     "levels: "
+                                         << this->levels_);
+                }
+            }
+
+            // Allocate data structures
+            this->op_level_          = new OperatorType*[this->levels_ - 1];
+            this->restrict_op_level_ = new OperatorType*[this->levels_ - 1];
+            this->prolong_op_level_  = new OperatorType*[this->levels_ - 1];
+
+            typename std::list<OperatorType*>::iterator op_it = op_list_.begin();
+
+            for(int i = 0; i < this->levels_ - 1; ++i)
+            {
+                this->op_level_[i] = *op_it;
+                ++op_it;
+
+                // Intergrid transfers are performed matrix-free by the stencil of the
+                // finer level, no transfer operators are stored
+                OperatorType* fine_op_
+                    = (i == 0) ? const_cast<OperatorType*>(this->op_) : this->op_level_[i - 1];
+
+                this->restrict_op_level_[i] = fine_op_;
+                this->prolong_op_level_[i]  = fine_op_;
+            }
+        }
+
+        log_debug(this, "GeometricMultiGrid::BuildHierarchy()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::BuildSmoothers(void)
+    {
+        log_debug(this, "GeometricMultiGrid::BuildSmoothers()", " #*# begin");
+
+        // Smoother for each level
+        this->smoother_level_
+            = new IterativeLinearSolver<OperatorType, VectorType, ValueType>*[this->levels_ - 1];
+        this->sm_default_ = new Solver<OperatorType, VectorType, ValueType>*[this->levels_ - 1];
+
+        for(int i = 0; i < this->levels_ - 1; ++i)
+        {
+            Jacobi<OperatorType, VectorType, ValueType>* jac
+                = new Jacobi<OperatorType, VectorType, ValueType>;
+
+            if(this->sm_type_ == ChebyshevSmoother)
+            {
+                Chebyshev<OperatorType, VectorType, ValueType>* sm
+                    = new Chebyshev<OperatorType, VectorType, ValueType>;
+
+                // The spectrum of the Jacobi preconditioned stencils is bounded by 2,
+                // smooth on its upper part
+                sm->Set(static_cast<ValueType>(0.6), static_cast<ValueType>(2));
+                sm->SetPreconditioner(*jac);
+                sm->Verbose(0);
+                this->smoother_level_[i] = sm;
+            }
+            else
+            {
+                FixedPoint<OperatorType, VectorType, ValueType>* sm
+                    = new FixedPoint<OperatorType, VectorType, ValueType>;
+
+                sm->SetRelaxation(static_cast<ValueType>(2.f / 3.f));
+                sm->SetPreconditioner(*jac);
+                sm->Verbose(0);
+                this->smoother_level_[i] = sm;
+            }
+
+            this->sm_default_[i] = jac;
+        }
+
+        log_debug(this, "GeometricMultiGrid::BuildSmoothers()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "GeometricMultiGrid::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            // Uninitialize multigrid structures
+            this->Finalize();
+
+            // De-allocate operator data structures, transfer operators are not owned
+            for(int i = 0; i < this->levels_ - 1; ++i)
+            {
+                delete this->op_level_[i];
+            }
+
+            delete[] this->op_level_;
+            delete[] this->restrict_op_level_;
+            delete[] this->prolong_op_level_;
+
+            this->op_level_          = NULL;
+            this->restrict_op_level_ = NULL;
+            this->prolong_op_level_  = NULL;
+
+            // De-allocate smoothers, if not allocated by the user
+            if(this->set_sm_ == false)
+            {
+                for(int i = 0; i < this->levels_ - 1; ++i)
+                {
+                    delete this->smoother_level_[i];
+                    delete this->sm_default_[i];
+                }
+
+                delete[] this->smoother_level_;
+                delete[] this->sm_default_;
+
+                this->smoother_level_ = NULL;
+                this->sm_default_     = NULL;
+            }
+
+            // De-allocate coarse grid solver, if not allocated by user
+            if(this->set_s_ == false)
+            {
+                delete this->solver_coarse_;
+                this->solver_coarse_ = NULL;
+            }
+
+            this->levels_    = -1;
+            this->build_     = false;
+            this->hierarchy_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::Restrict_(
+        const VectorType& fine, VectorType* coarse)
+    {
+        log_debug(this, "GeometricMultiGrid::Restrict_()", (const void*&)fine, coarse);
+
+        this->restrict_op_level_[this->current_level_]->Restriction(fine, coarse);
+
+        // The stencils are not scaled by the mesh size, thus the coarse grid equation
+        // picks up the factor (H/h)^2 = 4
+        coarse->Scale(static_cast<ValueType>(4));
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::Prolong_(
+        const VectorType& coarse, VectorType* fine)
+    {
+        log_debug(this, "GeometricMultiGrid::Prolong_()", (const void*&)coarse, fine);
+
+        this->prolong_op_level_[this->current_level_]->Prolongation(coarse, fine);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::SetRestrictOperator(
+        OperatorType** op)
+    {
+        LOG_INFO("GeometricMultiGrid::SetRestrictOperator() Perhaps you want to use the MultiGrid "
+                 "class to set external restriction operators");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::SetProlongOperator(
+        OperatorType** op)
+    {
+        LOG_INFO("GeometricMultiGrid::SetProlongOperator() Perhaps you want to use the MultiGrid "
+                 "class to set external prolongation operators");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GeometricMultiGrid<OperatorType, VectorType, ValueType>::SetOperatorHierarchy(
+        OperatorType** op)
+    {
+        LOG_INFO("GeometricMultiGrid::SetOperatorHierarchy() Perhaps you want to use the "
+                 "MultiGrid class to set external operators");
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template class GeometricMultiGrid<LocalStencil<double>, LocalVector<double>, double>;
+    template class GeometricMultiGrid<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class GeometricMultiGrid<LocalStencil<std::complex<double>>,
+                                      LocalVector<std::complex<double>>,
+                                      std::complex<double>>;
+    template class GeometricMultiGrid<LocalStencil<std::complex<float>>,
+                                      LocalVector<std::complex<float>>,
+                                      std::complex<float>>;
+#endif
+
+} // namespace rocalution
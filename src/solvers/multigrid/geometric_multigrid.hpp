@@ -0,0 +1,139 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_GEOMETRIC_MULTIGRID_HPP_
+#define ROCALUTION_GEOMETRIC_MULTIGRID_HPP_
+
+#include "../solver.hpp"
+#include "base_multigrid.hpp"
+#include "rocalution/export.hpp"
+
+namespace rocalution
+{
+    typedef enum _gmg_smoother
+    {
+        JacobiSmoother    = 0,
+        ChebyshevSmoother = 1
+    } GMGSmoother;
+
+    /** \ingroup solver_module
+  * \class GeometricMultiGrid
+  * \brief Geometric MultiGrid Method
+  * \details
+  * The Geometric MultiGrid method works directly on structured LocalStencil operators,
+  * without assembling any matrices. The grid hierarchy is created by stencil coarsening,
+  * where each coarse grid consists of every second grid point of the next finer grid.
+  * Intergrid transfers are matrix-free full weighting restriction and linear
+  * interpolation. Thus, the memory footprint of the hierarchy is proportional to the
+  * vectors only.
+  * - Smoothers are damped Jacobi (default) or Jacobi preconditioned Chebyshev
+  *   iterations. They can also be passed to the solver manually.
+  * - The coarse grid solver is CG by default.
+  * \cite Trottenberg2003
+  *
+  * \tparam OperatorType - can be LocalStencil
+  * \tparam VectorType - can be LocalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class GeometricMultiGrid : public BaseMultiGrid<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        GeometricMultiGrid();
+        ROCALUTION_EXPORT
+        virtual ~GeometricMultiGrid();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Create the grid hierarchy */
+        ROCALUTION_EXPORT
+        virtual void BuildHierarchy(void);
+
+        /** \brief Create the default smoothers */
+        virtual void BuildSmoothers(void);
+
+        /** \brief Set coarsest level for hierarchy creation */
+        ROCALUTION_EXPORT
+        void SetCoarsestLevel(int coarse_size);
+
+        /** \brief Set flag to pass smoothers manually for each level */
+        ROCALUTION_EXPORT
+        void SetManualSmoothers(bool sm_manual);
+        /** \brief Set flag to pass coarse grid solver manually */
+        ROCALUTION_EXPORT
+        void SetManualSolver(bool s_manual);
+
+        /** \brief Set the type of the default smoothers
+        * \details
+        * \p JacobiSmoother uses damped Jacobi iterations with relaxation parameter 2/3.
+        * \p ChebyshevSmoother uses Jacobi preconditioned Chebyshev iterations on the
+        * upper part of the spectrum of the Jacobi preconditioned operator.
+        */
+        ROCALUTION_EXPORT
+        void SetSmootherType(unsigned int smoother_type);
+
+        /** \brief Returns the number of levels in hierarchy */
+        ROCALUTION_EXPORT
+        int GetNumLevels(void);
+
+        /** \private */
+        virtual void SetRestrictOperator(OperatorType** op);
+        /** \private */
+        virtual void SetProlongOperator(OperatorType** op);
+        /** \private */
+        virtual void SetOperatorHierarchy(OperatorType** op);
+
+    protected:
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void Restrict_(const VectorType& fine, VectorType* coarse);
+        virtual void Prolong_(const VectorType& coarse, VectorType* fine);
+
+        /** \brief Maximal coarse grid size */
+        int coarse_size_;
+
+        /** \brief Smoother is set manually or not */
+        bool set_sm_;
+        /** \brief Smoother hierarchy */
+        Solver<OperatorType, VectorType, ValueType>** sm_default_;
+        /** \brief Type of the default smoothers */
+        unsigned int sm_type_;
+
+        /** \brief Coarse grid solver is set manually or not */
+        bool set_s_;
+
+        /** \brief Build flag for hierarchy */
+        bool hierarchy_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_GEOMETRIC_MULTIGRID_HPP_
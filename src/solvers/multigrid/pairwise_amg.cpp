@@ -163,6 +163,8 @@ namespace rocalution
                                    this->rG_level_[0],
                                    this->rGsize_level_[0]);
 
+        this->Agglomerate_(NULL, NULL, this->op_level_[0]);
+
         for(int i = 1; i < this->levels_ - 1; ++i)
         {
             this->op_level_[i]->Clear();
@@ -183,6 +185,8 @@ namespace rocalution
                                                     this->rG_level_[i],
                                                     this->rGsize_level_[i]);
 
+            this->Agglomerate_(NULL, NULL, this->op_level_[i]);
+
             if(i == this->levels_ - this->host_level_ - 1)
             {
                 this->op_level_[i - 1]->CloneBackend(*this->restrict_op_level_[i - 1]);
@@ -24,6 +24,8 @@
 #include "smoothed_amg.hpp"
 #include "../../utils/def.hpp"
 
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
 #include "../../base/local_matrix.hpp"
 #include "../../base/local_vector.hpp"
 
@@ -36,6 +38,83 @@
 namespace rocalution
 {
 
+    // Smoothed aggregation prolongation of a local operator
+    template <typename ValueType>
+    static void smoothed_aggregation(const LocalMatrix<ValueType>& op,
+                                     ValueType                     eps,
+                                     ValueType                     relax,
+                                     CoarseningStrategy            strat,
+                                     LumpingStrategy               lumping_strat,
+                                     LocalMatrix<ValueType>*       pro)
+    {
+        LocalVector<int> connections;
+        LocalVector<int> aggregates;
+
+        connections.CloneBackend(op);
+        aggregates.CloneBackend(op);
+
+        op.AMGConnect(eps, &connections);
+
+        if(strat == CoarseningStrategy::Greedy)
+        {
+            op.AMGAggregate(connections, &aggregates);
+        }
+        else if(strat == CoarseningStrategy::PMIS)
+        {
+            op.AMGPMISAggregate(connections, &aggregates);
+        }
+
+        if(lumping_strat == LumpingStrategy::AddWeakConnections)
+        {
+            op.AMGSmoothedAggregation(relax, aggregates, connections, pro, 0);
+        }
+        else if(lumping_strat == LumpingStrategy::SubtractWeakConnections)
+        {
+            op.AMGSmoothedAggregation(relax, aggregates, connections, pro, 1);
+        }
+    }
+
+    // Smoothed aggregation prolongation of a global operator, aggregates are identified by
+    // their global index and might span multiple processes
+    template <typename ValueType>
+    static void smoothed_aggregation(const GlobalMatrix<ValueType>& op,
+                                     ValueType                      eps,
+                                     ValueType                      relax,
+                                     CoarseningStrategy             strat,
+                                     LumpingStrategy                lumping_strat,
+                                     GlobalMatrix<ValueType>*       pro)
+    {
+        LocalVector<int>     connections;
+        LocalVector<int64_t> aggregates;
+        LocalVector<int64_t> aggregate_root_nodes;
+
+        connections.CloneBackend(op);
+        aggregates.CloneBackend(op);
+        aggregate_root_nodes.CloneBackend(op);
+
+        op.AMGConnect(eps, &connections);
+
+        if(strat == CoarseningStrategy::Greedy)
+        {
+            op.AMGAggregate(connections, &aggregates, &aggregate_root_nodes);
+        }
+        else if(strat == CoarseningStrategy::PMIS)
+        {
+            op.AMGPMISAggregate(connections, &aggregates, &aggregate_root_nodes);
+        }
+
+        if(lumping_strat == LumpingStrategy::AddWeakConnections)
+        {
+            op.AMGSmoothedAggregation(
+                relax, aggregates, aggregate_root_nodes, connections, pro, 0);
+        }
+        else if(lumping_strat == LumpingStrategy::SubtractWeakConnections)
+        {
+            op.AMGSmoothedAggregation(
+                relax, aggregates, aggregate_root_nodes, connections, pro, 1);
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     SAAMG<OperatorType, VectorType, ValueType>::SAAMG()
     {
@@ -251,41 +330,13 @@ namespace rocalution
         assert(res != NULL);
         assert(coarse != NULL);
 
-        LocalVector<int> connections;
-        LocalVector<int> aggregates;
-
-        connections.CloneBackend(op);
-        aggregates.CloneBackend(op);
-
         ValueType eps = this->eps_;
         for(int i = 0; i < this->levels_ - 1; ++i)
         {
             eps *= static_cast<ValueType>(0.5);
         }
 
-        op.AMGConnect(eps, &connections);
-
-        if(strat_ == CoarseningStrategy::Greedy)
-        {
-            op.AMGAggregate(connections, &aggregates);
-        }
-        else if(strat_ == CoarseningStrategy::PMIS)
-        {
-            op.AMGPMISAggregate(connections, &aggregates);
-        }
-
-        if(lumping_strat_ == LumpingStrategy::AddWeakConnections)
-        {
-            op.AMGSmoothedAggregation(this->relax_, aggregates, connections, pro, 0);
-        }
-        else if(lumping_strat_ == LumpingStrategy::SubtractWeakConnections)
-        {
-            op.AMGSmoothedAggregation(this->relax_, aggregates, connections, pro, 1);
-        }
-
-        // Free unused vectors
-        connections.Clear();
-        aggregates.Clear();
+        smoothed_aggregation(op, eps, this->relax_, this->strat_, this->lumping_strat_, pro);
 
         // Transpose P to obtain R
         pro->Transpose(res);
@@ -299,6 +350,8 @@ namespace rocalution
 
     template class SAAMG<LocalMatrix<double>, LocalVector<double>, double>;
     template class SAAMG<LocalMatrix<float>, LocalVector<float>, float>;
+    template class SAAMG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class SAAMG<GlobalMatrix<float>, GlobalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
     template class SAAMG<LocalMatrix<std::complex<double>>,
                          LocalVector<std::complex<double>>,
@@ -306,6 +359,12 @@ namespace rocalution
     template class SAAMG<LocalMatrix<std::complex<float>>,
                          LocalVector<std::complex<float>>,
                          std::complex<float>>;
+    template class SAAMG<GlobalMatrix<std::complex<double>>,
+                         GlobalVector<std::complex<double>>,
+                         std::complex<double>>;
+    template class SAAMG<GlobalMatrix<std::complex<float>>,
+                         GlobalVector<std::complex<float>>,
+                         std::complex<float>>;
 #endif
 
 } // namespace rocalution
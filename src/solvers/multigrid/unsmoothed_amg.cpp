@@ -24,6 +24,8 @@
 #include "unsmoothed_amg.hpp"
 #include "../../utils/def.hpp"
 
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
 #include "../../base/local_matrix.hpp"
 #include "../../base/local_vector.hpp"
 
@@ -35,6 +37,63 @@
 namespace rocalution
 {
 
+    // Unsmoothed aggregation prolongation of a local operator
+    template <typename ValueType>
+    static void unsmoothed_aggregation(const LocalMatrix<ValueType>& op,
+                                       ValueType                     eps,
+                                       CoarseningStrategy            strat,
+                                       LocalMatrix<ValueType>*       pro)
+    {
+        LocalVector<int> connections;
+        LocalVector<int> aggregates;
+
+        connections.CloneBackend(op);
+        aggregates.CloneBackend(op);
+
+        op.AMGConnect(eps, &connections);
+
+        if(strat == CoarseningStrategy::Greedy)
+        {
+            op.AMGAggregate(connections, &aggregates);
+        }
+        else if(strat == CoarseningStrategy::PMIS)
+        {
+            op.AMGPMISAggregate(connections, &aggregates);
+        }
+
+        op.AMGAggregation(aggregates, pro);
+    }
+
+    // Unsmoothed aggregation prolongation of a global operator, aggregates are identified by
+    // their global index and might span multiple processes
+    template <typename ValueType>
+    static void unsmoothed_aggregation(const GlobalMatrix<ValueType>& op,
+                                       ValueType                      eps,
+                                       CoarseningStrategy             strat,
+                                       GlobalMatrix<ValueType>*       pro)
+    {
+        LocalVector<int>     connections;
+        LocalVector<int64_t> aggregates;
+        LocalVector<int64_t> aggregate_root_nodes;
+
+        connections.CloneBackend(op);
+        aggregates.CloneBackend(op);
+        aggregate_root_nodes.CloneBackend(op);
+
+        op.AMGConnect(eps, &connections);
+
+        if(strat == CoarseningStrategy::Greedy)
+        {
+            op.AMGAggregate(connections, &aggregates, &aggregate_root_nodes);
+        }
+        else if(strat == CoarseningStrategy::PMIS)
+        {
+            op.AMGPMISAggregate(connections, &aggregates, &aggregate_root_nodes);
+        }
+
+        op.AMGAggregation(aggregates, aggregate_root_nodes, pro);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     UAAMG<OperatorType, VectorType, ValueType>::UAAMG()
     {
@@ -211,34 +270,13 @@ namespace rocalution
         assert(res != NULL);
         assert(coarse != NULL);
 
-        LocalVector<int> connections;
-        LocalVector<int> aggregates;
-
-        connections.CloneBackend(op);
-        aggregates.CloneBackend(op);
-
         ValueType eps = this->eps_;
         for(int i = 0; i < this->levels_ - 1; ++i)
         {
             eps *= static_cast<ValueType>(0.5);
         }
 
-        op.AMGConnect(eps, &connections);
-
-        if(strat_ == CoarseningStrategy::Greedy)
-        {
-            op.AMGAggregate(connections, &aggregates);
-        }
-        else if(strat_ == CoarseningStrategy::PMIS)
-        {
-            op.AMGPMISAggregate(connections, &aggregates);
-        }
-
-        op.AMGAggregation(aggregates, pro);
-
-        // Free unused vectors
-        connections.Clear();
-        aggregates.Clear();
+        unsmoothed_aggregation(op, eps, this->strat_, pro);
 
         // Transpose P to obtain R
         pro->Transpose(res);
@@ -257,6 +295,8 @@ namespace rocalution
 
     template class UAAMG<LocalMatrix<double>, LocalVector<double>, double>;
     template class UAAMG<LocalMatrix<float>, LocalVector<float>, float>;
+    template class UAAMG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class UAAMG<GlobalMatrix<float>, GlobalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
     template class UAAMG<LocalMatrix<std::complex<double>>,
                          LocalVector<std::complex<double>>,
@@ -264,6 +304,12 @@ namespace rocalution
     template class UAAMG<LocalMatrix<std::complex<float>>,
                          LocalVector<std::complex<float>>,
                          std::complex<float>>;
+    template class UAAMG<GlobalMatrix<std::complex<double>>,
+                         GlobalVector<std::complex<double>>,
+                         std::complex<double>>;
+    template class UAAMG<GlobalMatrix<std::complex<float>>,
+                         GlobalVector<std::complex<float>>,
+                         std::complex<float>>;
 #endif
 
 } // namespace rocalution
@@ -41,8 +41,8 @@ namespace rocalution
   * aggregation based interpolation scheme.
   * \cite stueben
   *
-  * \tparam OperatorType - can be LocalMatrix
-  * \tparam VectorType - can be LocalVector
+  * \tparam OperatorType - can be LocalMatrix or GlobalMatrix
+  * \tparam VectorType - can be LocalVector or GlobalVector
   * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
   */
     template <class OperatorType, class VectorType, typename ValueType>
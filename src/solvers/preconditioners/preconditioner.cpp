@@ -24,6 +24,7 @@
 #include "preconditioner.hpp"
 #include "../../base/global_matrix.hpp"
 #include "../../base/local_matrix.hpp"
+#include "../../base/local_stencil.hpp"
 #include "../../utils/def.hpp"
 #include "../solver.hpp"
 
@@ -894,6 +895,17 @@ namespace rocalution
                                   std::complex<float>>;
 #endif
 
+    template class Preconditioner<LocalStencil<double>, LocalVector<double>, double>;
+    template class Preconditioner<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class Preconditioner<LocalStencil<std::complex<double>>,
+                                  LocalVector<std::complex<double>>,
+                                  std::complex<double>>;
+    template class Preconditioner<LocalStencil<std::complex<float>>,
+                                  LocalVector<std::complex<float>>,
+                                  std::complex<float>>;
+#endif
+
     template class Jacobi<LocalMatrix<double>, LocalVector<double>, double>;
     template class Jacobi<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
@@ -916,6 +928,17 @@ namespace rocalution
                           std::complex<float>>;
 #endif
 
+    template class Jacobi<LocalStencil<double>, LocalVector<double>, double>;
+    template class Jacobi<LocalStencil<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class Jacobi<LocalStencil<std::complex<double>>,
+                          LocalVector<std::complex<double>>,
+                          std::complex<double>>;
+    template class Jacobi<LocalStencil<std::complex<float>>,
+                          LocalVector<std::complex<float>>,
+                          std::complex<float>>;
+#endif
+
     template class GS<LocalMatrix<double>, LocalVector<double>, double>;
     template class GS<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
@@ -25,8 +25,10 @@
 #include "../../utils/def.hpp"
 #include "../solver.hpp"
 
+#include "../../base/global_matrix.hpp"
 #include "../../base/local_matrix.hpp"
 
+#include "../../base/global_vector.hpp"
 #include "../../base/local_vector.hpp"
 
 #include "../../utils/log.hpp"
@@ -734,6 +736,17 @@ namespace rocalution
                         std::complex<float>>;
 #endif
 
+    template class FSAI<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class FSAI<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class FSAI<GlobalMatrix<std::complex<double>>,
+                        GlobalVector<std::complex<double>>,
+                        std::complex<double>>;
+    template class FSAI<GlobalMatrix<std::complex<float>>,
+                        GlobalVector<std::complex<float>>,
+                        std::complex<float>>;
+#endif
+
     template class SPAI<LocalMatrix<double>, LocalVector<double>, double>;
     template class SPAI<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
@@ -745,6 +758,17 @@ namespace rocalution
                         std::complex<float>>;
 #endif
 
+    template class SPAI<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class SPAI<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SPAI<GlobalMatrix<std::complex<double>>,
+                        GlobalVector<std::complex<double>>,
+                        std::complex<double>>;
+    template class SPAI<GlobalMatrix<std::complex<float>>,
+                        GlobalVector<std::complex<float>>,
+                        std::complex<float>>;
+#endif
+
     template class TNS<LocalMatrix<double>, LocalVector<double>, double>;
     template class TNS<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
@@ -22,6 +22,8 @@
  * ************************************************************************ */
 
 #include "preconditioner_as.hpp"
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
 #include "../../base/local_matrix.hpp"
 #include "../../base/local_vector.hpp"
 #include "../../utils/def.hpp"
@@ -372,6 +374,191 @@ namespace rocalution
         log_debug(this, "RAS::Solve_()", " #*# end");
     }
 
+    template <typename ValueType>
+    RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::RAS()
+    {
+        log_debug(this, "RAS::RAS()", "default constructor");
+
+        this->overlap_       = 1;
+        this->local_precond_ = NULL;
+        this->local_mat_     = NULL;
+        this->pattern_       = NULL;
+    }
+
+    template <typename ValueType>
+    RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::~RAS()
+    {
+        log_debug(this, "RAS::~RAS()", "destructor");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Print(void) const
+    {
+        LOG_INFO("Restricted Additive Schwarz preconditioner"
+                 << " overlap = " << this->overlap_ << "; subdomain solver:");
+
+        this->local_precond_->Print();
+    }
+
+    template <typename ValueType>
+    void RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Set(
+        int overlap, Solver<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType>& precond)
+    {
+        log_debug(this, "RAS::Set()", overlap, (const void*&)precond);
+
+        assert(overlap >= 0);
+        assert(this->build_ == false);
+
+        this->overlap_       = overlap;
+        this->local_precond_ = &precond;
+    }
+
+    template <typename ValueType>
+    void RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Build(void)
+    {
+        log_debug(this, "RAS::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+        assert(this->local_precond_ != NULL);
+
+        this->local_mat_ = new LocalMatrix<ValueType>;
+        this->local_mat_->CloneBackend(*this->op_);
+
+        this->pattern_ = new GlobalMatrix<ValueType>;
+        this->pattern_->CloneBackend(*this->op_);
+
+        // Overlap rows are fetched once
+        this->op_->ExtractOverlap(this->overlap_, this->local_mat_, this->pattern_);
+
+        this->r_.CloneBackend(*this->op_);
+        this->z_.CloneBackend(*this->op_);
+        this->ghost_.CloneBackend(*this->op_);
+
+        this->r_.Allocate("RAS residual vector", this->local_mat_->GetM());
+        this->z_.Allocate("RAS solution vector", this->local_mat_->GetM());
+
+        this->local_precond_->SetOperator(*this->local_mat_);
+        this->local_precond_->Build();
+
+        this->build_ = true;
+
+        log_debug(this, "RAS::Build()", this->build_, " #*# end");
+    }
+
+    template <typename ValueType>
+    void RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "RAS::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            // Extract the subdomain matrix with the new values
+            this->op_->ExtractOverlap(this->overlap_, this->local_mat_, this->pattern_);
+            this->local_precond_->ReBuildNumeric();
+        }
+        else
+        {
+            this->Clear();
+            this->Build();
+        }
+    }
+
+    template <typename ValueType>
+    void RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Clear(void)
+    {
+        log_debug(this, "RAS::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->local_precond_->Clear();
+
+            delete this->local_mat_;
+            delete this->pattern_;
+
+            this->local_mat_ = NULL;
+            this->pattern_   = NULL;
+
+            this->r_.Clear();
+            this->z_.Clear();
+            this->ghost_.Clear();
+
+            this->build_ = false;
+        }
+    }
+
+    template <typename ValueType>
+    void RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Solve(
+        const GlobalVector<ValueType>& rhs, GlobalVector<ValueType>* x)
+    {
+        log_debug(this, "RAS::Solve()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->build_ == true);
+        assert(x != NULL);
+        assert(x != &rhs);
+
+        int64_t nrow     = this->op_->GetLocalM();
+        int64_t noverlap = this->local_mat_->GetM() - nrow;
+
+        // Gather the right-hand side on the extended subdomain
+        this->pattern_->ExchangeGhostValues(rhs, &this->ghost_);
+
+        this->r_.CopyFrom(rhs.GetInterior(), 0, 0, nrow);
+
+        if(noverlap > 0)
+        {
+            this->r_.CopyFrom(this->ghost_, 0, nrow, noverlap);
+        }
+
+        this->local_precond_->SolveZeroSol(this->r_, &this->z_);
+
+        // Restrict the solution to the interior rows
+        x->GetInterior().CopyFrom(this->z_, 0, 0, nrow);
+
+        log_debug(this, "RAS::Solve()", " #*# end");
+    }
+
+    template <typename ValueType>
+    void RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::MoveToHostLocalData_(
+        void)
+    {
+        log_debug(this, "RAS::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->local_mat_->MoveToHost();
+            this->pattern_->MoveToHost();
+            this->r_.MoveToHost();
+            this->z_.MoveToHost();
+            this->ghost_.MoveToHost();
+            this->local_precond_->MoveToHost();
+        }
+    }
+
+    template <typename ValueType>
+    void RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::
+        MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "RAS::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->local_mat_->MoveToAccelerator();
+            this->pattern_->MoveToAccelerator();
+            this->r_.MoveToAccelerator();
+            this->z_.MoveToAccelerator();
+            this->ghost_.MoveToAccelerator();
+            this->local_precond_->MoveToAccelerator();
+        }
+    }
+
     template class AS<LocalMatrix<double>, LocalVector<double>, double>;
     template class AS<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
@@ -394,4 +581,15 @@ namespace rocalution
                        std::complex<float>>;
 #endif
 
+    template class RAS<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class RAS<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class RAS<GlobalMatrix<std::complex<double>>,
+                       GlobalVector<std::complex<double>>,
+                       std::complex<double>>;
+    template class RAS<GlobalMatrix<std::complex<float>>,
+                       GlobalVector<std::complex<float>>,
+                       std::complex<float>>;
+#endif
+
 } // namespace rocalution
@@ -126,6 +126,72 @@ namespace rocalution
         virtual void Solve(const VectorType& rhs, VectorType* x);
     };
 
+    /** \ingroup precond_module
+  * \brief Distributed Restricted Additive Schwarz Preconditioner
+  * \details
+  * Each process extends its interior rows by a number of layers of overlap rows that are
+  * owned by the neighboring processes, see GlobalMatrix::ExtractOverlap(). The overlap
+  * rows are fetched once during the build phase. On each application, the right-hand side
+  * is gathered on the extended subdomain, the subdomain system is solved by the local
+  * solver and the solution is restricted to the interior rows, without weighting of the
+  * overlapping areas. In contrast to BlockJacobi, the couplings between the processes are
+  * taken into account on the overlap rows. With zero overlap, the preconditioner is
+  * identical to BlockJacobi.
+  * \cite RAS
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <typename ValueType>
+    class RAS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>
+        : public Preconditioner<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        RAS();
+        ROCALUTION_EXPORT
+        virtual ~RAS();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        /** \brief Set number of overlap layers and local solver */
+        ROCALUTION_EXPORT
+        void Set(int                                                                overlap,
+                 Solver<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType>& precond);
+
+        ROCALUTION_EXPORT
+        virtual void Solve(const GlobalVector<ValueType>& rhs, GlobalVector<ValueType>* x);
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+    protected:
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+        /** \brief Number of overlap layers */
+        int overlap_;
+
+        /** \brief Solver for the extended subdomain */
+        Solver<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType>* local_precond_;
+
+        /** \brief Matrix of the extended subdomain */
+        LocalMatrix<ValueType>* local_mat_;
+        /** \brief Communication pattern of the overlap rows */
+        GlobalMatrix<ValueType>* pattern_;
+
+        /** \brief Right-hand side on the extended subdomain */
+        LocalVector<ValueType> r_;
+        /** \brief Solution on the extended subdomain */
+        LocalVector<ValueType> z_;
+        /** \brief Right-hand side on the overlap rows */
+        LocalVector<ValueType> ghost_;
+    };
+
 } // namespace rocalution
 
 #endif // ROCALUTION_PRECONDITIONER_AS_HPP_
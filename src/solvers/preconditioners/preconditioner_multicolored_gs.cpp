@@ -27,13 +27,17 @@
 #include "preconditioner.hpp"
 #include "preconditioner_multicolored.hpp"
 
+#include "../../base/global_matrix.hpp"
 #include "../../base/local_matrix.hpp"
 
+#include "../../base/global_vector.hpp"
 #include "../../base/local_vector.hpp"
 
+#include "../../utils/allocate_free.hpp"
 #include "../../utils/log.hpp"
 
 #include <complex>
+#include <vector>
 
 namespace rocalution
 {
@@ -288,6 +292,537 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::MultiColoredSGS()
+    {
+        log_debug(this, "MultiColoredSGS::MultiColoredSGS()", "default constructor");
+
+        this->color_index_    = NULL;
+        this->interior_block_ = NULL;
+        this->ghost_block_    = NULL;
+        this->x_block_        = NULL;
+        this->diag_block_     = NULL;
+        this->inv_diag_block_ = NULL;
+
+        this->num_blocks_  = 0;
+        this->block_sizes_ = NULL;
+
+        this->omega_ = static_cast<ValueType>(1);
+    }
+
+    template <typename ValueType>
+    MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::~MultiColoredSGS()
+    {
+        log_debug(this, "MultiColoredSGS::~MultiColoredSGS()", "destructor");
+
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::SetRelaxation(
+        ValueType omega)
+    {
+        log_debug(this, "MultiColoredSGS::SetRelaxation()", omega);
+
+        this->omega_ = omega;
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Print(
+        void) const
+    {
+        LOG_INFO("Multicolored Symmetric Gauss-Seidel (SGS) preconditioner");
+
+        if(this->build_ == true)
+        {
+            LOG_INFO("number of colors = " << this->num_blocks_);
+        }
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Build(void)
+    {
+        log_debug(this, "MultiColoredSGS::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+
+        this->op_->MultiColoring(this->num_blocks_, &this->block_sizes_, &this->permutation_);
+
+        this->Decompose_();
+
+        this->build_ = true;
+
+        log_debug(this, "MultiColoredSGS::Build()", this->build_, " #*# end");
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::ReBuildNumeric(
+        void)
+    {
+        log_debug(this, "MultiColoredSGS::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            // Keep the coloring, only the values of the blocks change
+            this->FreeBlocks_();
+            this->Decompose_();
+        }
+        else
+        {
+            this->Clear();
+            this->Build();
+        }
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Clear(void)
+    {
+        log_debug(this, "MultiColoredSGS::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->FreeBlocks_();
+
+            this->ghost_.Clear();
+            this->permutation_.Clear();
+            free_host(&this->block_sizes_);
+            this->num_blocks_ = 0;
+
+            this->build_ = false;
+        }
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::FreeBlocks_(
+        void)
+    {
+        log_debug(this, "MultiColoredSGS::FreeBlocks_()");
+
+        if(this->color_index_ == NULL)
+        {
+            return;
+        }
+
+        for(int i = 0; i < this->num_blocks_; ++i)
+        {
+            delete this->color_index_[i];
+            delete this->interior_block_[i];
+            delete this->ghost_block_[i];
+            delete this->x_block_[i];
+            delete this->diag_block_[i];
+            delete this->inv_diag_block_[i];
+        }
+
+        delete[] this->color_index_;
+        delete[] this->interior_block_;
+        delete[] this->ghost_block_;
+        delete[] this->x_block_;
+        delete[] this->diag_block_;
+        delete[] this->inv_diag_block_;
+
+        this->color_index_    = NULL;
+        this->interior_block_ = NULL;
+        this->ghost_block_    = NULL;
+        this->x_block_        = NULL;
+        this->diag_block_     = NULL;
+        this->inv_diag_block_ = NULL;
+    }
+
+    // Host CSR arrays of a local matrix, the row offsets are always filled
+    template <typename ValueType>
+    static void extract_host_csr(const LocalMatrix<ValueType>& mat,
+                                 std::vector<PtrType>&         row_offset,
+                                 std::vector<int>&             col,
+                                 std::vector<ValueType>&       val)
+    {
+        row_offset.assign(mat.GetM() + 1, 0);
+        col.resize(mat.GetNnz());
+        val.resize(mat.GetNnz());
+
+        // Empty matrices might not carry their dimensions in every format
+        if(mat.GetNnz() == 0)
+        {
+            return;
+        }
+
+        LocalMatrix<ValueType> tmp;
+        tmp.CloneFrom(mat);
+        tmp.MoveToHost();
+        tmp.ConvertToCSR();
+        tmp.CopyToCSR(row_offset.data(), col.data(), val.data());
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Decompose_(
+        void)
+    {
+        log_debug(this, "MultiColoredSGS::Decompose_()");
+
+        assert(this->num_blocks_ > 0);
+        assert(this->block_sizes_ != NULL);
+
+        int64_t local_nrow = this->op_->GetInterior().GetM();
+        int64_t nghost     = this->op_->GetGhost().GetN();
+
+        // The blocks are assembled on the host
+        std::vector<PtrType>   int_ptr;
+        std::vector<int>       int_col;
+        std::vector<ValueType> int_val;
+        std::vector<PtrType>   gst_ptr;
+        std::vector<int>       gst_col;
+        std::vector<ValueType> gst_val;
+
+        extract_host_csr(this->op_->GetInterior(), int_ptr, int_col, int_val);
+        extract_host_csr(this->op_->GetGhost(), gst_ptr, gst_col, gst_val);
+
+        if(this->op_->GetGhost().GetNnz() == 0)
+        {
+            gst_ptr.assign(local_nrow + 1, 0);
+        }
+
+        std::vector<int> perm(local_nrow);
+        this->permutation_.CopyToHostData(perm.data());
+
+        // Local rows of each color, in the order of the permutation
+        std::vector<int> offsets(this->num_blocks_ + 1, 0);
+
+        for(int i = 0; i < this->num_blocks_; ++i)
+        {
+            offsets[i + 1] = offsets[i] + this->block_sizes_[i];
+        }
+
+        std::vector<int> rows(local_nrow);
+        std::vector<int> row_color(local_nrow);
+
+        for(int i = 0; i < this->num_blocks_; ++i)
+        {
+            for(int j = offsets[i]; j < offsets[i + 1]; ++j)
+            {
+                row_color[j] = i;
+            }
+        }
+
+        for(int64_t i = 0; i < local_nrow; ++i)
+        {
+            rows[perm[i]] = static_cast<int>(i);
+        }
+
+        this->color_index_    = new LocalVector<int>*[this->num_blocks_];
+        this->interior_block_ = new LocalMatrix<ValueType>*[this->num_blocks_];
+        this->ghost_block_    = new LocalMatrix<ValueType>*[this->num_blocks_];
+        this->x_block_        = new LocalVector<ValueType>*[this->num_blocks_];
+        this->diag_block_     = new LocalVector<ValueType>*[this->num_blocks_];
+        this->inv_diag_block_ = new LocalVector<ValueType>*[this->num_blocks_];
+
+        for(int i = 0; i < this->num_blocks_; ++i)
+        {
+            int nrow = this->block_sizes_[i];
+
+            std::vector<PtrType>   blk_int_ptr(nrow + 1, 0);
+            std::vector<int>       blk_int_col;
+            std::vector<ValueType> blk_int_val;
+            std::vector<PtrType>   blk_gst_ptr(nrow + 1, 0);
+            std::vector<int>       blk_gst_col;
+            std::vector<ValueType> blk_gst_val;
+            std::vector<ValueType> blk_diag(nrow, static_cast<ValueType>(0));
+            std::vector<ValueType> blk_inv_diag(nrow, static_cast<ValueType>(0));
+
+            for(int k = 0; k < nrow; ++k)
+            {
+                int row = rows[offsets[i] + k];
+
+                assert(row_color[perm[row]] == i);
+
+                for(PtrType j = int_ptr[row]; j < int_ptr[row + 1]; ++j)
+                {
+                    if(int_col[j] == row)
+                    {
+                        blk_diag[k] = int_val[j];
+                    }
+                    else
+                    {
+                        blk_int_col.push_back(int_col[j]);
+                        blk_int_val.push_back(int_val[j]);
+                    }
+                }
+
+                for(PtrType j = gst_ptr[row]; j < gst_ptr[row + 1]; ++j)
+                {
+                    blk_gst_col.push_back(gst_col[j]);
+                    blk_gst_val.push_back(gst_val[j]);
+                }
+
+                assert(blk_diag[k] != static_cast<ValueType>(0));
+
+                blk_inv_diag[k]    = static_cast<ValueType>(1) / blk_diag[k];
+                blk_int_ptr[k + 1] = static_cast<PtrType>(blk_int_col.size());
+                blk_gst_ptr[k + 1] = static_cast<PtrType>(blk_gst_col.size());
+            }
+
+            this->color_index_[i] = new LocalVector<int>;
+            this->color_index_[i]->Allocate("color index", nrow);
+            this->color_index_[i]->CopyFromHostData(rows.data() + offsets[i]);
+
+            this->interior_block_[i] = new LocalMatrix<ValueType>;
+            this->interior_block_[i]->AllocateCSR(
+                "interior block", blk_int_col.size(), nrow, local_nrow);
+
+            this->ghost_block_[i] = new LocalMatrix<ValueType>;
+            this->ghost_block_[i]->AllocateCSR("ghost block", blk_gst_col.size(), nrow, nghost);
+
+            if(blk_int_col.size() > 0)
+            {
+                this->interior_block_[i]->CopyFromCSR(
+                    blk_int_ptr.data(), blk_int_col.data(), blk_int_val.data());
+            }
+
+            if(blk_gst_col.size() > 0)
+            {
+                this->ghost_block_[i]->CopyFromCSR(
+                    blk_gst_ptr.data(), blk_gst_col.data(), blk_gst_val.data());
+            }
+
+            this->x_block_[i] = new LocalVector<ValueType>;
+            this->x_block_[i]->Allocate("x block", nrow);
+
+            this->diag_block_[i] = new LocalVector<ValueType>;
+            this->diag_block_[i]->Allocate("diagonal block", nrow);
+            this->diag_block_[i]->CopyFromHostData(blk_diag.data());
+
+            this->inv_diag_block_[i] = new LocalVector<ValueType>;
+            this->inv_diag_block_[i]->Allocate("inverse diagonal block", nrow);
+            this->inv_diag_block_[i]->CopyFromHostData(blk_inv_diag.data());
+
+            this->color_index_[i]->CloneBackend(*this->op_);
+            this->interior_block_[i]->CloneBackend(*this->op_);
+            this->ghost_block_[i]->CloneBackend(*this->op_);
+            this->x_block_[i]->CloneBackend(*this->op_);
+            this->diag_block_[i]->CloneBackend(*this->op_);
+            this->inv_diag_block_[i]->CloneBackend(*this->op_);
+        }
+
+        this->ghost_.CloneBackend(*this->op_);
+
+        if(this->ghost_.GetSize() != nghost)
+        {
+            this->ghost_.Clear();
+            this->ghost_.Allocate("ghost", nghost);
+        }
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::SweepColor_(
+        int color, GlobalVector<ValueType>* x)
+    {
+        log_debug(this, "MultiColoredSGS::SweepColor_()", color, x);
+
+        if(this->block_sizes_[color] == 0)
+        {
+            return;
+        }
+
+        LocalVector<ValueType>* x_blk = this->x_block_[color];
+
+        if(this->interior_block_[color]->GetNnz() > 0)
+        {
+            this->interior_block_[color]->ApplyAdd(
+                x->GetInterior(), static_cast<ValueType>(-1), x_blk);
+        }
+
+        if(this->ghost_block_[color]->GetNnz() > 0)
+        {
+            this->ghost_block_[color]->ApplyAdd(this->ghost_, static_cast<ValueType>(-1), x_blk);
+        }
+
+        x_blk->PointWiseMult(*this->inv_diag_block_[color]);
+
+        // SSOR
+        if(this->omega_ != static_cast<ValueType>(1))
+        {
+            x_blk->Scale(static_cast<ValueType>(1) / this->omega_);
+        }
+
+        x->GetInterior().SetIndexValues(*this->color_index_[color], *x_blk);
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::SolveL_(
+        GlobalVector<ValueType>* x)
+    {
+        log_debug(this, "MultiColoredSGS::SolveL_()", x);
+
+        assert(this->build_ == true);
+
+        // Rows of colors that have not been swept yet are zero
+        x->Zeros();
+        this->ghost_.Zeros();
+
+        for(int i = 0; i < this->num_blocks_; ++i)
+        {
+            if(i > 0)
+            {
+                this->op_->ExchangeGhostValues(*x, &this->ghost_);
+            }
+
+            this->SweepColor_(i, x);
+        }
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::SolveD_(void)
+    {
+        log_debug(this, "MultiColoredSGS::SolveD_()");
+
+        assert(this->build_ == true);
+
+        for(int i = 0; i < this->num_blocks_; ++i)
+        {
+            if(this->block_sizes_[i] == 0)
+            {
+                continue;
+            }
+
+            this->x_block_[i]->PointWiseMult(*this->diag_block_[i]);
+
+            // SSOR
+            if(this->omega_ != static_cast<ValueType>(1))
+            {
+                this->x_block_[i]->Scale(this->omega_ / (static_cast<ValueType>(2) - this->omega_));
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::SolveR_(
+        GlobalVector<ValueType>* x)
+    {
+        log_debug(this, "MultiColoredSGS::SolveR_()", x);
+
+        assert(this->build_ == true);
+
+        x->Zeros();
+        this->ghost_.Zeros();
+
+        for(int i = this->num_blocks_ - 1; i >= 0; --i)
+        {
+            if(i < this->num_blocks_ - 1)
+            {
+                this->op_->ExchangeGhostValues(*x, &this->ghost_);
+            }
+
+            this->SweepColor_(i, x);
+        }
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Solve(
+        const GlobalVector<ValueType>& rhs, GlobalVector<ValueType>* x)
+    {
+        log_debug(this, "MultiColoredSGS::Solve()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->build_ == true);
+        assert(x != NULL);
+
+        // Right-hand side of each color
+        for(int i = 0; i < this->num_blocks_; ++i)
+        {
+            if(this->block_sizes_[i] > 0)
+            {
+                rhs.GetInterior().GetIndexValues(*this->color_index_[i], this->x_block_[i]);
+            }
+        }
+
+        this->SolveL_(x);
+        this->SolveD_();
+        this->SolveR_(x);
+
+        log_debug(this, "MultiColoredSGS::Solve()", " #*# end");
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::
+        MoveToHostLocalData_(void)
+    {
+        log_debug(this, "MultiColoredSGS::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->num_blocks_; ++i)
+            {
+                this->color_index_[i]->MoveToHost();
+                this->interior_block_[i]->MoveToHost();
+                this->ghost_block_[i]->MoveToHost();
+                this->x_block_[i]->MoveToHost();
+                this->diag_block_[i]->MoveToHost();
+                this->inv_diag_block_[i]->MoveToHost();
+            }
+
+            this->ghost_.MoveToHost();
+        }
+    }
+
+    template <typename ValueType>
+    void MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::
+        MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "MultiColoredSGS::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(int i = 0; i < this->num_blocks_; ++i)
+            {
+                this->color_index_[i]->MoveToAccelerator();
+                this->interior_block_[i]->MoveToAccelerator();
+                this->ghost_block_[i]->MoveToAccelerator();
+                this->x_block_[i]->MoveToAccelerator();
+                this->diag_block_[i]->MoveToAccelerator();
+                this->inv_diag_block_[i]->MoveToAccelerator();
+            }
+
+            this->ghost_.MoveToAccelerator();
+        }
+    }
+
+    template <typename ValueType>
+    MultiColoredGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::MultiColoredGS()
+    {
+    }
+
+    template <typename ValueType>
+    MultiColoredGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::~MultiColoredGS()
+    {
+        this->Clear();
+    }
+
+    template <typename ValueType>
+    void MultiColoredGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::Print(
+        void) const
+    {
+        LOG_INFO("Multicolored Gauss-Seidel (GS) preconditioner");
+
+        if(this->build_ == true)
+        {
+            LOG_INFO("number of colors = " << this->num_blocks_);
+        }
+    }
+
+    template <typename ValueType>
+    void MultiColoredGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::SolveL_(
+        GlobalVector<ValueType>* x)
+    {
+    }
+
+    template <typename ValueType>
+    void MultiColoredGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>::SolveD_(void)
+    {
+    }
+
     template class MultiColoredSGS<LocalMatrix<double>, LocalVector<double>, double>;
     template class MultiColoredSGS<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
@@ -310,4 +845,26 @@ namespace rocalution
                                   std::complex<float>>;
 #endif
 
+    template class MultiColoredSGS<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class MultiColoredSGS<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class MultiColoredSGS<GlobalMatrix<std::complex<double>>,
+                                   GlobalVector<std::complex<double>>,
+                                   std::complex<double>>;
+    template class MultiColoredSGS<GlobalMatrix<std::complex<float>>,
+                                   GlobalVector<std::complex<float>>,
+                                   std::complex<float>>;
+#endif
+
+    template class MultiColoredGS<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class MultiColoredGS<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class MultiColoredGS<GlobalMatrix<std::complex<double>>,
+                                  GlobalVector<std::complex<double>>,
+                                  std::complex<double>>;
+    template class MultiColoredGS<GlobalMatrix<std::complex<float>>,
+                                  GlobalVector<std::complex<float>>,
+                                  std::complex<float>>;
+#endif
+
 } // namespace rocalution
@@ -45,8 +45,8 @@ namespace rocalution
   * Details on the Symmetric Gauss-Seidel / SSOR algorithm can be found in the SGS
   * preconditioner.
   *
-  * \tparam OperatorType - can be LocalMatrix
-  * \tparam VectorType - can be LocalVector
+  * \tparam OperatorType - can be LocalMatrix or GlobalMatrix
+  * \tparam VectorType - can be LocalVector or GlobalVector
   * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
   */
     template <class OperatorType, class VectorType, typename ValueType>
@@ -89,8 +89,8 @@ namespace rocalution
   * substitution is obtained by performing a multi-colored decomposition. Details on the
   * Gauss-Seidel / SOR algorithm can be found in the GS preconditioner.
   *
-  * \tparam OperatorType - can be LocalMatrix
-  * \tparam VectorType - can be LocalVector
+  * \tparam OperatorType - can be LocalMatrix or GlobalMatrix
+  * \tparam VectorType - can be LocalVector or GlobalVector
   * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
   */
     template <class OperatorType, class VectorType, typename ValueType>
@@ -114,6 +114,114 @@ namespace rocalution
         virtual void Solve_(const VectorType& rhs, VectorType* x);
     };
 
+    /** \ingroup precond_module
+  * \brief Distributed Multi-Colored Symmetric Gauss-Seidel / SSOR Preconditioner
+  * \details
+  * The matrix is colored by GlobalMatrix::MultiColoring(), such that rows which are
+  * coupled across processes never share a color. The colors are swept one after
+  * another on all processes and the ghost values are exchanged between two colors.
+  * Hence, the preconditioner is identical to the sequential multi-colored SGS / SSOR
+  * with the same coloring, independent of the number of processes.
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <typename ValueType>
+    class MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>
+        : public Preconditioner<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        MultiColoredSGS();
+        ROCALUTION_EXPORT
+        virtual ~MultiColoredSGS();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+        ROCALUTION_EXPORT
+        virtual void Build(void);
+        ROCALUTION_EXPORT
+        virtual void ReBuildNumeric(void);
+        ROCALUTION_EXPORT
+        virtual void Clear(void);
+
+        /** \brief Set the relaxation parameter for the SOR/SSOR scheme */
+        ROCALUTION_EXPORT
+        void SetRelaxation(ValueType omega);
+
+        ROCALUTION_EXPORT
+        virtual void Solve(const GlobalVector<ValueType>& rhs, GlobalVector<ValueType>* x);
+
+    protected:
+        /** \brief Extract the local rows and blocks of each color */
+        void Decompose_(void);
+        /** \brief Free the blocks of each color */
+        void FreeBlocks_(void);
+        /** \brief Update the rows of a color from the blocks of the color */
+        void SweepColor_(int color, GlobalVector<ValueType>* x);
+
+        /** \brief Forward sweep over all colors */
+        virtual void SolveL_(GlobalVector<ValueType>* x);
+        /** \brief Diagonal scaling (only for SGS) */
+        virtual void SolveD_(void);
+        /** \brief Backward sweep over all colors */
+        virtual void SolveR_(GlobalVector<ValueType>* x);
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+        /** \brief Local rows of each color */
+        LocalVector<int>** color_index_;
+        /** \brief Off-diagonal interior rows of each color */
+        LocalMatrix<ValueType>** interior_block_;
+        /** \brief Ghost rows of each color */
+        LocalMatrix<ValueType>** ghost_block_;
+
+        /** \brief Solution vector for each color */
+        LocalVector<ValueType>** x_block_;
+        /** \brief Diagonal for each color */
+        LocalVector<ValueType>** diag_block_;
+        /** \brief Inverse diagonal for each color */
+        LocalVector<ValueType>** inv_diag_block_;
+
+        /** \brief Ghost values of the solution */
+        LocalVector<ValueType> ghost_;
+
+        /** \brief Number of colors */
+        int num_blocks_;
+        /** \brief Number of local rows of each color */
+        int* block_sizes_;
+
+        /** \brief Relaxation parameter */
+        ValueType omega_;
+    };
+
+    /** \ingroup precond_module
+  * \brief Distributed Multi-Colored Gauss-Seidel / SOR Preconditioner
+  * \details
+  * Distributed version of the multi-colored GS / SOR preconditioner, see the distributed
+  * MultiColoredSGS for details.
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <typename ValueType>
+    class MultiColoredGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>
+        : public MultiColoredSGS<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>
+    {
+    public:
+        ROCALUTION_EXPORT
+        MultiColoredGS();
+        ROCALUTION_EXPORT
+        virtual ~MultiColoredGS();
+
+        ROCALUTION_EXPORT
+        virtual void Print(void) const;
+
+    protected:
+        virtual void SolveL_(GlobalVector<ValueType>* x);
+        virtual void SolveD_(void);
+    };
+
 } // namespace rocalution
 
 #endif // ROCALUTION_PRECONDITIONER_MULTICOLORED_GS_HPP_
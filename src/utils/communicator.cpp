@@ -25,7 +25,9 @@
 #include "def.hpp"
 #include "log_mpi.hpp"
 
+#include <algorithm>
 #include <complex>
+#include <limits>
 
 namespace rocalution
 {
@@ -167,6 +169,161 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    // Allreduce SUM - SYNC
+    template <>
+    void communication_sync_allreduce_sum(double*     local,
+                                          double*     global,
+                                          int         count,
+                                          const void* comm)
+    {
+        int status = MPI_Allreduce(local, global, count, MPI_DOUBLE, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_sync_allreduce_sum(float* local, float* global, int count, const void* comm)
+    {
+        int status = MPI_Allreduce(local, global, count, MPI_FLOAT, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+#ifdef SUPPORT_COMPLEX
+    template <>
+    void communication_sync_allreduce_sum(std::complex<double>* local,
+                                          std::complex<double>* global,
+                                          int                   count,
+                                          const void*           comm)
+    {
+        int status
+            = MPI_Allreduce(local, global, count, MPI_DOUBLE_COMPLEX, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_sync_allreduce_sum(std::complex<float>* local,
+                                          std::complex<float>* global,
+                                          int                  count,
+                                          const void*          comm)
+    {
+        int status = MPI_Allreduce(local, global, count, MPI_COMPLEX, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+#endif
+
+    template <>
+    void communication_sync_allreduce_sum(int* local, int* global, int count, const void* comm)
+    {
+        int status = MPI_Allreduce(local, global, count, MPI_INT, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_sync_allreduce_sum(unsigned int* local,
+                                          unsigned int* global,
+                                          int           count,
+                                          const void*   comm)
+    {
+        int status = MPI_Allreduce(local, global, count, MPI_UNSIGNED, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_sync_allreduce_sum(int64_t*    local,
+                                          int64_t*    global,
+                                          int         count,
+                                          const void* comm)
+    {
+        int status = MPI_Allreduce(local, global, count, MPI_INT64_T, MPI_SUM, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    // Allreduce SUM - ASYNC
+    template <>
+    void communication_async_allreduce_sum(double*     local,
+                                           double*     global,
+                                           int         count,
+                                           const void* comm,
+                                           MRequest*   request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_DOUBLE, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(float*      local,
+                                           float*      global,
+                                           int         count,
+                                           const void* comm,
+                                           MRequest*   request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_FLOAT, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+#ifdef SUPPORT_COMPLEX
+    template <>
+    void communication_async_allreduce_sum(std::complex<double>* local,
+                                           std::complex<double>* global,
+                                           int                   count,
+                                           const void*           comm,
+                                           MRequest*             request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_DOUBLE_COMPLEX, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(std::complex<float>* local,
+                                           std::complex<float>* global,
+                                           int                  count,
+                                           const void*          comm,
+                                           MRequest*            request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_COMPLEX, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+#endif
+
+    template <>
+    void communication_async_allreduce_sum(int*        local,
+                                           int*        global,
+                                           int         count,
+                                           const void* comm,
+                                           MRequest*   request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_INT, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(unsigned int* local,
+                                           unsigned int* global,
+                                           int           count,
+                                           const void*   comm,
+                                           MRequest*     request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_UNSIGNED, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_sum(int64_t*    local,
+                                           int64_t*    global,
+                                           int         count,
+                                           const void* comm,
+                                           MRequest*   request)
+    {
+        int status = MPI_Iallreduce(
+            local, global, count, MPI_INT64_T, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
     // Allreduce single MAX - SYNC
     template <>
     void communication_sync_allreduce_single_max(double* local, double* global, const void* comm)
@@ -713,6 +870,131 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    // Persistent receive
+    template <>
+    void communication_recv_init(
+        double* buf, int count, int source, int tag, MRequest* request, const void* comm)
+    {
+        int status
+            = MPI_Recv_init(buf, count, MPI_DOUBLE, source, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_recv_init(
+        float* buf, int count, int source, int tag, MRequest* request, const void* comm)
+    {
+        int status
+            = MPI_Recv_init(buf, count, MPI_FLOAT, source, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+#ifdef SUPPORT_COMPLEX
+    template <>
+    void communication_recv_init(std::complex<double>* buf,
+                                 int                   count,
+                                 int                   source,
+                                 int                   tag,
+                                 MRequest*             request,
+                                 const void*           comm)
+    {
+        int status = MPI_Recv_init(
+            buf, count, MPI_DOUBLE_COMPLEX, source, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_recv_init(std::complex<float>* buf,
+                                 int                  count,
+                                 int                  source,
+                                 int                  tag,
+                                 MRequest*            request,
+                                 const void*          comm)
+    {
+        int status
+            = MPI_Recv_init(buf, count, MPI_COMPLEX, source, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+#endif
+
+    template <>
+    void communication_recv_init(
+        int* buf, int count, int source, int tag, MRequest* request, const void* comm)
+    {
+        int status
+            = MPI_Recv_init(buf, count, MPI_INT, source, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_recv_init(
+        int64_t* buf, int count, int source, int tag, MRequest* request, const void* comm)
+    {
+        int status
+            = MPI_Recv_init(buf, count, MPI_INT64_T, source, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    // Persistent send
+    template <>
+    void communication_send_init(
+        double* buf, int count, int dest, int tag, MRequest* request, const void* comm)
+    {
+        int status
+            = MPI_Send_init(buf, count, MPI_DOUBLE, dest, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_send_init(
+        float* buf, int count, int dest, int tag, MRequest* request, const void* comm)
+    {
+        int status
+            = MPI_Send_init(buf, count, MPI_FLOAT, dest, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+#ifdef SUPPORT_COMPLEX
+    template <>
+    void communication_send_init(std::complex<double>* buf,
+                                 int                   count,
+                                 int                   dest,
+                                 int                   tag,
+                                 MRequest*             request,
+                                 const void*           comm)
+    {
+        int status = MPI_Send_init(
+            buf, count, MPI_DOUBLE_COMPLEX, dest, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_send_init(
+        std::complex<float>* buf, int count, int dest, int tag, MRequest* request, const void* comm)
+    {
+        int status
+            = MPI_Send_init(buf, count, MPI_COMPLEX, dest, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+#endif
+
+    template <>
+    void communication_send_init(
+        int* buf, int count, int dest, int tag, MRequest* request, const void* comm)
+    {
+        int status = MPI_Send_init(buf, count, MPI_INT, dest, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_send_init(
+        int64_t* buf, int count, int dest, int tag, MRequest* request, const void* comm)
+    {
+        int status
+            = MPI_Send_init(buf, count, MPI_INT64_T, dest, tag, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
     // Synchronization
     void communication_sync(MRequest* request)
     {
@@ -726,4 +1008,114 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    // Persistent requests
+    void communication_startall(int count, MRequest* requests)
+    {
+        if(count > 0)
+        {
+            int status = MPI_Startall(count, &requests->req);
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+    }
+
+    void communication_request_free(int count, MRequest* requests)
+    {
+        for(int i = 0; i < count; ++i)
+        {
+            int status = MPI_Request_free(&requests[i].req);
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+    }
+
+    // Collective file I/O
+    bool communication_file_open_read(const char* filename, MFile* file, const void* comm)
+    {
+        int status = MPI_File_open(
+            *(MPI_Comm*)comm, filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &file->file);
+
+        return status == MPI_SUCCESS;
+    }
+
+    bool communication_file_open_write(const char* filename, MFile* file, const void* comm)
+    {
+        int status = MPI_File_open(*(MPI_Comm*)comm,
+                                   filename,
+                                   MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                                   MPI_INFO_NULL,
+                                   &file->file);
+
+        if(status != MPI_SUCCESS)
+        {
+            return false;
+        }
+
+        // Discard any previous content of the file
+        status = MPI_File_set_size(file->file, 0);
+
+        return status == MPI_SUCCESS;
+    }
+
+    void communication_file_close(MFile* file)
+    {
+        int status = MPI_File_close(&file->file);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    // Maximum number of bytes per collective file access
+    static const int64_t file_chunk_size = std::numeric_limits<int>::max() / 2;
+
+    // Number of collective file accesses that are required by all processes
+    static int64_t communication_file_rounds(int64_t size, const void* comm)
+    {
+        int64_t rounds = (size + file_chunk_size - 1) / file_chunk_size;
+        int64_t max_rounds;
+
+        int status = MPI_Allreduce(&rounds, &max_rounds, 1, MPI_INT64_T, MPI_MAX, *(MPI_Comm*)comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+
+        return max_rounds;
+    }
+
+    void communication_file_read_at_all(
+        MFile* file, int64_t offset, void* buf, int64_t size, const void* comm)
+    {
+        int64_t rounds = communication_file_rounds(size, comm);
+
+        // Each process has to participate in all rounds, possibly with zero bytes
+        for(int64_t r = 0; r < rounds; ++r)
+        {
+            int64_t begin = std::min(r * file_chunk_size, size);
+            int     count = static_cast<int>(std::min(file_chunk_size, size - begin));
+
+            int status = MPI_File_read_at_all(file->file,
+                                              static_cast<MPI_Offset>(offset + begin),
+                                              static_cast<char*>(buf) + begin,
+                                              count,
+                                              MPI_BYTE,
+                                              MPI_STATUS_IGNORE);
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+    }
+
+    void communication_file_write_at_all(
+        MFile* file, int64_t offset, const void* buf, int64_t size, const void* comm)
+    {
+        int64_t rounds = communication_file_rounds(size, comm);
+
+        // Each process has to participate in all rounds, possibly with zero bytes
+        for(int64_t r = 0; r < rounds; ++r)
+        {
+            int64_t begin = std::min(r * file_chunk_size, size);
+            int     count = static_cast<int>(std::min(file_chunk_size, size - begin));
+
+            int status = MPI_File_write_at_all(file->file,
+                                               static_cast<MPI_Offset>(offset + begin),
+                                               static_cast<const char*>(buf) + begin,
+                                               count,
+                                               MPI_BYTE,
+                                               MPI_STATUS_IGNORE);
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+    }
+
 } // namespace rocalution
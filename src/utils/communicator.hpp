@@ -33,6 +33,11 @@ namespace rocalution
         MPI_Request req;
     };
 
+    struct MFile
+    {
+        MPI_File file;
+    };
+
     template <typename ValueType>
     void communication_sync_allreduce_single_sum(ValueType*  local,
                                                  ValueType*  global,
@@ -44,6 +49,19 @@ namespace rocalution
                                                   const void* comm,
                                                   MRequest*   request);
 
+    template <typename ValueType>
+    void communication_sync_allreduce_sum(ValueType*  local,
+                                          ValueType*  global,
+                                          int         count,
+                                          const void* comm);
+
+    template <typename ValueType>
+    void communication_async_allreduce_sum(ValueType*  local,
+                                           ValueType*  global,
+                                           int         count,
+                                           const void* comm,
+                                           MRequest*   request);
+
     template <typename ValueType>
     void communication_sync_allreduce_single_max(ValueType*  local,
                                                  ValueType*  global,
@@ -81,8 +99,26 @@ namespace rocalution
     void communication_async_send(
         ValueType* buf, int count, int dest, int tag, MRequest* request, const void* comm);
 
+    template <typename ValueType>
+    void communication_recv_init(
+        ValueType* buf, int count, int source, int tag, MRequest* request, const void* comm);
+
+    template <typename ValueType>
+    void communication_send_init(
+        ValueType* buf, int count, int dest, int tag, MRequest* request, const void* comm);
+
     void communication_sync(MRequest* request);
     void communication_syncall(int count, MRequest* requests);
+    void communication_startall(int count, MRequest* requests);
+    void communication_request_free(int count, MRequest* requests);
+
+    bool communication_file_open_read(const char* filename, MFile* file, const void* comm);
+    bool communication_file_open_write(const char* filename, MFile* file, const void* comm);
+    void communication_file_close(MFile* file);
+    void communication_file_read_at_all(
+        MFile* file, int64_t offset, void* buf, int64_t size, const void* comm);
+    void communication_file_write_at_all(
+        MFile* file, int64_t offset, const void* buf, int64_t size, const void* comm);
 
 } // namespace rocalution
 
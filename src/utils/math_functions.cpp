@@ -23,10 +23,13 @@
 
 #include "math_functions.hpp"
 #include "def.hpp"
+#include "../base/matrix_formats_ind.hpp"
 
 #include <limits>
 #include <math.h>
 #include <stdlib.h>
+#include <utility>
+#include <vector>
 
 namespace rocalution
 {
@@ -114,6 +117,359 @@ namespace rocalution
         return lhs.real() >= rhs.real();
     }
 
+    template <typename ValueType>
+    bool rocalution_hermitian_eigen(
+        int n, ValueType* A, ValueType* B, ValueType* lambda, ValueType* X)
+    {
+        assert(n >= 0);
+
+        typedef decltype(std::abs(ValueType(0))) RealType;
+
+        const RealType eps = std::numeric_limits<RealType>::epsilon();
+
+        // Symmetric diagonal scaling D = diag(B)^-1/2 to improve the conditioning of B
+        std::vector<RealType> d(n);
+
+        for(int i = 0; i < n; ++i)
+        {
+            RealType bii = std::real(B[DENSE_IND(i, i, n, n)]);
+
+            if(!(bii > static_cast<RealType>(0)))
+            {
+                return false;
+            }
+
+            d[i] = static_cast<RealType>(1) / std::sqrt(bii);
+        }
+
+        for(int j = 0; j < n; ++j)
+        {
+            for(int i = 0; i < n; ++i)
+            {
+                A[DENSE_IND(i, j, n, n)] *= d[i] * d[j];
+                B[DENSE_IND(i, j, n, n)] *= d[i] * d[j];
+            }
+        }
+
+        // Cholesky factorization B = LL^H, L is stored in the lower triangular part of B
+        for(int j = 0; j < n; ++j)
+        {
+            RealType ljj = std::real(B[DENSE_IND(j, j, n, n)]);
+
+            for(int k = 0; k < j; ++k)
+            {
+                ljj -= std::norm(B[DENSE_IND(j, k, n, n)]);
+            }
+
+            if(!(ljj > n * eps))
+            {
+                return false;
+            }
+
+            ljj = std::sqrt(ljj);
+
+            B[DENSE_IND(j, j, n, n)] = static_cast<ValueType>(ljj);
+
+            for(int i = j + 1; i < n; ++i)
+            {
+                ValueType lij = B[DENSE_IND(i, j, n, n)];
+
+                for(int k = 0; k < j; ++k)
+                {
+                    lij -= B[DENSE_IND(i, k, n, n)] * rocalution_conj(B[DENSE_IND(j, k, n, n)]);
+                }
+
+                B[DENSE_IND(i, j, n, n)] = lij / ljj;
+            }
+        }
+
+        // Y = L^-1 A, stored in A
+        for(int j = 0; j < n; ++j)
+        {
+            for(int i = 0; i < n; ++i)
+            {
+                ValueType yij = A[DENSE_IND(i, j, n, n)];
+
+                for(int k = 0; k < i; ++k)
+                {
+                    yij -= B[DENSE_IND(i, k, n, n)] * A[DENSE_IND(k, j, n, n)];
+                }
+
+                A[DENSE_IND(i, j, n, n)] = yij / B[DENSE_IND(i, i, n, n)];
+            }
+        }
+
+        // C = L^-1 A L^-H = L^-1 Y^H
+        std::vector<ValueType> C(n * n);
+
+        for(int j = 0; j < n; ++j)
+        {
+            for(int i = 0; i < n; ++i)
+            {
+                ValueType cij = rocalution_conj(A[DENSE_IND(j, i, n, n)]);
+
+                for(int k = 0; k < i; ++k)
+                {
+                    cij -= B[DENSE_IND(i, k, n, n)] * C[DENSE_IND(k, j, n, n)];
+                }
+
+                C[DENSE_IND(i, j, n, n)] = cij / B[DENSE_IND(i, i, n, n)];
+            }
+        }
+
+        // Remove the non-Hermitian part due to round-off
+        for(int j = 0; j < n; ++j)
+        {
+            for(int i = 0; i < j; ++i)
+            {
+                ValueType cij = static_cast<ValueType>(0.5)
+                                * (C[DENSE_IND(i, j, n, n)]
+                                   + rocalution_conj(C[DENSE_IND(j, i, n, n)]));
+
+                C[DENSE_IND(i, j, n, n)] = cij;
+                C[DENSE_IND(j, i, n, n)] = rocalution_conj(cij);
+            }
+
+            C[DENSE_IND(j, j, n, n)] = static_cast<ValueType>(std::real(C[DENSE_IND(j, j, n, n)]));
+        }
+
+        // Cyclic Jacobi method, V accumulates the rotations and is stored in A
+        ValueType* V = A;
+
+        for(int j = 0; j < n; ++j)
+        {
+            for(int i = 0; i < n; ++i)
+            {
+                V[DENSE_IND(i, j, n, n)] = static_cast<ValueType>(i == j ? 1 : 0);
+            }
+        }
+
+        for(int sweep = 0; sweep < 100; ++sweep)
+        {
+            RealType off  = static_cast<RealType>(0);
+            RealType diag = static_cast<RealType>(0);
+
+            for(int j = 0; j < n; ++j)
+            {
+                for(int i = 0; i < j; ++i)
+                {
+                    off += std::norm(C[DENSE_IND(i, j, n, n)]);
+                }
+
+                diag += std::norm(C[DENSE_IND(j, j, n, n)]);
+            }
+
+            if(std::sqrt(off) <= eps * std::sqrt(diag + 2 * off))
+            {
+                break;
+            }
+
+            for(int p = 0; p < n - 1; ++p)
+            {
+                for(int q = p + 1; q < n; ++q)
+                {
+                    ValueType apq = C[DENSE_IND(p, q, n, n)];
+                    RealType  apq_abs = std::abs(apq);
+
+                    if(apq_abs == static_cast<RealType>(0))
+                    {
+                        continue;
+                    }
+
+                    // Phase of the off-diagonal entry, the rotation annihilates C_pq
+                    ValueType e = apq / apq_abs;
+
+                    RealType app = std::real(C[DENSE_IND(p, p, n, n)]);
+                    RealType aqq = std::real(C[DENSE_IND(q, q, n, n)]);
+
+                    RealType one = static_cast<RealType>(1);
+                    RealType tau = (aqq - app) / (2 * apq_abs);
+                    RealType t   = one / (std::abs(tau) + std::sqrt(one + tau * tau));
+
+                    if(tau < static_cast<RealType>(0))
+                    {
+                        t = -t;
+                    }
+
+                    RealType c = one / std::sqrt(one + t * t);
+                    RealType s = t * c;
+
+                    ValueType sce = s * rocalution_conj(e);
+                    ValueType cce = c * rocalution_conj(e);
+                    ValueType se  = s * e;
+                    ValueType ce  = c * e;
+
+                    // Columns p and q of C and V
+                    for(int i = 0; i < n; ++i)
+                    {
+                        ValueType cip = C[DENSE_IND(i, p, n, n)];
+                        ValueType ciq = C[DENSE_IND(i, q, n, n)];
+
+                        C[DENSE_IND(i, p, n, n)] = c * cip - sce * ciq;
+                        C[DENSE_IND(i, q, n, n)] = s * cip + cce * ciq;
+
+                        ValueType vip = V[DENSE_IND(i, p, n, n)];
+                        ValueType viq = V[DENSE_IND(i, q, n, n)];
+
+                        V[DENSE_IND(i, p, n, n)] = c * vip - sce * viq;
+                        V[DENSE_IND(i, q, n, n)] = s * vip + cce * viq;
+                    }
+
+                    // Rows p and q of C
+                    for(int j = 0; j < n; ++j)
+                    {
+                        ValueType cpj = C[DENSE_IND(p, j, n, n)];
+                        ValueType cqj = C[DENSE_IND(q, j, n, n)];
+
+                        C[DENSE_IND(p, j, n, n)] = c * cpj - se * cqj;
+                        C[DENSE_IND(q, j, n, n)] = s * cpj + ce * cqj;
+                    }
+
+                    C[DENSE_IND(p, q, n, n)] = static_cast<ValueType>(0);
+                    C[DENSE_IND(q, p, n, n)] = static_cast<ValueType>(0);
+                }
+            }
+        }
+
+        // Sort eigenpairs in ascending order
+        for(int j = 0; j < n; ++j)
+        {
+            lambda[j] = static_cast<ValueType>(std::real(C[DENSE_IND(j, j, n, n)]));
+        }
+
+        for(int j = 0; j < n - 1; ++j)
+        {
+            int min = j;
+
+            for(int i = j + 1; i < n; ++i)
+            {
+                if(std::real(lambda[i]) < std::real(lambda[min]))
+                {
+                    min = i;
+                }
+            }
+
+            if(min != j)
+            {
+                std::swap(lambda[j], lambda[min]);
+
+                for(int i = 0; i < n; ++i)
+                {
+                    std::swap(V[DENSE_IND(i, j, n, n)], V[DENSE_IND(i, min, n, n)]);
+                }
+            }
+        }
+
+        // X = D L^-H V
+        for(int j = 0; j < n; ++j)
+        {
+            for(int i = n - 1; i >= 0; --i)
+            {
+                ValueType xij = V[DENSE_IND(i, j, n, n)];
+
+                for(int k = i + 1; k < n; ++k)
+                {
+                    xij -= rocalution_conj(B[DENSE_IND(k, i, n, n)]) * X[DENSE_IND(k, j, n, n)];
+                }
+
+                X[DENSE_IND(i, j, n, n)] = xij / B[DENSE_IND(i, i, n, n)];
+            }
+
+            for(int i = 0; i < n; ++i)
+            {
+                X[DENSE_IND(i, j, n, n)] *= d[i];
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    int rocalution_gram_orthonormalize(int n, ValueType* G, ValueType* T, ValueType* R)
+    {
+        assert(n >= 0);
+
+        typedef decltype(std::abs(ValueType(0))) RealType;
+
+        const RealType eps = std::numeric_limits<RealType>::epsilon();
+
+        if(n == 0)
+        {
+            return 0;
+        }
+
+        // Scale the columns of W to unit length, such that the rank decision does not
+        // depend on the column norms. Columns that are negligible compared to the largest
+        // one are treated as zero.
+        std::vector<RealType> d(n);
+
+        RealType diag_max = static_cast<RealType>(0);
+
+        for(int i = 0; i < n; ++i)
+        {
+            diag_max = std::max(diag_max, std::abs(G[DENSE_IND(i, i, n, n)]));
+        }
+
+        for(int i = 0; i < n; ++i)
+        {
+            RealType gii = std::abs(G[DENSE_IND(i, i, n, n)]);
+
+            d[i] = (gii > eps * eps * diag_max) ? static_cast<RealType>(1) / std::sqrt(gii)
+                                                : static_cast<RealType>(0);
+        }
+
+        std::vector<ValueType> B(n * n, static_cast<ValueType>(0));
+        std::vector<ValueType> lambda(n);
+        std::vector<ValueType> X(n * n);
+
+        for(int j = 0; j < n; ++j)
+        {
+            for(int i = 0; i < n; ++i)
+            {
+                G[DENSE_IND(i, j, n, n)] *= static_cast<ValueType>(d[i] * d[j]);
+            }
+
+            B[DENSE_IND(j, j, n, n)] = static_cast<ValueType>(1);
+        }
+
+        // D G D = X Lambda X^H with orthonormal X
+        if(rocalution_hermitian_eigen(n, G, B.data(), lambda.data(), X.data()) == false)
+        {
+            return 0;
+        }
+
+        // Keep the directions with singular values above the threshold, the Gram matrix
+        // squares the condition number
+        RealType lambda_max = std::real(lambda[n - 1]);
+        RealType tol        = static_cast<RealType>(10 * n) * eps * lambda_max;
+
+        int r = 0;
+
+        while(r < n && std::real(lambda[n - 1 - r]) > tol)
+        {
+            ++r;
+        }
+
+        // T = D X_r Lambda_r^-1/2, R = Lambda_r^1/2 X_r^H D^-1, largest singular values first
+        for(int j = 0; j < r; ++j)
+        {
+            RealType sigma = std::sqrt(std::real(lambda[n - 1 - j]));
+
+            for(int i = 0; i < n; ++i)
+            {
+                ValueType x = X[DENSE_IND(i, n - 1 - j, n, n)];
+
+                T[DENSE_IND(i, j, n, r)] = x * static_cast<ValueType>(d[i] / sigma);
+                R[DENSE_IND(j, i, r, n)]
+                    = (d[i] > static_cast<RealType>(0))
+                          ? rocalution_conj(x) * static_cast<ValueType>(sigma / d[i])
+                          : static_cast<ValueType>(0);
+            }
+        }
+
+        return r;
+    }
+
     template double               rocalution_eps(void);
     template float                rocalution_eps(void);
     template std::complex<double> rocalution_eps(void);
@@ -131,4 +487,29 @@ namespace rocalution
     template bool operator>=(const std::complex<float>& lhs, const std::complex<float>& rhs);
     template bool operator>=(const std::complex<double>& lhs, const std::complex<double>& rhs);
 
+    template bool rocalution_hermitian_eigen(
+        int n, double* A, double* B, double* lambda, double* X);
+    template bool rocalution_hermitian_eigen(int n, float* A, float* B, float* lambda, float* X);
+    template bool rocalution_hermitian_eigen(int                   n,
+                                             std::complex<double>* A,
+                                             std::complex<double>* B,
+                                             std::complex<double>* lambda,
+                                             std::complex<double>* X);
+    template bool rocalution_hermitian_eigen(int                  n,
+                                             std::complex<float>* A,
+                                             std::complex<float>* B,
+                                             std::complex<float>* lambda,
+                                             std::complex<float>* X);
+
+    template int rocalution_gram_orthonormalize(int n, double* G, double* T, double* R);
+    template int rocalution_gram_orthonormalize(int n, float* G, float* T, float* R);
+    template int rocalution_gram_orthonormalize(int                   n,
+                                                std::complex<double>* G,
+                                                std::complex<double>* T,
+                                                std::complex<double>* R);
+    template int rocalution_gram_orthonormalize(int                  n,
+                                                std::complex<float>* G,
+                                                std::complex<float>* T,
+                                                std::complex<float>* R);
+
 } // namespace rocalution
@@ -66,6 +66,33 @@ namespace rocalution
     template <typename ValueType>
     ValueType rocalution_eps(void);
 
+    /** \brief Solve a small dense Hermitian definite generalized eigenvalue problem
+      * \details
+      * Computes all eigenpairs of \f$Ax = \lambda Bx\f$, where the \p n x \p n matrices
+      * \p A and \p B are stored column-major, are Hermitian and \p B is positive definite.
+      * \p B is reduced by its Cholesky factor and the resulting standard problem is solved
+      * by the cyclic Jacobi method. The eigenvalues are returned in ascending order in
+      * \p lambda and the corresponding \p B-orthonormal eigenvectors are stored in the
+      * columns of \p X. \p A and \p B are overwritten. Returns false, if \p B is not
+      * numerically positive definite.
+      */
+    template <typename ValueType>
+    bool rocalution_hermitian_eigen(
+        int n, ValueType* A, ValueType* B, ValueType* lambda, ValueType* X);
+
+    /** \brief Compute a rank revealing orthonormalization from a small Gram matrix
+      * \details
+      * For the column-major \p n x \p n Gram matrix \f$G = W^{H}W\f$ of \p n vectors
+      * \f$W\f$, computes the \p n x \p r matrix \p T and the \p r x \p n matrix \p R,
+      * such that \f$Q = WT\f$ has orthonormal columns and \f$W = QR\f$. Directions of
+      * \f$W\f$ that are numerically linearly dependent after scaling its columns to unit
+      * length, and columns that are negligible compared to the largest one, are dropped.
+      * \p T and \p R are stored column-major with leading dimensions \p n and \p r.
+      * \p G is overwritten. Returns the rank \p r.
+      */
+    template <typename ValueType>
+    int rocalution_gram_orthonormalize(int n, ValueType* G, ValueType* T, ValueType* R);
+
     /// Overloaded < operator for complex numbers
     template <typename ValueType>
     bool operator<(const std::complex<ValueType>& lhs, const std::complex<ValueType>& rhs);